@@ -0,0 +1,416 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <trlevel/Decrypter.h>
+#include <trlevel/Level.h>
+#include <trlevel/Level_common.h>
+#include <trlevel/TextileConversion.h>
+#include <trview.common/Files.h>
+#include <trview.common/Logs/Log.h>
+#include <trview.tests.common/Benchmark.h>
+
+#include "SyntheticLevel.h"
+
+using namespace trlevel;
+using namespace trview::tests::benchmark;
+
+namespace
+{
+    std::string to_name(const PlatformAndVersion& target)
+    {
+        switch (target.platform)
+        {
+            case Platform::PSX:
+                return std::format("tr{}_psx", static_cast<int>(target.version));
+            case Platform::Saturn:
+                return std::format("tr{}_saturn", static_cast<int>(target.version));
+        }
+        return std::format("tr{}_pc", static_cast<int>(target.version));
+    }
+
+    void write_file(const std::filesystem::path& path, const std::vector<uint8_t>& bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    struct Options
+    {
+        SyntheticLevelOptions level;
+        uint32_t iterations{ 5 };
+        std::vector<PlatformAndVersion> targets
+        {
+            { .platform = Platform::PC, .version = LevelVersion::Tomb1 },
+            { .platform = Platform::PC, .version = LevelVersion::Tomb2 },
+            { .platform = Platform::PC, .version = LevelVersion::Tomb3 },
+            { .platform = Platform::PC, .version = LevelVersion::Tomb4 },
+            { .platform = Platform::PC, .version = LevelVersion::Tomb5 },
+            { .platform = Platform::PSX, .version = LevelVersion::Tomb1 },
+            { .platform = Platform::Saturn, .version = LevelVersion::Tomb1 }
+        };
+        bool parallel_rooms{ false };
+        std::vector<trview::Log::Mode> log_modes{ trview::Log::Mode::Text, trview::Log::Mode::Trace };
+    };
+
+    std::string to_name(trview::Log::Mode mode)
+    {
+        return mode == trview::Log::Mode::Text ? "text" : "trace";
+    }
+
+    Options parse_options(int argc, char** argv)
+    {
+        Options options;
+        std::optional<LevelVersion> version;
+        std::optional<Platform> platform;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const auto value = [&]() -> uint32_t
+                {
+                    if (i + 1 >= argc)
+                    {
+                        throw std::invalid_argument(std::format("Missing value for {}", arg));
+                    }
+                    return static_cast<uint32_t>(std::stoul(argv[++i]));
+                };
+
+            if (arg == "--rooms") { options.level.rooms = value(); }
+            else if (arg == "--room-size") { options.level.room_size = static_cast<uint16_t>(value()); }
+            else if (arg == "--entities") { options.level.entities = value(); }
+            else if (arg == "--textiles") { options.level.textiles = value(); }
+            else if (arg == "--meshes") { options.level.meshes = value(); }
+            else if (arg == "--models") { options.level.models = value(); }
+            else if (arg == "--sounds") { options.level.sounds = value(); }
+            else if (arg == "--iterations") { options.iterations = std::max(value(), 1u); }
+            else if (arg == "--version") { version = static_cast<LevelVersion>(value()); }
+            else if (arg == "--platform")
+            {
+                const std::string name = i + 1 < argc ? argv[++i] : "";
+                if (name == "pc") { platform = Platform::PC; }
+                else if (name == "psx") { platform = Platform::PSX; }
+                else if (name == "saturn") { platform = Platform::Saturn; }
+                else { throw std::invalid_argument(std::format("Unknown platform {}", name)); }
+            }
+            else if (arg == "--parallel-rooms") { options.parallel_rooms = true; }
+            else if (arg == "--log")
+            {
+                const std::string mode = i + 1 < argc ? argv[++i] : "";
+                if (mode == "text") { options.log_modes = { trview::Log::Mode::Text }; }
+                else if (mode == "trace") { options.log_modes = { trview::Log::Mode::Trace }; }
+                else if (mode != "both") { throw std::invalid_argument(std::format("Unknown log mode {}", mode)); }
+            }
+            else
+            {
+                throw std::invalid_argument(std::format("Unknown argument {}", arg));
+            }
+        }
+
+        std::erase_if(options.targets, [&](const auto& target)
+            {
+                return (version && target.version != version) || (platform && target.platform != platform);
+            });
+        return options;
+    }
+
+    template <typename Vertex>
+    void run_read_vector(const std::string& name, const ILevel& level, uint32_t iterations)
+    {
+        // The largest arrays in each room, sized as the loaded level and laid out as this version stores them.
+        std::size_t vertices = 0;
+        std::size_t rectangles = 0;
+        std::size_t sectors = 0;
+        for (uint32_t r = 0; r < level.num_rooms(); ++r)
+        {
+            const auto room = level.get_room(r);
+            vertices += room.data.vertices.size();
+            rectangles += room.data.rectangles.size();
+            sectors += room.sector_list.size();
+        }
+        const std::size_t floordata = level.get_floor_data_all().size();
+        std::vector<uint8_t> buffer(vertices * sizeof(Vertex) + rectangles * sizeof(tr_face4) + sectors * sizeof(tr_room_sector) + floordata * sizeof(uint16_t));
+
+        const auto read_all = [&](auto&& read_array)
+            {
+                std::basic_ispanstream<uint8_t> file{ std::span(buffer) };
+                file.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
+                read_array(file, Vertex{}, vertices);
+                read_array(file, tr_face4{}, rectangles);
+                read_array(file, tr_room_sector{}, sectors);
+                read_array(file, uint16_t{}, floordata);
+            };
+
+        print(measure(std::format("{} read_vector", name), iterations, buffer.size(), [&]()
+            {
+                read_all([](auto& file, auto type, std::size_t count)
+                    {
+                        const auto values = read_vector<decltype(type)>(file, count);
+                        if (values.size() != count)
+                        {
+                            throw std::runtime_error("Read the wrong number of elements");
+                        }
+                    });
+            }));
+        print(measure(std::format("{} read per element", name), iterations, buffer.size(), [&]()
+            {
+                read_all([](auto& file, auto type, std::size_t count)
+                    {
+                        std::vector<decltype(type)> values(count);
+                        for (auto& value : values)
+                        {
+                            trlevel::read(file, value);
+                        }
+                    });
+            }));
+    }
+
+    // Times reading the bulk room arrays with the room vertex type of the target.
+    void run_read_vector(const PlatformAndVersion& target, const std::string& name, const ILevel& level, uint32_t iterations)
+    {
+        switch (target.version)
+        {
+            case LevelVersion::Tomb1:
+                return run_read_vector<tr_room_vertex>(name, level, iterations);
+            case LevelVersion::Tomb2:
+                return run_read_vector<tr2_room_vertex>(name, level, iterations);
+            case LevelVersion::Tomb3:
+            case LevelVersion::Tomb4:
+                return run_read_vector<tr3_room_vertex>(name, level, iterations);
+            case LevelVersion::Tomb5:
+                return run_read_vector<tr5_room_vertex>(name, level, iterations);
+        }
+    }
+
+    void run(const PlatformAndVersion& target, const Options& options, const std::filesystem::path& directory)
+    {
+        const auto name = to_name(target);
+        const auto synthetic = generate_level(target, options.level);
+        const auto folder = directory / name;
+        std::filesystem::create_directories(folder);
+        const auto filename = (folder / synthetic.filename).string();
+        write_file(filename, synthetic.level);
+        for (const auto& [file, bytes] : synthetic.files)
+        {
+            write_file(folder / file, bytes);
+        }
+
+        auto files = std::make_shared<trview::Files>();
+        auto decrypter = std::make_shared<Decrypter>();
+
+        // Mesh and lookup generation are private to the level, so they are timed from the progress messages around
+        // them. Each stage ends at the next message.
+        std::map<std::string, double> stage_milliseconds;
+        std::optional<std::pair<std::string, std::chrono::steady_clock::time_point>> stage_start;
+        ILevel::LoadCallbacks callbacks;
+        callbacks.parallel_rooms = options.parallel_rooms;
+        callbacks.on_progress_callback = [&](const std::string& message)
+            {
+                if (stage_start)
+                {
+                    stage_milliseconds[stage_start->first] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stage_start->second).count();
+                    stage_start.reset();
+                }
+                if (message == "Generating meshes" || message == "Generating lookups")
+                {
+                    stage_start = { message, std::chrono::steady_clock::now() };
+                }
+            };
+
+        // The load is timed with each log mode, so the cost of formatting load messages as they are logged can be
+        // compared with storing trace events. Mesh and lookup generation are reported for the last mode.
+        std::shared_ptr<Level> level;
+        for (const auto mode : options.log_modes)
+        {
+            auto log = std::make_shared<trview::Log>(mode);
+            stage_milliseconds.clear();
+            print(measure(std::format("{} load ({} log)", name, to_name(mode)), options.iterations, synthetic.level.size(), [&]()
+                {
+                    log->clear();
+                    level.reset();
+                    level = std::make_shared<Level>(filename, nullptr, files, decrypter, log);
+                    level->load(callbacks);
+                }));
+        }
+
+        // Version detection reads the generated bytes, so make sure they were taken for what they were meant to be.
+        const auto loaded = level->platform_and_version();
+        if (loaded.platform != target.platform || loaded.version != target.version)
+        {
+            throw std::runtime_error(std::format("{} was loaded as {} {}", name, to_string(loaded.platform), to_string(loaded.version)));
+        }
+
+        // Only the time is known for mesh and lookup generation as they run inside the load.
+        print(
+            {
+                .name = std::format("{} generate_meshes", name),
+                .iterations = options.iterations,
+                .milliseconds = stage_milliseconds["Generating meshes"] / options.iterations
+            });
+        print(
+            {
+                .name = std::format("{} generate_lookups", name),
+                .iterations = options.iterations,
+                .milliseconds = stage_milliseconds["Generating lookups"] / options.iterations
+            });
+
+        // Every entity looks up its model and the first entity of its type, as building items does. The scan is
+        // what the lookups replaced.
+        const uint32_t num_entities = level->num_entities();
+        std::vector<int16_t> entity_types(num_entities);
+        for (uint32_t e = 0; e < num_entities; ++e)
+        {
+            entity_types[e] = level->get_entity(e).TypeID;
+        }
+        std::vector<tr_model> models(level->num_models());
+        for (uint32_t m = 0; m < models.size(); ++m)
+        {
+            models[m] = level->get_model(m);
+        }
+        print(measure(std::format("{} model lookups", name), options.iterations, 0, [&]()
+            {
+                tr_model model;
+                tr2_entity entity;
+                for (const auto type : entity_types)
+                {
+                    if (!level->get_model_by_id(type, model) || !level->find_first_entity_by_type(type, entity))
+                    {
+                        throw std::runtime_error("Entity type was not found");
+                    }
+                }
+            }));
+        print(measure(std::format("{} model scans", name), options.iterations, 0, [&]()
+            {
+                for (const auto type : entity_types)
+                {
+                    if (std::ranges::find(models, static_cast<uint32_t>(type), &tr_model::ID) == models.end())
+                    {
+                        throw std::runtime_error("Entity type was not found");
+                    }
+                }
+            }));
+
+        run_read_vector(target, name, *level, options.iterations);
+
+        const uint32_t frame_repeats = 1000;
+        std::size_t frame_bytes = 0;
+        for (uint32_t m = 0; m < level->num_models(); ++m)
+        {
+            frame_bytes += level->get_model(m).NumMeshes * 2 * sizeof(uint16_t) * frame_repeats;
+        }
+        print(measure(std::format("{} get_frame", name), options.iterations, frame_bytes, [&]()
+            {
+                for (uint32_t r = 0; r < frame_repeats; ++r)
+                {
+                    for (uint32_t m = 0; m < level->num_models(); ++m)
+                    {
+                        const auto model = level->get_model(m);
+                        const auto frame = level->get_frame(model.FrameOffset / 2, model.NumMeshes);
+                        if (frame.values.size() != model.NumMeshes)
+                        {
+                            throw std::runtime_error("Frame decoded with the wrong number of rotations");
+                        }
+                    }
+                }
+            }));
+    }
+
+    // Compares the bulk texel conversions with converting one texel at a time.
+    void run_textiles(uint32_t iterations, uint32_t textiles)
+    {
+        const std::size_t texels = std::size_t(256) * 256 * std::max(textiles, 1u);
+        std::vector<uint16_t> input16(texels);
+        std::vector<uint32_t> input32(texels);
+        std::vector<tr_colorindex4> input4(texels / 2);
+        for (std::size_t i = 0; i < texels; ++i)
+        {
+            input16[i] = static_cast<uint16_t>(i * 2654435761u);
+            input32[i] = static_cast<uint32_t>(i * 2654435761u);
+        }
+        std::memset(input4.data(), 0x5a, input4.size());
+        tr_clut clut{};
+        std::vector<uint32_t> output32(texels);
+        std::vector<uint16_t> output16(texels);
+
+        print(measure("textile16 per texel", iterations, texels * sizeof(uint16_t), [&]()
+            {
+                std::ranges::transform(input16, output32.begin(), [](uint16_t t) { return convert_textile16(t); });
+            }));
+        print(measure("textile16 scalar", iterations, texels * sizeof(uint16_t), [&]() { scalar::convert_textile16(input16, output32); }));
+        print(measure("textile16", iterations, texels * sizeof(uint16_t), [&]() { convert_textile16(input16, output32); }));
+        print(measure("textile32 per texel", iterations, texels * sizeof(uint32_t), [&]()
+            {
+                std::ranges::transform(input32, output32.begin(), [](uint32_t t) { return convert_textile32(t); });
+            }));
+        print(measure("textile32 scalar", iterations, texels * sizeof(uint32_t), [&]() { scalar::convert_textile32(input32, output32); }));
+        print(measure("textile32", iterations, texels * sizeof(uint32_t), [&]() { convert_textile32(input32, output32); }));
+        print(measure("textile4 scalar", iterations, texels / 2, [&]() { scalar::expand_textile4(input4, 0, clut, output16); }));
+        print(measure("textile4", iterations, texels / 2, [&]() { expand_textile4(input4, 0, clut, output16); }));
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const auto options = parse_options(argc, argv);
+        const auto directory = std::filesystem::temp_directory_path() / "trlevel.benchmarks";
+
+        std::cout << std::format("{} rooms of {}x{} sectors, {} entities, {} textiles, {} meshes, {} models, {} sounds\n",
+            options.level.rooms, options.level.room_size, options.level.room_size, options.level.entities,
+            options.level.textiles, options.level.meshes, options.level.models, options.level.sounds);
+        print_header();
+
+        for (const auto& target : options.targets)
+        {
+            run(target, options, directory);
+        }
+        run_textiles(options.iterations, options.level.textiles);
+
+        std::filesystem::remove_all(directory);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
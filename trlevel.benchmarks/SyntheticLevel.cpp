@@ -0,0 +1,303 @@
+#include "SyntheticLevel.h"
+#include "SyntheticLevel_common.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+namespace trlevel
+{
+    namespace synthetic
+    {
+        Counts make_counts(const SyntheticLevelOptions& options)
+        {
+            const uint32_t rooms = std::min(options.rooms, MaxRooms);
+            const uint32_t textiles = std::max(options.textiles, 1u);
+            return
+            {
+                .rooms = rooms,
+                .room_size = std::clamp<uint16_t>(options.room_size, 1, MaxRoomSize),
+                .grid = static_cast<uint32_t>(std::ceil(std::sqrt(std::max(rooms, 1u)))),
+                .textiles = textiles,
+                .object_textures = textiles * ObjectTexturesPerTextile,
+                .meshes = std::max(options.meshes, MeshesPerModel),
+                .models = std::max(options.models, 1u),
+                .boxes = std::max(rooms, 1u),
+                .entities = options.entities,
+                .sounds = std::min(options.sounds, 255u)
+            };
+        }
+
+        tr1_4_room_info room_info(const Counts& counts, uint32_t room)
+        {
+            const int32_t x = static_cast<int32_t>((room % counts.grid) * counts.room_size * 1024);
+            const int32_t z = static_cast<int32_t>((room / counts.grid) * counts.room_size * 1024);
+            return { .x = x, .z = z, .yBottom = 0, .yTop = -1024 };
+        }
+
+        std::vector<tr_vertex> room_vertices(const Counts& counts)
+        {
+            const uint16_t side = static_cast<uint16_t>(counts.room_size + 1);
+            std::vector<tr_vertex> vertices;
+            vertices.reserve(side * side);
+            for (uint16_t vz = 0; vz < side; ++vz)
+            {
+                for (uint16_t vx = 0; vx < side; ++vx)
+                {
+                    vertices.push_back({ static_cast<int16_t>(vx * 1024), 0, static_cast<int16_t>(vz * 1024) });
+                }
+            }
+            return vertices;
+        }
+
+        std::vector<tr_face4> room_rectangles(const Counts& counts)
+        {
+            const uint16_t size = counts.room_size;
+            const uint16_t side = static_cast<uint16_t>(size + 1);
+            std::vector<tr_face4> rectangles;
+            rectangles.reserve(size * size);
+            for (uint16_t sz = 0; sz < size; ++sz)
+            {
+                for (uint16_t sx = 0; sx < size; ++sx)
+                {
+                    const uint16_t v = static_cast<uint16_t>(sz * side + sx);
+                    rectangles.push_back(
+                        {
+                            .vertices = { v, static_cast<uint16_t>(v + 1), static_cast<uint16_t>(v + side + 1), static_cast<uint16_t>(v + side) },
+                            .texture = static_cast<uint16_t>((sz * size + sx) % counts.object_textures)
+                        });
+                }
+            }
+            return rectangles;
+        }
+
+        tr_room_sector room_sector(const Counts& counts, uint32_t room, uint16_t floordata_index)
+        {
+            return
+            {
+                .floordata_index = floordata_index,
+                .box_index = static_cast<uint16_t>(room % counts.boxes),
+                .room_below = 255,
+                .floor = 0,
+                .room_above = 255,
+                .ceiling = -4
+            };
+        }
+
+        uint16_t add_floordata(std::vector<uint16_t>& floor_data, const Counts& counts, uint32_t sector)
+        {
+            // The longest command list is eight words.
+            if (floor_data.size() + 8 >= 0xffff)
+            {
+                return 0;
+            }
+
+            constexpr uint16_t End = 0x8000;
+            constexpr uint16_t FloorSlant = 0x02;
+            constexpr uint16_t CeilingSlant = 0x03;
+            constexpr uint16_t Trigger = 0x04;
+            constexpr uint16_t Death = 0x05;
+            constexpr uint16_t Object = 0 << 10;
+            constexpr uint16_t Camera = 1 << 10;
+
+            const auto index = static_cast<uint16_t>(floor_data.size());
+            const auto slope = static_cast<uint16_t>(sector & 0x0303);
+            switch (sector % 4)
+            {
+                case 0:
+                    floor_data.append_range(std::vector<uint16_t>{ End | FloorSlant, slope });
+                    break;
+                case 1:
+                    floor_data.append_range(std::vector<uint16_t>{ FloorSlant, slope, End | CeilingSlant, slope });
+                    break;
+                case 2:
+                {
+                    // A trigger for an entity and the camera, where the extra word that cameras have ends the actions.
+                    const auto entity = static_cast<uint16_t>(counts.entities ? sector % std::min(counts.entities, 1024u) : 0);
+                    floor_data.append_range(std::vector<uint16_t>{ FloorSlant, slope, Trigger, 0x3e00, Object | entity, Camera, End, End | Death });
+                    break;
+                }
+                default:
+                    floor_data.push_back(End | Death);
+                    break;
+            }
+            return index;
+        }
+
+        std::vector<tr_vertex> mesh_vertices(uint32_t mesh)
+        {
+            const int16_t h = static_cast<int16_t>(128 + mesh % 128);
+            return
+            {
+                { -h, -h, -h }, { h, -h, -h }, { h, h, -h }, { -h, h, -h },
+                { -h, -h, h }, { h, -h, h }, { h, h, h }, { -h, h, h }
+            };
+        }
+
+        std::vector<tr_face4> mesh_rectangles(uint32_t mesh, uint32_t textures)
+        {
+            const auto texture = [&](uint32_t face) { return static_cast<uint16_t>((mesh * 6 + face) % textures); };
+            return
+            {
+                { { 0, 1, 2, 3 }, texture(0) },
+                { { 5, 4, 7, 6 }, texture(1) },
+                { { 4, 0, 3, 7 }, texture(2) },
+                { { 1, 5, 6, 2 }, texture(3) },
+                { { 4, 5, 1, 0 }, texture(4) },
+                { { 3, 2, 6, 7 }, texture(5) }
+            };
+        }
+
+        Models generate_models(const Counts& counts, bool frame_count)
+        {
+            Models result;
+            for (uint32_t m = 0; m < counts.models; ++m)
+            {
+                result.models.push_back(
+                    {
+                        .ID = m,
+                        .NumMeshes = static_cast<uint16_t>(MeshesPerModel),
+                        .StartingMesh = static_cast<uint16_t>((m * MeshesPerModel) % (counts.meshes - MeshesPerModel + 1)),
+                        .MeshTree = static_cast<uint32_t>(result.meshtree.size()),
+                        .FrameOffset = static_cast<uint32_t>(result.frames.size() * 2),
+                        .Animation = 0xffff
+                    });
+
+                for (uint32_t n = 1; n < MeshesPerModel; ++n)
+                {
+                    result.meshtree.append_range(std::vector<uint32_t>{ 0, 0, static_cast<uint32_t>(-256), 0 });
+                }
+
+                result.frames.append_range(std::vector<uint16_t>{ static_cast<uint16_t>(-256), static_cast<uint16_t>(-256), static_cast<uint16_t>(-256), 256, 256, 256, 0, 0, 0 });
+                if (frame_count)
+                {
+                    result.frames.push_back(static_cast<uint16_t>(MeshesPerModel));
+                }
+                for (uint32_t n = 0; n < MeshesPerModel; ++n)
+                {
+                    result.frames.push_back(static_cast<uint16_t>((m + n) & 0x3fff));
+                    result.frames.push_back(static_cast<uint16_t>((m * n) & 0xffff));
+                }
+            }
+            return result;
+        }
+
+        std::vector<tr_object_texture> generate_object_textures(const Counts& counts)
+        {
+            std::vector<tr_object_texture> object_textures;
+            for (uint32_t t = 0; t < counts.object_textures; ++t)
+            {
+                const uint16_t tile = static_cast<uint16_t>(t / ObjectTexturesPerTextile);
+                const uint8_t x = static_cast<uint8_t>((t % 4) * 64);
+                const uint8_t y = static_cast<uint8_t>(((t / 4) % 4) * 64);
+                const uint8_t x2 = static_cast<uint8_t>(x + 63);
+                const uint8_t y2 = static_cast<uint8_t>(y + 63);
+                object_textures.push_back(
+                    {
+                        .Attribute = 0,
+                        .TileAndFlag = tile,
+                        .Vertices = { { 0, x, 0, y }, { 0, x2, 0, y }, { 0, x2, 0, y2 }, { 0, x, 0, y2 } }
+                    });
+            }
+            return object_textures;
+        }
+
+        std::vector<tr2_entity> generate_entities(const Counts& counts)
+        {
+            std::vector<tr2_entity> entities;
+            for (uint32_t e = 0; e < counts.entities; ++e)
+            {
+                const uint32_t room = counts.rooms ? e % counts.rooms : 0;
+                const auto info = room_info(counts, room);
+                entities.push_back(
+                    {
+                        .TypeID = static_cast<int16_t>(e % counts.models),
+                        .Room = static_cast<int16_t>(room),
+                        .x = info.x + 512 + static_cast<int32_t>((e % counts.room_size) * 1024),
+                        .y = 0,
+                        .z = info.z + 512,
+                        .Angle = 0,
+                        .Intensity1 = -1,
+                        .Intensity2 = -1,
+                        .Flags = 0x3e00
+                    });
+            }
+            return entities;
+        }
+
+        tr_camera generate_camera(const Counts&)
+        {
+            return { .x = 512, .y = -512, .z = 512, .Room = 0, .Flag = 0 };
+        }
+
+        std::vector<int16_t> generate_sound_map(std::size_t size, uint32_t sounds)
+        {
+            std::vector<int16_t> sound_map(size, -1);
+            for (uint32_t i = 0; i < std::min<uint32_t>(sounds, static_cast<uint32_t>(sound_map.size())); ++i)
+            {
+                sound_map[i] = static_cast<int16_t>(i);
+            }
+            return sound_map;
+        }
+
+        std::vector<uint8_t> generate_sample(uint32_t index)
+        {
+            const uint32_t samples = 256 + (index % 16) * 64;
+            Writer writer;
+            writer.write_text("RIFF");
+            writer.write(36 + samples);
+            writer.write_text("WAVEfmt ");
+            writer.write(uint32_t{ 16 });
+            writer.write(uint16_t{ 1 }); // PCM
+            writer.write(uint16_t{ 1 }); // Channels
+            writer.write(uint32_t{ 11025 });
+            writer.write(uint32_t{ 11025 });
+            writer.write(uint16_t{ 1 }); // Block align
+            writer.write(uint16_t{ 8 }); // Bits per sample
+            writer.write_text("data");
+            writer.write(samples);
+            writer.write_all(std::vector<uint8_t>(samples, 128));
+            return writer.take();
+        }
+    }
+
+    SyntheticLevel generate_level(const PlatformAndVersion& target, const SyntheticLevelOptions& options)
+    {
+        const auto counts = synthetic::make_counts(options);
+        switch (target.platform)
+        {
+            case Platform::PC:
+            {
+                switch (target.version)
+                {
+                    case LevelVersion::Tomb1:
+                    case LevelVersion::Tomb2:
+                    case LevelVersion::Tomb3:
+                        return synthetic::generate_tr1_3_pc(target.version, counts);
+                    case LevelVersion::Tomb4:
+                    case LevelVersion::Tomb5:
+                        return synthetic::generate_tr4_5_pc(target.version, counts);
+                }
+                break;
+            }
+            case Platform::PSX:
+            {
+                if (target.version == LevelVersion::Tomb1)
+                {
+                    return synthetic::generate_tr1_psx(counts);
+                }
+                break;
+            }
+            case Platform::Saturn:
+            {
+                if (target.version == LevelVersion::Tomb1)
+                {
+                    return synthetic::generate_tr1_saturn(counts);
+                }
+                break;
+            }
+        }
+        throw std::invalid_argument(std::format("Synthetic levels can't be generated for {} {}", to_string(target.platform), to_string(target.version)));
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <trlevel/LevelVersion.h>
+
+namespace trlevel
+{
+    // Controls the size of a generated level.
+    struct SyntheticLevelOptions
+    {
+        uint32_t rooms{ 64 };
+        // Number of sectors along each side of a room, up to 31.
+        uint16_t room_size{ 16 };
+        uint32_t entities{ 512 };
+        uint32_t textiles{ 8 };
+        uint32_t meshes{ 256 };
+        uint32_t models{ 64 };
+        uint32_t sounds{ 64 };
+    };
+
+    struct SyntheticLevel
+    {
+        // The level filename, as some versions are told apart by the extension.
+        std::string filename;
+        std::vector<uint8_t> level;
+        // Files that the loader expects to find next to the level, such as MAIN.SFX, by filename.
+        std::map<std::string, std::vector<uint8_t>> files;
+    };
+
+    // Builds a level file that the loader for the platform and version will accept, without needing game data.
+    // target: PC Tomb1 to Tomb5, PSX Tomb1 or Saturn Tomb1.
+    // options: The number of each kind of element to generate.
+    // Returns: The level and any supporting files.
+    SyntheticLevel generate_level(const PlatformAndVersion& target, const SyntheticLevelOptions& options);
+}
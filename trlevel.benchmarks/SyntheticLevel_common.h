@@ -0,0 +1,134 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include <trlevel/trtypes.h>
+
+#include "SyntheticLevel.h"
+
+namespace trlevel
+{
+    // Parts shared by the generators for each platform. Every format is built from the same rooms, meshes, models
+    // and entities so that load times can be compared between them.
+    namespace synthetic
+    {
+        // Room vertex positions are 16 bit, so rooms can be at most 31 sectors across.
+        constexpr uint16_t MaxRoomSize = 31;
+        constexpr uint32_t MaxRooms = 1024;
+        constexpr uint32_t MeshesPerModel = 4;
+        constexpr uint32_t ObjectTexturesPerTextile = 16;
+
+        class Writer final
+        {
+        public:
+            template <typename T>
+            void write(const T& value)
+            {
+                const auto bytes = reinterpret_cast<const uint8_t*>(&value);
+                _data.insert(_data.end(), bytes, bytes + sizeof(T));
+            }
+
+            // Saturn files are big endian.
+            template <std::integral T>
+            void write_be(T value)
+            {
+                write(std::byteswap(value));
+            }
+
+            template <typename SizeType, typename T>
+            void write_vector(const std::vector<T>& values)
+            {
+                write(static_cast<SizeType>(values.size()));
+                write_all(values);
+            }
+
+            template <typename T>
+            void write_all(const std::vector<T>& values)
+            {
+                const auto bytes = reinterpret_cast<const uint8_t*>(values.data());
+                _data.insert(_data.end(), bytes, bytes + values.size() * sizeof(T));
+            }
+
+            void write_text(std::string_view text)
+            {
+                _data.insert(_data.end(), text.begin(), text.end());
+            }
+
+            template <typename T>
+            void patch(std::size_t offset, const T& value)
+            {
+                std::memcpy(_data.data() + offset, &value, sizeof(T));
+            }
+
+            std::size_t size() const
+            {
+                return _data.size();
+            }
+
+            std::vector<uint8_t> take()
+            {
+                return std::move(_data);
+            }
+        private:
+            std::vector<uint8_t> _data;
+        };
+
+        struct Counts
+        {
+            uint32_t rooms;
+            uint16_t room_size;
+            uint32_t grid;
+            uint32_t textiles;
+            uint32_t object_textures;
+            uint32_t meshes;
+            uint32_t models;
+            uint32_t boxes;
+            uint32_t entities;
+            uint32_t sounds;
+        };
+
+        // Every model has a chain of meshes, one frame, and an entry in the mesh tree for each child mesh.
+        struct Models
+        {
+            std::vector<uint32_t> meshtree;
+            std::vector<uint16_t> frames;
+            std::vector<tr_model> models;
+        };
+
+        Counts make_counts(const SyntheticLevelOptions& options);
+
+        tr1_4_room_info room_info(const Counts& counts, uint32_t room);
+        // A flat grid of vertices one sector apart, row by row.
+        std::vector<tr_vertex> room_vertices(const Counts& counts);
+        // A rectangle for each sector, textured with each object texture in turn.
+        std::vector<tr_face4> room_rectangles(const Counts& counts);
+        tr_room_sector room_sector(const Counts& counts, uint32_t room, uint16_t floordata_index);
+        // Adds the floordata for a sector, cycling through slants, triggers and death tiles, and returns where it
+        // starts. Sectors get no floordata once the 16 bit indices run out.
+        uint16_t add_floordata(std::vector<uint16_t>& floor_data, const Counts& counts, uint32_t sector);
+
+        // A cube, so that each mesh is a separate copy and mesh generation does the work for every pointer.
+        std::vector<tr_vertex> mesh_vertices(uint32_t mesh);
+        std::vector<tr_face4> mesh_rectangles(uint32_t mesh, uint32_t textures);
+
+        // frame_count: Whether frames store the number of meshes, as Tomb1 frames do.
+        Models generate_models(const Counts& counts, bool frame_count);
+        std::vector<tr_object_texture> generate_object_textures(const Counts& counts);
+        std::vector<tr2_entity> generate_entities(const Counts& counts);
+        tr_camera generate_camera(const Counts& counts);
+        // The loader finds the end of the sound map by peeking at the sound details count that follows
+        // it, so an entry followed by a zero would end the map early. Mapped entries only ever increase.
+        std::vector<int16_t> generate_sound_map(std::size_t size, uint32_t sounds);
+        // An 8-bit mono PCM wave file.
+        std::vector<uint8_t> generate_sample(uint32_t index);
+
+        SyntheticLevel generate_tr1_3_pc(LevelVersion version, const Counts& counts);
+        SyntheticLevel generate_tr4_5_pc(LevelVersion version, const Counts& counts);
+        SyntheticLevel generate_tr1_psx(const Counts& counts);
+        SyntheticLevel generate_tr1_saturn(const Counts& counts);
+    }
+}
@@ -0,0 +1,279 @@
+#include "SyntheticLevel_common.h"
+
+#include <stdexcept>
+
+namespace trlevel
+{
+    namespace synthetic
+    {
+        namespace
+        {
+            int32_t version_number(LevelVersion version)
+            {
+                switch (version)
+                {
+                    case LevelVersion::Tomb1:
+                        return 0x20;
+                    case LevelVersion::Tomb2:
+                        return 0x2D;
+                    case LevelVersion::Tomb3:
+                        return static_cast<int32_t>(0xFF080038);
+                }
+                throw std::invalid_argument("Synthetic PC levels can only be generated for Tomb1 to Tomb3 here");
+            }
+
+            void write_textiles(Writer& writer, LevelVersion version, uint32_t textiles)
+            {
+                if (version != LevelVersion::Tomb1)
+                {
+                    for (uint32_t i = 0; i < 256; ++i)
+                    {
+                        writer.write(tr_colour{ static_cast<uint8_t>(i / 4), static_cast<uint8_t>(i / 4), static_cast<uint8_t>(i / 4) });
+                    }
+                    for (uint32_t i = 0; i < 256; ++i)
+                    {
+                        writer.write(tr_colour4{ static_cast<uint8_t>(i), static_cast<uint8_t>(i), static_cast<uint8_t>(i), 0 });
+                    }
+                }
+
+                // Texel values are never zero so that nothing in the textiles looks like a
+                // version number to level version detection.
+                writer.write(textiles);
+                std::vector<uint8_t> textile8(256 * 256);
+                for (uint32_t t = 0; t < textiles; ++t)
+                {
+                    for (uint32_t i = 0; i < textile8.size(); ++i)
+                    {
+                        textile8[i] = static_cast<uint8_t>((i + t) % 255 + 1);
+                    }
+                    writer.write_all(textile8);
+                }
+
+                if (version != LevelVersion::Tomb1)
+                {
+                    std::vector<uint16_t> textile16(256 * 256);
+                    for (uint32_t t = 0; t < textiles; ++t)
+                    {
+                        for (uint32_t i = 0; i < textile16.size(); ++i)
+                        {
+                            textile16[i] = static_cast<uint16_t>(0x8000 | ((i + t) % 0x7fff + 1));
+                        }
+                        writer.write_all(textile16);
+                    }
+                }
+            }
+
+            void write_room_vertex(Writer& writer, LevelVersion version, const tr_vertex& vertex)
+            {
+                switch (version)
+                {
+                    case LevelVersion::Tomb1:
+                        writer.write(tr_room_vertex{ .vertex = vertex, .lighting = 4096 });
+                        break;
+                    case LevelVersion::Tomb2:
+                        writer.write(tr2_room_vertex{ .vertex = vertex, .lighting = 4096, .attributes = 0, .lighting2 = 4096 });
+                        break;
+                    default:
+                        writer.write(tr3_room_vertex{ .vertex = vertex, .lighting = 4096, .attributes = 0, .colour = 0x7fff });
+                        break;
+                }
+            }
+
+            void write_room(Writer& writer, LevelVersion version, const Counts& counts, uint32_t index, std::vector<uint16_t>& floor_data)
+            {
+                writer.write(room_info(counts, index));
+
+                // The data words are patched once the geometry has been written.
+                const auto data_words_at = writer.size();
+                writer.write(uint32_t{ 0 });
+                const auto data_start = writer.size();
+
+                const auto vertices = room_vertices(counts);
+                writer.write(static_cast<int16_t>(vertices.size()));
+                for (const auto& vertex : vertices)
+                {
+                    write_room_vertex(writer, version, vertex);
+                }
+                writer.write_vector<int16_t>(room_rectangles(counts));
+                writer.write(int16_t{ 0 }); // triangles
+                writer.write(int16_t{ 0 }); // sprites
+                writer.patch(data_words_at, static_cast<uint32_t>((writer.size() - data_start) / 2));
+
+                writer.write(uint16_t{ 0 }); // portals
+                writer.write(counts.room_size);
+                writer.write(counts.room_size);
+                for (uint32_t s = 0; s < static_cast<uint32_t>(counts.room_size) * counts.room_size; ++s)
+                {
+                    writer.write(room_sector(counts, index, add_floordata(floor_data, counts, s)));
+                }
+
+                writer.write(int16_t{ 0 }); // ambient intensity
+                switch (version)
+                {
+                    case LevelVersion::Tomb1:
+                        writer.write(uint16_t{ 1 });
+                        writer.write(tr_room_light{});
+                        writer.write(uint16_t{ 0 }); // static meshes
+                        writer.write(int16_t{ -1 }); // alternate room
+                        writer.write(int16_t{ 0 }); // flags
+                        break;
+                    case LevelVersion::Tomb2:
+                        writer.write(int16_t{ 0 }); // ambient intensity 2
+                        writer.write(int16_t{ 0 }); // light mode
+                        writer.write(uint16_t{ 1 });
+                        writer.write(tr2_room_light{});
+                        writer.write(uint16_t{ 0 }); // static meshes
+                        writer.write(int16_t{ -1 }); // alternate room
+                        writer.write(int16_t{ 0 }); // flags
+                        break;
+                    default:
+                        writer.write(int16_t{ 0 }); // light mode
+                        writer.write(uint16_t{ 1 });
+                        writer.write(tr3_room_light{});
+                        writer.write(uint16_t{ 0 }); // static meshes
+                        writer.write(int16_t{ -1 }); // alternate room
+                        writer.write(int16_t{ 0 }); // flags
+                        writer.write(uint8_t{ 0 }); // water scheme
+                        writer.write(uint8_t{ 0 }); // reverb info
+                        writer.write(uint8_t{ 0 }); // filler
+                        break;
+                }
+            }
+
+            void write_mesh(Writer& writer, const Counts& counts, uint32_t index)
+            {
+                writer.write(tr_vertex{ 0, -256, 0 });
+                writer.write(int32_t{ 512 });
+                const auto vertices = mesh_vertices(index);
+                writer.write_vector<int16_t>(vertices);
+                writer.write_vector<int16_t>(vertices); // normals
+                writer.write_vector<int16_t>(mesh_rectangles(index, counts.object_textures));
+                writer.write(int16_t{ 0 }); // textured triangles
+                writer.write(int16_t{ 0 }); // coloured rectangles
+                writer.write(int16_t{ 0 }); // coloured triangles
+            }
+        }
+
+        SyntheticLevel generate_tr1_3_pc(LevelVersion version, const Counts& counts)
+        {
+            Writer writer;
+            writer.write(version_number(version));
+            write_textiles(writer, version, counts.textiles);
+            writer.write(uint32_t{ 0 }); // unused
+
+            std::vector<uint16_t> floor_data{ 0 };
+            writer.write(static_cast<uint16_t>(counts.rooms));
+            for (uint32_t r = 0; r < counts.rooms; ++r)
+            {
+                write_room(writer, version, counts, r, floor_data);
+            }
+            writer.write_vector<uint32_t>(floor_data);
+
+            Writer mesh_writer;
+            std::vector<uint32_t> mesh_pointers;
+            for (uint32_t m = 0; m < counts.meshes; ++m)
+            {
+                mesh_pointers.push_back(static_cast<uint32_t>(mesh_writer.size()));
+                write_mesh(mesh_writer, counts, m);
+            }
+            const auto mesh_data = mesh_writer.take();
+            writer.write(static_cast<uint32_t>(mesh_data.size() / 2));
+            writer.write_all(mesh_data);
+            writer.write_vector<uint32_t>(mesh_pointers);
+
+            writer.write(uint32_t{ 0 }); // animations
+            writer.write(uint32_t{ 0 }); // state changes
+            writer.write(uint32_t{ 0 }); // anim dispatches
+            writer.write(uint32_t{ 0 }); // anim commands
+
+            const auto models = generate_models(counts, version == LevelVersion::Tomb1);
+            writer.write_vector<uint32_t>(models.meshtree);
+            writer.write_vector<uint32_t>(models.frames);
+            writer.write_vector<uint32_t>(models.models);
+            writer.write(uint32_t{ 0 }); // static meshes
+
+            const auto object_textures = generate_object_textures(counts);
+            if (version != LevelVersion::Tomb3)
+            {
+                writer.write_vector<uint32_t>(object_textures);
+            }
+            writer.write(uint32_t{ 0 }); // sprite textures
+            writer.write(uint32_t{ 0 }); // sprite sequences
+            writer.write_vector<uint32_t>(std::vector<tr_camera>{ generate_camera(counts) });
+            writer.write(uint32_t{ 0 }); // sound sources
+
+            writer.write(counts.boxes);
+            if (version == LevelVersion::Tomb1)
+            {
+                writer.write_all(std::vector<tr_box>(counts.boxes));
+            }
+            else
+            {
+                writer.write_all(std::vector<tr2_box>(counts.boxes));
+            }
+            writer.write(uint32_t{ 0 }); // overlaps
+            writer.write_all(std::vector<int16_t>(counts.boxes * (version == LevelVersion::Tomb1 ? 6 : 10)));
+            writer.write_vector<uint32_t>(std::vector<uint16_t>{ 0 }); // animated textures
+
+            if (version == LevelVersion::Tomb3)
+            {
+                writer.write_vector<uint32_t>(object_textures);
+            }
+
+            const auto entities = generate_entities(counts);
+            writer.write(static_cast<uint32_t>(entities.size()));
+            for (const auto& entity : entities)
+            {
+                if (version == LevelVersion::Tomb1)
+                {
+                    writer.write(tr_entity{ entity.TypeID, entity.Room, entity.x, entity.y, entity.z, entity.Angle, entity.Intensity1, entity.Flags });
+                }
+                else
+                {
+                    writer.write(entity);
+                }
+            }
+
+            writer.write_all(std::vector<uint8_t>(32 * 256)); // light map
+            if (version == LevelVersion::Tomb1)
+            {
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    writer.write(tr_colour{ static_cast<uint8_t>(i / 4), static_cast<uint8_t>(i / 4), static_cast<uint8_t>(i / 4) });
+                }
+            }
+            writer.write(uint16_t{ 0 }); // cinematic frames
+            writer.write(uint16_t{ 0 }); // demo data
+
+            writer.write_all(generate_sound_map(version == LevelVersion::Tomb1 ? 256 : 370, counts.sounds));
+            writer.write(counts.sounds);
+            for (uint32_t s = 0; s < counts.sounds; ++s)
+            {
+                writer.write(tr_sound_details{ .Sample = static_cast<uint16_t>(s), .Volume = 0x7fff, .Chance = 0, .Characteristics = 1 << 2 });
+            }
+
+            SyntheticLevel result{ .filename = version == LevelVersion::Tomb1 ? "level.phd" : "level.tr2" };
+            Writer samples;
+            std::vector<uint32_t> sample_indices;
+            for (uint32_t s = 0; s < counts.sounds; ++s)
+            {
+                sample_indices.push_back(version == LevelVersion::Tomb1 ? static_cast<uint32_t>(samples.size()) : s);
+                samples.write_all(generate_sample(s));
+            }
+
+            if (version == LevelVersion::Tomb1)
+            {
+                const auto sound_data = samples.take();
+                writer.write_vector<int32_t>(sound_data);
+            }
+            else
+            {
+                result.files["MAIN.SFX"] = samples.take();
+            }
+            writer.write_vector<uint32_t>(sample_indices);
+
+            result.level = writer.take();
+            return result;
+        }
+    }
+}
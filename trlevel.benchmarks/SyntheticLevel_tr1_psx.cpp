@@ -0,0 +1,252 @@
+#include "SyntheticLevel_common.h"
+
+namespace trlevel
+{
+    namespace synthetic
+    {
+        namespace
+        {
+            constexpr uint32_t Version = 32;
+            constexpr uint32_t Textiles = 13;
+            constexpr uint32_t Cluts = 1024;
+            // Mesh faces with a texture index below this are coloured, so mesh textures start after it.
+            constexpr uint32_t FirstMeshTexture = 256;
+
+            // A minimal VAG stream: a header and blocks of silence, ending with a block flagged as the end.
+            std::vector<uint8_t> generate_vag_sample(uint32_t index)
+            {
+                const uint32_t blocks = 8 + index % 8;
+                std::vector<uint8_t> sample(16 + blocks * 16);
+                sample[16 + (blocks - 1) * 16 + 1] = 7;
+                return sample;
+            }
+
+            // The sound header and sample data that come before the textiles. The loader finds the textiles from the
+            // address in the header, while version detection finds them from the two sizes.
+            void write_sounds(Writer& writer, const Counts& counts)
+            {
+                const uint16_t num_samples = static_cast<uint16_t>(counts.sounds);
+                std::vector<std::vector<uint8_t>> samples;
+                uint32_t data_size = 0;
+                for (uint32_t s = 0; s < num_samples; ++s)
+                {
+                    samples.push_back(generate_vag_sample(s));
+                    data_size += static_cast<uint32_t>(samples.back().size());
+                }
+
+                const uint32_t sample_start = 24 + 2062 + num_samples * 512;
+                const uint32_t header_size = sample_start + 510 - 4;
+                writer.write(header_size);
+                writer.write_text("pBAV");
+                writer.write_all(std::vector<uint8_t>(8));
+                writer.write(header_size + data_size); // textile address, 8 bytes before the textiles
+                writer.write(uint16_t{ 0 });
+                writer.write(num_samples);
+                writer.write_all(std::vector<uint8_t>(sample_start - writer.size()));
+
+                for (const auto& sample : samples)
+                {
+                    writer.write(static_cast<uint16_t>(sample.size() / 8));
+                }
+                writer.write_all(std::vector<uint8_t>(sample_start + 510 - writer.size()));
+                writer.write(data_size);
+                for (const auto& sample : samples)
+                {
+                    writer.write_all(sample);
+                }
+            }
+
+            // Index values are never zero so that nothing in the textiles looks like a version number.
+            void write_textiles(Writer& writer)
+            {
+                std::vector<uint8_t> textile(sizeof(tr_textile4));
+                for (uint32_t t = 0; t < Textiles; ++t)
+                {
+                    for (uint32_t i = 0; i < textile.size(); ++i)
+                    {
+                        textile[i] = static_cast<uint8_t>(0x11 * ((i + t) % 7 + 1));
+                    }
+                    writer.write_all(textile);
+                }
+
+                for (uint32_t c = 0; c < Cluts; ++c)
+                {
+                    tr_clut clut{};
+                    for (uint16_t i = 0; i < 16; ++i)
+                    {
+                        clut.Colour[i] = { .Red = static_cast<uint16_t>((c + i) % 31 + 1), .Green = static_cast<uint16_t>(i + 1), .Blue = static_cast<uint16_t>(c % 31 + 1), .Alpha = 1 };
+                    }
+                    writer.write(clut);
+                }
+            }
+
+            void write_room(Writer& writer, const Counts& counts, uint32_t index, std::vector<uint16_t>& floor_data)
+            {
+                writer.write(room_info(counts, index));
+
+                const auto data_words_at = writer.size();
+                writer.write(uint32_t{ 0 });
+                writer.write(uint16_t{ 0 });
+                const auto data_start = writer.size();
+
+                const auto vertices = room_vertices(counts);
+                writer.write(static_cast<int16_t>(vertices.size()));
+                for (const auto& vertex : vertices)
+                {
+                    writer.write(tr_room_vertex{ .vertex = vertex, .lighting = 4096 });
+                }
+
+                // The loader swaps the last two vertices of each room rectangle.
+                auto rectangles = room_rectangles(counts);
+                for (auto& rectangle : rectangles)
+                {
+                    std::swap(rectangle.vertices[2], rectangle.vertices[3]);
+                }
+                writer.write_vector<int16_t>(rectangles);
+                writer.write(int16_t{ 0 }); // triangles
+                writer.write(int16_t{ 0 }); // sprites
+                writer.patch(data_words_at, static_cast<uint32_t>((writer.size() - data_start) / 2));
+
+                writer.write(uint16_t{ 0 }); // portals
+                writer.write(counts.room_size);
+                writer.write(counts.room_size);
+                for (uint32_t s = 0; s < static_cast<uint32_t>(counts.room_size) * counts.room_size; ++s)
+                {
+                    writer.write(room_sector(counts, index, add_floordata(floor_data, counts, s)));
+                }
+
+                writer.write(int16_t{ 0 }); // ambient intensity
+                writer.write(uint16_t{ 1 });
+                writer.write(tr_room_light_psx{});
+                writer.write(uint16_t{ 0 }); // static meshes
+                writer.write(int16_t{ -1 }); // alternate room
+                writer.write(int16_t{ 0 }); // flags
+            }
+
+            tr_vertex_psx to_psx(const tr_vertex& vertex)
+            {
+                return { vertex.x, vertex.y, vertex.z, 0 };
+            }
+
+            void write_mesh(Writer& writer, const Counts& counts, uint32_t index)
+            {
+                writer.write(tr_vertex{ 0, -256, 0 });
+                writer.write(int32_t{ 512 });
+                const auto vertices = mesh_vertices(index);
+                writer.write(static_cast<int16_t>(vertices.size()));
+                for (const auto& vertex : vertices)
+                {
+                    writer.write(to_psx(vertex));
+                }
+                for (const auto& vertex : vertices)
+                {
+                    writer.write(to_psx(vertex)); // normals
+                }
+
+                auto rectangles = mesh_rectangles(index, counts.object_textures - FirstMeshTexture);
+                for (auto& rectangle : rectangles)
+                {
+                    rectangle.texture = static_cast<uint16_t>(rectangle.texture + FirstMeshTexture);
+                }
+                writer.write_vector<int16_t>(rectangles);
+                writer.write(int16_t{ 0 }); // triangles
+            }
+
+            // Each textile has its own colour lookup table.
+            std::vector<tr_object_texture_psx> generate_object_textures_psx(const Counts& counts)
+            {
+                std::vector<tr_object_texture_psx> object_textures;
+                for (uint32_t t = 0; t < counts.object_textures; ++t)
+                {
+                    const uint16_t tile = static_cast<uint16_t>((t / ObjectTexturesPerTextile) % Textiles);
+                    const uint8_t x = static_cast<uint8_t>((t % 4) * 64);
+                    const uint8_t y = static_cast<uint8_t>(((t / 4) % 4) * 64);
+                    const uint8_t x2 = static_cast<uint8_t>(x + 63);
+                    const uint8_t y2 = static_cast<uint8_t>(y + 63);
+                    object_textures.push_back(
+                        {
+                            .x0 = x, .y0 = y, .Clut = tile,
+                            .x1 = x2, .y1 = y, .Tile = tile,
+                            .x2 = x2, .y2 = y2, .tri_draw = 0, .quad_draw = 0,
+                            .x3 = x, .y3 = y2, .Attribute = 0
+                        });
+                }
+                return object_textures;
+            }
+        }
+
+        SyntheticLevel generate_tr1_psx(const Counts& level_counts)
+        {
+            Counts counts = level_counts;
+            counts.object_textures += FirstMeshTexture;
+
+            Writer writer;
+            write_sounds(writer, counts);
+            write_textiles(writer);
+            writer.write(Version);
+
+            std::vector<uint16_t> floor_data{ 0 };
+            writer.write(static_cast<uint16_t>(counts.rooms));
+            for (uint32_t r = 0; r < counts.rooms; ++r)
+            {
+                write_room(writer, counts, r, floor_data);
+            }
+            writer.write_vector<uint32_t>(floor_data);
+
+            Writer mesh_writer;
+            std::vector<uint32_t> mesh_pointers;
+            for (uint32_t m = 0; m < counts.meshes; ++m)
+            {
+                mesh_pointers.push_back(static_cast<uint32_t>(mesh_writer.size()));
+                write_mesh(mesh_writer, counts, m);
+            }
+            const auto mesh_data = mesh_writer.take();
+            writer.write(static_cast<uint32_t>(mesh_data.size() / 2));
+            writer.write_all(mesh_data);
+            writer.write_vector<uint32_t>(mesh_pointers);
+
+            writer.write(uint32_t{ 0 }); // animations
+            writer.write(uint32_t{ 0 }); // state changes
+            writer.write(uint32_t{ 0 }); // anim dispatches
+            writer.write(uint32_t{ 0 }); // anim commands
+
+            const auto models = generate_models(counts, true);
+            writer.write_vector<uint32_t>(models.meshtree);
+            writer.write_vector<uint32_t>(models.frames);
+            writer.write(static_cast<uint32_t>(models.models.size()));
+            for (const auto& model : models.models)
+            {
+                writer.write(tr_model_psx{ .model = model, .padding = 0 });
+            }
+            writer.write(uint32_t{ 0 }); // static meshes
+
+            writer.write_vector<uint32_t>(generate_object_textures_psx(counts));
+            writer.write(uint32_t{ 0 }); // sprite textures
+            writer.write(uint32_t{ 0 }); // sprite sequences
+            writer.write_vector<uint32_t>(std::vector<tr_camera>{ generate_camera(counts) });
+            writer.write(uint32_t{ 0 }); // sound sources
+
+            writer.write(counts.boxes);
+            writer.write_all(std::vector<tr_box>(counts.boxes));
+            writer.write(uint32_t{ 0 }); // overlaps
+            writer.write_all(std::vector<int16_t>(counts.boxes * 6));
+            writer.write_vector<uint32_t>(std::vector<uint16_t>{ 0 }); // animated textures
+
+            const auto entities = generate_entities(counts);
+            writer.write(static_cast<uint32_t>(entities.size()));
+            for (const auto& entity : entities)
+            {
+                writer.write(tr_entity{ entity.TypeID, entity.Room, entity.x, entity.y, entity.z, entity.Angle, entity.Intensity1, entity.Flags });
+            }
+
+            writer.write_all(generate_sound_map(256, counts.sounds));
+            writer.write(counts.sounds);
+            for (uint32_t s = 0; s < counts.sounds; ++s)
+            {
+                writer.write(tr_sound_details{ .Sample = static_cast<uint16_t>(s), .Volume = 0x7fff, .Chance = 0, .Characteristics = 1 << 2 });
+            }
+
+            return { .filename = "level.psx", .level = writer.take() };
+        }
+    }
+}
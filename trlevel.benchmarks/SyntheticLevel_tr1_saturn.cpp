@@ -0,0 +1,393 @@
+#include "SyntheticLevel_common.h"
+
+namespace trlevel
+{
+    namespace synthetic
+    {
+        namespace
+        {
+            constexpr uint32_t Version = 32;
+            // Room and object textures are 32x32 with 4 bits per texel and a 16 colour palette.
+            constexpr uint32_t TextureBytes = 32 * 32 / 2;
+            constexpr uint32_t PaletteBytes = 16 * sizeof(uint16_t);
+            constexpr uint16_t TexturedRectangle = 37;
+            constexpr uint16_t MeshTexturedRectangle = 9;
+
+            // Saturn files are a series of tags, each an 8 character name followed by its data.
+            void write_tag(Writer& writer, std::string_view name)
+            {
+                writer.write_text(name);
+                writer.write_all(std::vector<uint8_t>(8 - name.size()));
+            }
+
+            void write_header(Writer& writer, std::string_view name)
+            {
+                write_tag(writer, name);
+                writer.write_be(uint32_t{ 0 });
+                writer.write_be(Version);
+            }
+
+            // A tag with an element size and count, where the entries are written by the caller.
+            void write_list_tag(Writer& writer, std::string_view name, uint32_t size, uint32_t count)
+            {
+                write_tag(writer, name);
+                writer.write_be(size);
+                writer.write_be(count);
+            }
+
+            void write_be(Writer& writer, const tr_vertex& vertex)
+            {
+                writer.write_be(vertex.x);
+                writer.write_be(vertex.y);
+                writer.write_be(vertex.z);
+            }
+
+            // Saturn faces store indices pre-multiplied, so they are shifted by the amount the loader shifts them back.
+            void write_be(Writer& writer, const tr_face4& face, uint32_t vertex_shift)
+            {
+                for (const auto vertex : face.vertices)
+                {
+                    writer.write_be(static_cast<uint16_t>(vertex << vertex_shift));
+                }
+                writer.write_be(static_cast<uint16_t>(face.texture << 4));
+            }
+
+            void write_be(Writer& writer, const tr_room_sector& sector)
+            {
+                writer.write_be(sector.floordata_index);
+                writer.write_be(sector.box_index);
+                writer.write(sector.room_below);
+                writer.write(sector.floor);
+                writer.write(sector.room_above);
+                writer.write(sector.ceiling);
+            }
+
+            void write_be(Writer& writer, const tr_camera& camera)
+            {
+                writer.write_be(camera.x);
+                writer.write_be(camera.y);
+                writer.write_be(camera.z);
+                writer.write_be(camera.Room);
+                writer.write_be(camera.Flag);
+            }
+
+            void write_be(Writer& writer, const tr_model& model)
+            {
+                writer.write_be(model.ID);
+                writer.write_be(model.NumMeshes);
+                writer.write_be(model.StartingMesh);
+                writer.write_be(model.MeshTree);
+                writer.write_be(model.FrameOffset);
+                writer.write_be(model.Animation);
+            }
+
+            void write_be(Writer& writer, const tr_sound_details& details)
+            {
+                writer.write_be(details.Sample);
+                writer.write_be(details.Volume);
+                writer.write_be(details.Chance);
+                writer.write_be(details.Characteristics);
+            }
+
+            // Texel values are never zero, which the loader would treat as transparent in some cases.
+            void write_texture(Writer& writer, uint32_t index)
+            {
+                for (uint32_t i = 0; i < TextureBytes; ++i)
+                {
+                    writer.write(static_cast<uint8_t>(0x11 * ((i + index) % 15 + 1)));
+                }
+            }
+
+            void write_palette(Writer& writer, uint32_t index)
+            {
+                for (uint16_t i = 0; i < 16; ++i)
+                {
+                    writer.write_be(static_cast<uint16_t>(0x8000 | ((index + i) % 0x7fff + 1)));
+                }
+            }
+
+            void write_room(Writer& writer, const Counts& counts, uint32_t index, std::vector<uint16_t>& floor_data)
+            {
+                write_tag(writer, "ROOMNUMB");
+                writer.write_be(uint32_t{ 4 });
+                writer.write_be(index);
+
+                const auto info = room_info(counts, index);
+                write_tag(writer, "MESHPOS");
+                writer.write_be(info.x);
+                writer.write_be(info.z);
+                writer.write_be(info.yBottom);
+                writer.write_be(info.yTop);
+
+                write_tag(writer, "MESHSIZE");
+                writer.write_be(uint32_t{ 2 }); // mesh data rather than static meshes
+                const auto data_words_at = writer.size();
+                writer.write_be(uint32_t{ 0 });
+                const auto data_start = writer.size();
+
+                const auto vertices = room_vertices(counts);
+                writer.write_be(static_cast<uint16_t>(vertices.size()));
+                for (const auto& vertex : vertices)
+                {
+                    write_be(writer, vertex);
+                    writer.write_be(int16_t{ -4096 }); // lighting
+                }
+
+                const auto rectangles = room_rectangles(counts);
+                writer.write_be(static_cast<uint16_t>(rectangles.size()));
+                writer.write_be(uint16_t{ 1 }); // primitive groups
+                writer.write_be(TexturedRectangle);
+                writer.write_be(static_cast<uint16_t>(rectangles.size()));
+                for (const auto& rectangle : rectangles)
+                {
+                    write_be(writer, rectangle, 4);
+                }
+                writer.patch(data_words_at, std::byteswap(static_cast<uint32_t>((writer.size() - data_start) / 2)));
+
+                write_list_tag(writer, "DOORDATA", 0, 0);
+
+                write_tag(writer, "FLOORDAT");
+                writer.write_be(static_cast<uint32_t>(counts.room_size));
+                writer.write_be(static_cast<uint32_t>(counts.room_size));
+                write_list_tag(writer, "FLOORSIZ", sizeof(tr_room_sector), static_cast<uint32_t>(counts.room_size) * counts.room_size);
+                for (uint32_t s = 0; s < static_cast<uint32_t>(counts.room_size) * counts.room_size; ++s)
+                {
+                    write_be(writer, room_sector(counts, index, add_floordata(floor_data, counts, s)));
+                }
+
+                write_tag(writer, "LIGHTAMB");
+                writer.write_be(uint32_t{ 0 });
+                writer.write_be(uint32_t{ 0 });
+                write_list_tag(writer, "LIGHTSIZ", 20, 1);
+                writer.write_all(std::vector<uint8_t>(20));
+                write_tag(writer, "RM_FLIP");
+                writer.write_be(uint32_t{ 4 });
+                writer.write_be(uint32_t{ 0xffffffff });
+                write_tag(writer, "RM_FLAGS");
+                writer.write_be(uint32_t{ 4 });
+                writer.write_be(uint32_t{ 0 });
+            }
+
+            std::vector<uint8_t> generate_sat(const Counts& counts)
+            {
+                Writer writer;
+                write_header(writer, "ROOMFILE");
+
+                // Room faces use room textures, which the loader places after the object textures.
+                write_list_tag(writer, "ROOMTINF", 16, counts.object_textures);
+                for (uint32_t t = 0; t < counts.object_textures; ++t)
+                {
+                    const uint16_t start = static_cast<uint16_t>(t * TextureBytes / 8);
+                    writer.write_be(static_cast<uint16_t>(t * PaletteBytes / 8)); // palette
+                    writer.write_be(start);
+                    writer.write_be(uint16_t{ 0 });
+                    writer.write_be(uint16_t{ 0 });
+                    writer.write_be(static_cast<uint16_t>(start + TextureBytes / 8)); // end
+                    writer.write_be(uint16_t{ 0 });
+                    writer.write(uint8_t{ 0 });
+                    writer.write(uint8_t{ 16 }); // subdivision height
+                    writer.write_be(uint16_t{ 0 });
+                }
+                write_list_tag(writer, "ROOMTQTR", 1, counts.object_textures * PaletteBytes);
+                for (uint32_t t = 0; t < counts.object_textures; ++t)
+                {
+                    write_palette(writer, t);
+                }
+                write_list_tag(writer, "ROOMTSUB", 1, counts.object_textures * TextureBytes);
+                for (uint32_t t = 0; t < counts.object_textures; ++t)
+                {
+                    write_texture(writer, t);
+                }
+
+                std::vector<uint16_t> floor_data{ 0 };
+                write_list_tag(writer, "ROOMDATA", 0, counts.rooms);
+                for (uint32_t r = 0; r < counts.rooms; ++r)
+                {
+                    write_room(writer, counts, r, floor_data);
+                }
+
+                write_list_tag(writer, "FLORDATA", 2, static_cast<uint32_t>(floor_data.size()));
+                for (const auto value : floor_data)
+                {
+                    writer.write_be(value);
+                }
+
+                write_list_tag(writer, "CAMERAS", sizeof(tr_camera), 1);
+                write_be(writer, generate_camera(counts));
+                write_list_tag(writer, "SOUNDFX", sizeof(tr_sound_source), 0);
+                write_list_tag(writer, "BOXES", sizeof(tr_box), counts.boxes);
+                writer.write_all(std::vector<tr_box>(counts.boxes));
+
+                const auto entities = generate_entities(counts);
+                write_list_tag(writer, "ITEMDATA", sizeof(tr_entity) + 2, static_cast<uint32_t>(entities.size()));
+                for (const auto& entity : entities)
+                {
+                    writer.write_be(entity.TypeID);
+                    writer.write_be(entity.Room);
+                    writer.write_be(entity.x);
+                    writer.write_be(entity.y);
+                    writer.write_be(entity.z);
+                    writer.write_be(entity.Angle);
+                    writer.write_be(entity.Intensity1);
+                    writer.write_be(entity.Flags);
+                    writer.write(uint16_t{ 0 });
+                }
+
+                write_tag(writer, "ROOMEND");
+                return writer.take();
+            }
+
+            void write_mesh(Writer& writer, const Counts& counts, uint32_t index)
+            {
+                write_be(writer, tr_vertex{ 0, -256, 0 });
+                writer.write_be(uint16_t{ 512 });
+                writer.write_be(uint16_t{ 0 });
+                const auto vertices = mesh_vertices(index);
+                writer.write_be(static_cast<int16_t>(vertices.size()));
+                for (const auto& vertex : vertices)
+                {
+                    write_be(writer, vertex);
+                }
+                writer.write_be(static_cast<int16_t>(vertices.size()));
+                for (const auto& vertex : vertices)
+                {
+                    write_be(writer, vertex); // normals
+                }
+
+                const auto rectangles = mesh_rectangles(index, counts.object_textures);
+                writer.write_be(static_cast<uint16_t>(rectangles.size()));
+                writer.write_be(uint16_t{ 1 }); // primitive types
+                writer.write_be(MeshTexturedRectangle);
+                writer.write_be(static_cast<uint16_t>(rectangles.size()));
+                for (const auto& rectangle : rectangles)
+                {
+                    write_be(writer, rectangle, 5);
+                }
+            }
+
+            std::vector<uint8_t> generate_sad(const Counts& counts)
+            {
+                Writer writer;
+                write_header(writer, "OBJFILE");
+                write_list_tag(writer, "ANIMS", sizeof(tr_animation), 0);
+
+                const auto models = generate_models(counts, true);
+                write_list_tag(writer, "ANIBONES", 4, static_cast<uint32_t>(models.meshtree.size()));
+                for (const auto value : models.meshtree)
+                {
+                    writer.write_be(value);
+                }
+                write_list_tag(writer, "ANIMOBJ", sizeof(tr_model) + 2, static_cast<uint32_t>(models.models.size()));
+                for (const auto& model : models.models)
+                {
+                    write_be(writer, model);
+                    writer.write(uint16_t{ 0 });
+                }
+                write_list_tag(writer, "STATOBJ", sizeof(tr_staticmesh), 0);
+                write_list_tag(writer, "FRAMES", 2, static_cast<uint32_t>(models.frames.size()));
+                for (const auto value : models.frames)
+                {
+                    writer.write_be(value);
+                }
+
+                Writer mesh_writer;
+                std::vector<uint32_t> mesh_pointers;
+                for (uint32_t m = 0; m < counts.meshes; ++m)
+                {
+                    mesh_pointers.push_back(static_cast<uint32_t>(mesh_writer.size()));
+                    write_mesh(mesh_writer, counts, m);
+                }
+                write_list_tag(writer, "MESHPTRS", 4, static_cast<uint32_t>(mesh_pointers.size()));
+                for (const auto pointer : mesh_pointers)
+                {
+                    writer.write_be(pointer);
+                }
+                const auto mesh_data = mesh_writer.take();
+                write_list_tag(writer, "MESHDATA", 2, static_cast<uint32_t>(mesh_data.size() / 2));
+                writer.write_all(mesh_data);
+
+                // Each object texture is its texels followed by its palette, and a start of 1 means no texture.
+                constexpr uint32_t stride = (TextureBytes + PaletteBytes) / 8;
+                write_list_tag(writer, "OTEXTINF", 16, counts.object_textures);
+                for (uint32_t t = 0; t < counts.object_textures; ++t)
+                {
+                    writer.write_be(static_cast<uint16_t>(t * stride));
+                    for (int cut = 0; cut < 4; ++cut)
+                    {
+                        writer.write_be(uint16_t{ 1 });
+                    }
+                    writer.write_be(static_cast<uint16_t>(TextureBytes / 8));
+                    writer.write(uint8_t{ 4 }); // width in units of 8 texels
+                    writer.write(uint8_t{ 32 }); // height
+                    writer.write_be(uint16_t{ 0 });
+                }
+                write_list_tag(writer, "OTEXTDAT", 1, counts.object_textures * (TextureBytes + PaletteBytes));
+                for (uint32_t t = 0; t < counts.object_textures; ++t)
+                {
+                    write_texture(writer, t);
+                    write_palette(writer, t);
+                }
+
+                write_tag(writer, "OBJEND");
+                return writer.take();
+            }
+
+            std::vector<uint8_t> generate_spr()
+            {
+                Writer writer;
+                write_header(writer, "SPRFILE");
+                write_list_tag(writer, "SPRITDAT", 1, 0);
+                write_list_tag(writer, "SPRITINF", 16, 0);
+                write_list_tag(writer, "OBJECTS", 8, 0);
+                write_tag(writer, "SPRITEND");
+                return writer.take();
+            }
+
+            std::vector<uint8_t> generate_snd(const Counts& counts)
+            {
+                Writer writer;
+                write_header(writer, "SNDFILE");
+
+                const auto sound_map = generate_sound_map(256, counts.sounds);
+                write_list_tag(writer, "SAMPLUT", 2, static_cast<uint32_t>(sound_map.size()));
+                for (const auto value : sound_map)
+                {
+                    writer.write_be(value);
+                }
+                write_list_tag(writer, "SAMPINFS", sizeof(tr_sound_details), counts.sounds);
+                for (uint32_t s = 0; s < counts.sounds; ++s)
+                {
+                    write_be(writer, tr_sound_details{ .Sample = static_cast<uint16_t>(s), .Volume = 0x7fff, .Chance = 0, .Characteristics = 1 << 2 });
+                }
+
+                // Samples are signed 8-bit PCM. A sample of 16 bytes is treated as empty.
+                for (uint32_t s = 0; s < counts.sounds; ++s)
+                {
+                    const uint32_t size = 256 + (s % 16) * 64;
+                    write_tag(writer, "SAMPLE");
+                    writer.write_be(s);
+                    writer.write_be(size);
+                    writer.write_all(std::vector<uint8_t>(size));
+                }
+
+                write_tag(writer, "ENDFILE");
+                return writer.take();
+            }
+        }
+
+        SyntheticLevel generate_tr1_saturn(const Counts& counts)
+        {
+            return
+            {
+                .filename = "LEVEL.SAT",
+                .level = generate_sat(counts),
+                .files =
+                {
+                    { "LEVEL.SAD", generate_sad(counts) },
+                    { "LEVEL.SPR", generate_spr() },
+                    { "LEVEL.SND", generate_snd(counts) }
+                }
+            };
+        }
+    }
+}
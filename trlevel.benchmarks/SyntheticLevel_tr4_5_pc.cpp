@@ -0,0 +1,356 @@
+#include "SyntheticLevel_common.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include <external/zlib/zlib.h>
+
+namespace trlevel
+{
+    namespace synthetic
+    {
+        namespace
+        {
+            constexpr uint32_t Tomb4Version = 0x00345254;
+
+            void write_compressed(Writer& writer, const std::vector<uint8_t>& data)
+            {
+                uLongf compressed_size = compressBound(static_cast<uLong>(data.size()));
+                std::vector<uint8_t> compressed(compressed_size);
+                if (compress(compressed.data(), &compressed_size, data.data(), static_cast<uLong>(data.size())) != Z_OK)
+                {
+                    throw std::runtime_error("Failed to compress synthetic level data");
+                }
+                compressed.resize(compressed_size);
+                writer.write(static_cast<uint32_t>(data.size()));
+                writer.write(static_cast<uint32_t>(compressed.size()));
+                writer.write_all(compressed);
+            }
+
+            // Texels are never blank so that the 32-bit textiles are used rather than the 16-bit textiles.
+            std::vector<uint8_t> textile32_data(uint32_t textiles)
+            {
+                Writer writer;
+                std::vector<uint32_t> textile(256 * 256);
+                for (uint32_t t = 0; t < textiles; ++t)
+                {
+                    for (uint32_t i = 0; i < textile.size(); ++i)
+                    {
+                        textile[i] = 0xff000000 | ((i + t) % 0xffffff + 1);
+                    }
+                    writer.write_all(textile);
+                }
+                return writer.take();
+            }
+
+            std::vector<uint8_t> textile16_data(uint32_t textiles)
+            {
+                Writer writer;
+                std::vector<uint16_t> textile(256 * 256);
+                for (uint32_t t = 0; t < textiles; ++t)
+                {
+                    for (uint32_t i = 0; i < textile.size(); ++i)
+                    {
+                        textile[i] = static_cast<uint16_t>(0x8000 | ((i + t) % 0x7fff + 1));
+                    }
+                    writer.write_all(textile);
+                }
+                return writer.take();
+            }
+
+            void write_tr4_room(Writer& writer, const Counts& counts, uint32_t index, std::vector<uint16_t>& floor_data)
+            {
+                writer.write(room_info(counts, index));
+
+                const auto data_words_at = writer.size();
+                writer.write(uint32_t{ 0 });
+                const auto data_start = writer.size();
+
+                const auto vertices = room_vertices(counts);
+                writer.write(static_cast<int16_t>(vertices.size()));
+                for (const auto& vertex : vertices)
+                {
+                    writer.write(tr3_room_vertex{ .vertex = vertex, .lighting = 4096, .attributes = 0, .colour = 0x7fff });
+                }
+                writer.write_vector<int16_t>(room_rectangles(counts));
+                writer.write(int16_t{ 0 }); // triangles
+                writer.write(int16_t{ 0 }); // sprites
+                writer.patch(data_words_at, static_cast<uint32_t>((writer.size() - data_start) / 2));
+
+                writer.write(uint16_t{ 0 }); // portals
+                writer.write(counts.room_size);
+                writer.write(counts.room_size);
+                for (uint32_t s = 0; s < static_cast<uint32_t>(counts.room_size) * counts.room_size; ++s)
+                {
+                    writer.write(room_sector(counts, index, add_floordata(floor_data, counts, s)));
+                }
+
+                writer.write(uint32_t{ 0xff808080 }); // colour
+                writer.write(uint16_t{ 1 });
+                writer.write(tr4_room_light{});
+                writer.write(uint16_t{ 0 }); // static meshes
+                writer.write(int16_t{ -1 }); // alternate room
+                writer.write(int16_t{ 0 }); // flags
+                writer.write(uint8_t{ 0 }); // water scheme
+                writer.write(uint8_t{ 0 }); // reverb info
+                writer.write(uint8_t{ 0 }); // alternate group
+            }
+
+            // Tomb5 rooms are a header followed by blocks of data at offsets measured from the end of the header,
+            // with the geometry split into layers of floating point vertices.
+            void write_tr5_room(Writer& writer, const Counts& counts, uint32_t index, std::vector<uint16_t>& floor_data)
+            {
+                writer.write_text("XELA");
+                const auto room_data_size_at = writer.size();
+                writer.write(uint32_t{ 0 });
+                const auto room_start = writer.size();
+
+                const auto info = room_info(counts, index);
+                tr5_room_header header{};
+                header.info = { .x = info.x, .y = 0, .z = info.z, .yBottom = info.yBottom, .yTop = info.yTop };
+                header.num_z_sectors = counts.room_size;
+                header.num_x_sectors = counts.room_size;
+                header.colour = 0xff808080;
+                header.num_lights = 1;
+                header.alternate_room = 0xffff;
+                header.room_x = static_cast<float>(info.x);
+                header.room_z = static_cast<float>(info.z);
+                header.room_y_top = static_cast<float>(info.yTop);
+                header.room_y_bottom = static_cast<float>(info.yBottom);
+                header.num_layers = 1;
+
+                const auto header_at = writer.size();
+                writer.write(header);
+                const auto data_start = writer.size();
+                const auto offset = [&]() { return static_cast<uint32_t>(writer.size() - data_start); };
+
+                writer.write(tr5_room_light{});
+
+                header.start_sd_offset = offset();
+                for (uint32_t s = 0; s < static_cast<uint32_t>(counts.room_size) * counts.room_size; ++s)
+                {
+                    writer.write(room_sector(counts, index, add_floordata(floor_data, counts, s)));
+                }
+                header.end_sd_offset = offset();
+                writer.write(uint16_t{ 0 }); // portals
+                writer.write(uint16_t{ 0xcdcd }); // separator
+                header.end_portal_offset = offset();
+
+                const auto vertices = room_vertices(counts);
+                const auto rectangles = room_rectangles(counts);
+                header.layer_offset = offset();
+                writer.write(tr5_room_layer
+                    {
+                        .num_vertices = static_cast<uint16_t>(vertices.size()),
+                        .num_rectangles = static_cast<uint16_t>(rectangles.size()),
+                        .num_triangles = 0,
+                        .bounding_box_min = { 0, static_cast<float>(info.yTop), 0 },
+                        .bounding_box_max = { counts.room_size * 1024.0f, static_cast<float>(info.yBottom), counts.room_size * 1024.0f }
+                    });
+
+                header.poly_offset = offset();
+                header.poly_offset2 = header.poly_offset;
+                for (const auto& rectangle : rectangles)
+                {
+                    writer.write(tr4_mesh_face4{ .vertices = { rectangle.vertices[0], rectangle.vertices[1], rectangle.vertices[2], rectangle.vertices[3] }, .texture = rectangle.texture, .effects = 0 });
+                }
+                header.num_room_rectangles = static_cast<uint32_t>(rectangles.size());
+
+                header.vertices_offset = offset();
+                for (const auto& vertex : vertices)
+                {
+                    writer.write(tr5_room_vertex
+                        {
+                            .vertex = { static_cast<float>(vertex.x), static_cast<float>(vertex.y), static_cast<float>(vertex.z) },
+                            .normal = { 0, -1, 0 },
+                            .colour = 0xff808080
+                        });
+                }
+                header.vertices_size = offset() - header.vertices_offset;
+
+                writer.patch(header_at, header);
+                writer.patch(room_data_size_at, static_cast<uint32_t>(writer.size() - room_start));
+            }
+
+            void write_mesh(Writer& writer, const Counts& counts, uint32_t index)
+            {
+                writer.write(tr_vertex{ 0, -256, 0 });
+                writer.write(int32_t{ 512 });
+                const auto vertices = mesh_vertices(index);
+                writer.write_vector<int16_t>(vertices);
+                writer.write_vector<int16_t>(vertices); // normals
+                const auto rectangles = mesh_rectangles(index, counts.object_textures);
+                writer.write(static_cast<int16_t>(rectangles.size()));
+                for (const auto& rectangle : rectangles)
+                {
+                    writer.write(tr4_mesh_face4{ .vertices = { rectangle.vertices[0], rectangle.vertices[1], rectangle.vertices[2], rectangle.vertices[3] }, .texture = rectangle.texture, .effects = 0 });
+                }
+                writer.write(int16_t{ 0 }); // triangles
+            }
+
+            // Everything from the unused value through to the sample indices, which Tomb4 compresses and Tomb5 doesn't.
+            std::vector<uint8_t> level_data(LevelVersion version, const Counts& counts)
+            {
+                const bool tomb5 = version == LevelVersion::Tomb5;
+
+                Writer writer;
+                writer.write(uint32_t{ 0 }); // unused
+
+                std::vector<uint16_t> floor_data{ 0 };
+                if (tomb5)
+                {
+                    writer.write(counts.rooms);
+                }
+                else
+                {
+                    writer.write(static_cast<uint16_t>(counts.rooms));
+                }
+                for (uint32_t r = 0; r < counts.rooms; ++r)
+                {
+                    if (tomb5)
+                    {
+                        write_tr5_room(writer, counts, r, floor_data);
+                    }
+                    else
+                    {
+                        write_tr4_room(writer, counts, r, floor_data);
+                    }
+                }
+                writer.write_vector<uint32_t>(floor_data);
+
+                Writer mesh_writer;
+                std::vector<uint32_t> mesh_pointers;
+                for (uint32_t m = 0; m < counts.meshes; ++m)
+                {
+                    mesh_pointers.push_back(static_cast<uint32_t>(mesh_writer.size()));
+                    write_mesh(mesh_writer, counts, m);
+                }
+                const auto mesh_data = mesh_writer.take();
+                writer.write(static_cast<uint32_t>(mesh_data.size() / 2));
+                writer.write_all(mesh_data);
+                writer.write_vector<uint32_t>(mesh_pointers);
+
+                writer.write(uint32_t{ 0 }); // animations
+                writer.write(uint32_t{ 0 }); // state changes
+                writer.write(uint32_t{ 0 }); // anim dispatches
+                writer.write(uint32_t{ 0 }); // anim commands
+
+                const auto models = generate_models(counts, false);
+                writer.write_vector<uint32_t>(models.meshtree);
+                writer.write_vector<uint32_t>(models.frames);
+                writer.write(static_cast<uint32_t>(models.models.size()));
+                for (const auto& model : models.models)
+                {
+                    if (tomb5)
+                    {
+                        writer.write(tr5_model{ .model = model, .filler = 0 });
+                    }
+                    else
+                    {
+                        writer.write(model);
+                    }
+                }
+                writer.write(uint32_t{ 0 }); // static meshes
+
+                writer.write_text(tomb5 ? std::string_view("SPR\0", 4) : std::string_view("SPR"));
+                writer.write(uint32_t{ 0 }); // sprite textures
+                writer.write(uint32_t{ 0 }); // sprite sequences
+                writer.write_vector<uint32_t>(std::vector<tr_camera>{ generate_camera(counts) });
+                writer.write(uint32_t{ 0 }); // flyby cameras
+                writer.write(uint32_t{ 0 }); // sound sources
+
+                writer.write(counts.boxes);
+                writer.write_all(std::vector<tr2_box>(counts.boxes));
+                writer.write(uint32_t{ 0 }); // overlaps
+                writer.write_all(std::vector<int16_t>(counts.boxes * 10));
+                writer.write_vector<uint32_t>(std::vector<uint16_t>{ 0 }); // animated textures
+                writer.write(uint8_t{ 0 }); // animated textures uv count
+
+                writer.write_text(tomb5 ? std::string_view("TEX\0", 4) : std::string_view("TEX"));
+                const auto object_textures = generate_object_textures(counts);
+                writer.write(static_cast<uint32_t>(object_textures.size()));
+                for (const auto& texture : object_textures)
+                {
+                    tr4_object_texture tr4_texture
+                    {
+                        .Attribute = texture.Attribute,
+                        .TileAndFlag = texture.TileAndFlag,
+                        .NewFlags = 0,
+                        .OriginalU = texture.Vertices[0].x_whole,
+                        .OriginalV = texture.Vertices[0].y_whole,
+                        .Width = 63,
+                        .Height = 63
+                    };
+                    std::memcpy(tr4_texture.Vertices, texture.Vertices, sizeof(tr4_texture.Vertices));
+                    if (tomb5)
+                    {
+                        writer.write(tr5_object_texture{ .tr4_texture = tr4_texture, .filler = 0 });
+                    }
+                    else
+                    {
+                        writer.write(tr4_texture);
+                    }
+                }
+
+                writer.write_vector<uint32_t>(generate_entities(counts));
+                writer.write(uint32_t{ 0 }); // ai objects
+                writer.write(uint16_t{ 0 }); // demo data
+
+                writer.write_all(generate_sound_map(tomb5 ? 450 : 370, counts.sounds));
+                writer.write(counts.sounds);
+                std::vector<uint32_t> sample_indices;
+                for (uint32_t s = 0; s < counts.sounds; ++s)
+                {
+                    writer.write(tr_sound_details{ .Sample = static_cast<uint16_t>(s), .Volume = 0x7fff, .Chance = 0, .Characteristics = 1 << 2 });
+                    sample_indices.push_back(s);
+                }
+                writer.write_vector<uint32_t>(sample_indices);
+                return writer.take();
+            }
+        }
+
+        SyntheticLevel generate_tr4_5_pc(LevelVersion version, const Counts& counts)
+        {
+            if (version != LevelVersion::Tomb4 && version != LevelVersion::Tomb5)
+            {
+                throw std::invalid_argument("Synthetic PC levels can only be generated for Tomb4 and Tomb5 here");
+            }
+
+            Writer writer;
+            writer.write(Tomb4Version);
+            writer.write(static_cast<uint16_t>(counts.textiles)); // room textiles
+            writer.write(uint16_t{ 0 }); // object textiles
+            writer.write(uint16_t{ 0 }); // bump textiles
+            write_compressed(writer, textile32_data(counts.textiles));
+            write_compressed(writer, textile16_data(counts.textiles));
+            write_compressed(writer, textile32_data(2));
+
+            const auto data = level_data(version, counts);
+            if (version == LevelVersion::Tomb4)
+            {
+                write_compressed(writer, data);
+            }
+            else
+            {
+                writer.write(uint16_t{ 0 }); // lara type
+                writer.write(uint16_t{ 0 }); // weather type
+                writer.write_all(std::vector<uint8_t>(28));
+                writer.write(static_cast<uint32_t>(data.size()));
+                writer.write(static_cast<uint32_t>(data.size()));
+                writer.write_all(data);
+            }
+
+            writer.write(counts.sounds);
+            for (uint32_t s = 0; s < counts.sounds; ++s)
+            {
+                const auto sample = generate_sample(s);
+                writer.write(static_cast<uint32_t>(sample.size()));
+                writer.write(static_cast<uint32_t>(sample.size()));
+                writer.write_all(sample);
+            }
+
+            // Tomb5 is told apart from Tomb4 by the extension.
+            return { .filename = version == LevelVersion::Tomb4 ? "level.tr4" : "level.trc", .level = writer.take() };
+        }
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#define NOMINMAX
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
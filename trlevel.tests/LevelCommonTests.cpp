@@ -0,0 +1,107 @@
+#include <trlevel/Level_common.h>
+#include <trview.common/Logs/Log.h>
+
+#include <atomic>
+
+using namespace trlevel;
+
+TEST(LevelCommon, ReadVectorCopiesElements)
+{
+    const std::vector<uint8_t> data{ 3, 0, 1, 0, 2, 0, 3, 0, 9 };
+    std::basic_ispanstream<uint8_t> file{ std::span(data) };
+    file.exceptions(std::ios::failbit);
+
+    const auto values = read_vector<uint16_t, uint16_t>(file);
+    ASSERT_EQ(values, (std::vector<uint16_t>{ 1, 2, 3 }));
+    ASSERT_EQ(file.tellg(), 8);
+    ASSERT_EQ(read<uint8_t>(file), 9);
+}
+
+TEST(LevelCommon, ReadVectorPastEndFails)
+{
+    const std::vector<uint8_t> data{ 4, 0, 0, 0, 1, 0, 0, 0 };
+    std::basic_ispanstream<uint8_t> file{ std::span(data) };
+    file.exceptions(std::ios::failbit);
+
+    ASSERT_THROW((read_vector<uint32_t, uint32_t>(file)), std::ios::failure);
+}
+
+TEST(LevelCommon, ReadVectorEmpty)
+{
+    const std::vector<uint8_t> data{ 0, 0, 0, 0 };
+    std::basic_ispanstream<uint8_t> file{ std::span(data) };
+    file.exceptions(std::ios::failbit);
+
+    ASSERT_TRUE((read_vector<uint32_t, tr_vertex>(file)).empty());
+    ASSERT_EQ(file.tellg(), 4);
+}
+
+namespace
+{
+    /// Rooms that are a byte count followed by that many bytes, each the room number.
+    std::vector<uint8_t> generate_rooms(uint16_t num_rooms)
+    {
+        std::vector<uint8_t> data{ static_cast<uint8_t>(num_rooms & 0xff), static_cast<uint8_t>(num_rooms >> 8) };
+        for (uint16_t i = 0; i < num_rooms; ++i)
+        {
+            const uint8_t length = static_cast<uint8_t>(i % 3 + 1);
+            data.push_back(length);
+            data.insert(data.end(), length, static_cast<uint8_t>(i));
+        }
+        return data;
+    }
+
+    void load_room(std::basic_ispanstream<uint8_t>& file, tr3_room& room)
+    {
+        const auto length = read<uint8_t>(file);
+        room.info.x = length;
+        room.info.z = read<uint8_t>(file);
+        skip(file, length - 1u);
+    }
+}
+
+TEST(LevelCommon, ReadRoomsInParallelDecodesEachRoomOnce)
+{
+    const auto data = generate_rooms(64);
+    std::basic_ispanstream<uint8_t> file{ std::span(data) };
+    file.exceptions(std::ios::failbit);
+    trview::Activity activity(std::make_shared<trview::Log>(), "IO", "Test");
+
+    std::atomic<uint32_t> loads{ 0 };
+    const auto rooms = read_rooms<uint16_t>(activity, file, { .parallel_rooms = true },
+        [&](auto&&, auto& room_file, auto& room)
+        {
+            ++loads;
+            load_room(room_file, room);
+        },
+        [](auto& room_file) { skip(room_file, read<uint8_t>(room_file)); });
+
+    ASSERT_EQ(loads, 64u);
+    ASSERT_EQ(rooms.size(), 64u);
+    for (uint32_t i = 0; i < rooms.size(); ++i)
+    {
+        ASSERT_EQ(rooms[i].info.x, static_cast<int32_t>(i % 3 + 1));
+        ASSERT_EQ(rooms[i].info.z, static_cast<int32_t>(i));
+    }
+    ASSERT_EQ(file.tellg(), static_cast<std::streamoff>(data.size()));
+}
+
+TEST(LevelCommon, ReadRoomsInParallelFallsBackWhenScanDisagrees)
+{
+    const auto data = generate_rooms(64);
+    std::basic_ispanstream<uint8_t> file{ std::span(data) };
+    file.exceptions(std::ios::failbit);
+    trview::Activity activity(std::make_shared<trview::Log>(), "IO", "Test");
+
+    const auto rooms = read_rooms<uint16_t>(activity, file, { .parallel_rooms = true },
+        [&](auto&&, auto& room_file, auto& room) { load_room(room_file, room); },
+        [](auto& room_file) { skip(room_file, read<uint8_t>(room_file) + 1u); });
+
+    ASSERT_EQ(rooms.size(), 64u);
+    for (uint32_t i = 0; i < rooms.size(); ++i)
+    {
+        ASSERT_EQ(rooms[i].info.x, static_cast<int32_t>(i % 3 + 1));
+        ASSERT_EQ(rooms[i].info.z, static_cast<int32_t>(i));
+    }
+    ASSERT_EQ(file.tellg(), static_cast<std::streamoff>(data.size()));
+}
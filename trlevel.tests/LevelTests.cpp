@@ -0,0 +1,160 @@
+#include <trlevel/Level.h>
+#include <trlevel/Decrypter.h>
+#include <trview.common/Logs/Log.h>
+#include <trview.common/Mocks/IFiles.h>
+#include <trview.common/Resources.h>
+#include "resource.h"
+#include <cstring>
+
+using namespace trlevel;
+using namespace trview;
+using namespace trview::mocks;
+using testing::NiceMock;
+using testing::Return;
+
+namespace
+{
+    std::vector<uint8_t> get_resource(int id)
+    {
+        auto resource = trview::get_resource_memory(id, L"FILE");
+        return std::vector<uint8_t>(resource.data, resource.data + resource.size);
+    }
+
+    std::shared_ptr<Level> load_level(int id, const std::string& filename, const std::shared_ptr<ILog>& log, const ILevel::LoadCallbacks& callbacks)
+    {
+        const auto bytes = get_resource(id);
+        auto mapped = std::make_shared<NiceMock<MockMappedFile>>();
+        ON_CALL(*mapped, data).WillByDefault(Return(std::span<const uint8_t>(bytes)));
+        auto files = std::make_shared<NiceMock<MockFiles>>();
+        ON_CALL(*files, map_file(filename)).WillByDefault(Return(mapped));
+        auto level = std::make_shared<Level>(filename, nullptr, files, std::make_shared<Decrypter>(), log);
+        level->load(callbacks);
+        return level;
+    }
+
+    /// Compare packed level structures byte by byte.
+    template <typename T>
+    bool same_bytes(const std::vector<T>& left, const std::vector<T>& right)
+    {
+        return left.size() == right.size() &&
+            (left.empty() || std::memcmp(left.data(), right.data(), left.size() * sizeof(T)) == 0);
+    }
+
+    template <typename T>
+    bool same_bytes(const T& left, const T& right)
+    {
+        return std::memcmp(&left, &right, sizeof(T)) == 0;
+    }
+
+    bool same_light(const tr_x_room_light& left, const tr_x_room_light& right)
+    {
+        if (left.level_version != right.level_version)
+        {
+            return false;
+        }
+
+        switch (left.level_version)
+        {
+            case LevelVersion::Tomb1:
+                return same_bytes(left.tr1, right.tr1);
+            case LevelVersion::Tomb2:
+                return same_bytes(left.tr2, right.tr2);
+            case LevelVersion::Tomb3:
+                return same_bytes(left.tr3, right.tr3);
+            case LevelVersion::Tomb4:
+                return same_bytes(left.tr4, right.tr4);
+            default:
+                return same_bytes(left.tr5, right.tr5) && same_bytes(left.tr5_fog, right.tr5_fog);
+        }
+    }
+
+    void assert_same_room(const tr3_room& expected, const tr3_room& actual)
+    {
+        ASSERT_EQ(actual.info.x, expected.info.x);
+        ASSERT_EQ(actual.info.y, expected.info.y);
+        ASSERT_EQ(actual.info.z, expected.info.z);
+        ASSERT_EQ(actual.info.yBottom, expected.info.yBottom);
+        ASSERT_EQ(actual.info.yTop, expected.info.yTop);
+
+        ASSERT_EQ(actual.data.vertices.size(), expected.data.vertices.size());
+        for (auto i = 0u; i < expected.data.vertices.size(); ++i)
+        {
+            const auto& e = expected.data.vertices[i];
+            const auto& a = actual.data.vertices[i];
+            ASSERT_TRUE(same_bytes(a.vertex, e.vertex));
+            ASSERT_EQ(a.lighting, e.lighting);
+            ASSERT_EQ(a.attributes, e.attributes);
+            ASSERT_EQ(a.colour, e.colour);
+        }
+        ASSERT_TRUE(same_bytes(actual.data.rectangles, expected.data.rectangles));
+        ASSERT_TRUE(same_bytes(actual.data.triangles, expected.data.triangles));
+        ASSERT_TRUE(same_bytes(actual.data.sprites, expected.data.sprites));
+        ASSERT_TRUE(same_bytes(actual.portals, expected.portals));
+
+        ASSERT_EQ(actual.num_z_sectors, expected.num_z_sectors);
+        ASSERT_EQ(actual.num_x_sectors, expected.num_x_sectors);
+        ASSERT_TRUE(same_bytes(actual.sector_list, expected.sector_list));
+
+        ASSERT_EQ(actual.colour, expected.colour);
+        ASSERT_EQ(actual.ambient_intensity_1, expected.ambient_intensity_1);
+        ASSERT_EQ(actual.ambient_intensity_2, expected.ambient_intensity_2);
+        ASSERT_EQ(actual.light_mode, expected.light_mode);
+
+        ASSERT_EQ(actual.lights.size(), expected.lights.size());
+        for (auto i = 0u; i < expected.lights.size(); ++i)
+        {
+            ASSERT_TRUE(same_light(actual.lights[i], expected.lights[i]));
+        }
+
+        ASSERT_TRUE(same_bytes(actual.static_meshes, expected.static_meshes));
+        ASSERT_EQ(actual.alternate_room, expected.alternate_room);
+        ASSERT_EQ(actual.flags, expected.flags);
+        ASSERT_EQ(actual.water_scheme, expected.water_scheme);
+        ASSERT_EQ(actual.reverb_info, expected.reverb_info);
+        ASSERT_EQ(actual.alternate_group, expected.alternate_group);
+    }
+}
+
+TEST(Level, ParallelRoomsMatchSerialRooms)
+{
+    const auto serial = load_level(IDR_ORIGINAL_LAKE, "lake.trc", std::make_shared<Log>(), {});
+
+    // Falling back to the serial path would read the rooms a second time.
+    uint32_t room_reads = 0;
+    const auto parallel = load_level(IDR_ORIGINAL_LAKE, "lake.trc", std::make_shared<Log>(),
+        {
+            .on_progress_callback = [&](const std::string& message)
+            {
+                if (message.starts_with("Reading") && message.ends_with("rooms"))
+                {
+                    ++room_reads;
+                }
+            },
+            .parallel_rooms = true
+        });
+    ASSERT_EQ(room_reads, 1u);
+
+    ASSERT_NE(serial->num_rooms(), 0u);
+    ASSERT_EQ(parallel->num_rooms(), serial->num_rooms());
+    for (auto i = 0u; i < serial->num_rooms(); ++i)
+    {
+        SCOPED_TRACE(std::format("Room {}", i));
+        assert_same_room(serial->get_room(i), parallel->get_room(i));
+    }
+
+    ASSERT_EQ(parallel->num_entities(), serial->num_entities());
+    ASSERT_TRUE(std::ranges::equal(parallel->get_floor_data_all(), serial->get_floor_data_all()));
+}
+
+TEST(Level, LookupsGeneratedAfterLevelRead)
+{
+    std::vector<std::string> messages;
+    const auto level = load_level(IDR_ORIGINAL_LAKE, "lake.trc", std::make_shared<Log>(),
+        {
+            .on_progress_callback = [&](const std::string& message) { messages.push_back(message); }
+        });
+
+    ASSERT_GE(messages.size(), 2u);
+    ASSERT_EQ(messages[messages.size() - 2], "Generating lookups");
+    ASSERT_EQ(messages.back(), "Loading complete");
+}
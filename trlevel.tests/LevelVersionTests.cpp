@@ -0,0 +1,78 @@
+#include <trlevel/LevelVersion.h>
+#include <trlevel/trtypes.h>
+#include <bit>
+#include <cstring>
+
+using namespace trlevel;
+
+namespace
+{
+    void write_int32(std::vector<uint8_t>& data, std::size_t offset, int32_t value)
+    {
+        if (data.size() < offset + sizeof(value))
+        {
+            data.resize(offset + sizeof(value));
+        }
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+    }
+}
+
+TEST(LevelVersion, DetectsVersionAtStart)
+{
+    std::vector<uint8_t> data;
+    write_int32(data, 0, 0x2D);
+    const auto version = detect_level_version(data);
+    ASSERT_EQ(version.platform, Platform::PC);
+    ASSERT_EQ(version.version, LevelVersion::Tomb2);
+    ASSERT_EQ(version.raw_version, 0x2D);
+}
+
+TEST(LevelVersion, DetectsVersionAfterTextiles)
+{
+    std::vector<uint8_t> data;
+    write_int32(data, sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024, 27);
+    const auto version = detect_level_version(data);
+    ASSERT_EQ(version.platform, Platform::PSX);
+    ASSERT_EQ(version.version, LevelVersion::Tomb1);
+    ASSERT_EQ(version.raw_version, 27);
+}
+
+TEST(LevelVersion, DetectsVersionAfterSounds)
+{
+    std::vector<uint8_t> data;
+    write_int32(data, 0, 8);
+    write_int32(data, 12, 16);
+    write_int32(data, 32, 44);
+    const auto version = detect_level_version(data);
+    ASSERT_EQ(version.platform, Platform::PSX);
+    ASSERT_EQ(version.version, LevelVersion::Tomb2);
+    ASSERT_EQ(version.raw_version, 44);
+}
+
+TEST(LevelVersion, DetectsSaturnRoomFile)
+{
+    std::vector<uint8_t> data(8);
+    std::memcpy(data.data(), "ROOMFILE", 8);
+    write_int32(data, 12, std::byteswap(int32_t{ 1 }));
+    const auto version = detect_level_version(data);
+    ASSERT_EQ(version.platform, Platform::Saturn);
+    ASSERT_EQ(version.version, LevelVersion::Tomb1);
+    ASSERT_EQ(version.raw_version, 1);
+}
+
+TEST(LevelVersion, SignaturesBeyondPrefixNotMatched)
+{
+    std::vector<uint8_t> data;
+    write_int32(data, 0, 0x20);
+    write_int32(data, 0x7000, 0x7fffffff);
+    const auto prefix = std::span<const uint8_t>(data).subspan(0, 0x7000);
+    const auto version = detect_level_version(prefix);
+    ASSERT_EQ(version.platform, Platform::PC);
+    ASSERT_EQ(version.version, LevelVersion::Tomb1);
+}
+
+TEST(LevelVersion, EmptyDataIsUnknown)
+{
+    const auto version = detect_level_version({});
+    ASSERT_EQ(version.version, LevelVersion::Unknown);
+}
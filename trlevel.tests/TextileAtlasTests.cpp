@@ -0,0 +1,114 @@
+#include <trlevel/TextileAtlas.h>
+#include <algorithm>
+
+using namespace trlevel;
+
+namespace
+{
+    tr_object_texture_psx texture(uint16_t tile, uint16_t clut, uint8_t x, uint8_t y, uint8_t size)
+    {
+        const uint8_t right = static_cast<uint8_t>(x + size - 1);
+        const uint8_t bottom = static_cast<uint8_t>(y + size - 1);
+        return
+        {
+            .x0 = x, .y0 = y, .Clut = clut, .x1 = right, .y1 = y, .Tile = tile,
+            .x2 = x, .y2 = bottom, .x3 = right, .y3 = bottom
+        };
+    }
+
+    struct Source
+    {
+        uint32_t rows{ 0 };
+
+        TextileAtlas::RowSource function()
+        {
+            return [this](uint16_t, uint16_t clut, uint32_t, uint32_t, std::span<uint16_t> output)
+                {
+                    ++rows;
+                    std::ranges::fill(output, clut);
+                };
+        }
+    };
+}
+
+TEST(TextileAtlas, OverlappingRegionsExpandedOnce)
+{
+    const std::vector<tr_object_texture_psx> textures{ texture(3, 1, 10, 10, 16), texture(3, 1, 20, 20, 16) };
+    std::vector<tr_textile16> textiles;
+    Source source;
+
+    TextileAtlas atlas;
+    atlas.add(textures);
+    atlas.pack(textiles, source.function());
+
+    ASSERT_EQ(textiles.size(), 1u);
+    // 10 to 35 with one pixel either side.
+    ASSERT_EQ(source.rows, 28u);
+
+    const auto first = atlas.place(textures[0]);
+    const auto second = atlas.place(textures[1]);
+    ASSERT_EQ(first.Tile, 0u);
+    ASSERT_EQ(second.Tile, 0u);
+    ASSERT_EQ(first.x0, 1u);
+    ASSERT_EQ(first.y0, 1u);
+    ASSERT_EQ(second.x0, 11u);
+    ASSERT_EQ(second.y3, 26u);
+    ASSERT_EQ(first.Clut, 1u);
+}
+
+TEST(TextileAtlas, EachClutExpandedSeparately)
+{
+    const std::vector<tr_object_texture_psx> textures{ texture(0, 5, 64, 64, 32), texture(0, 7, 64, 64, 32) };
+    std::vector<tr_textile16> textiles;
+    Source source;
+
+    TextileAtlas atlas;
+    atlas.add(textures);
+    atlas.pack(textiles, source.function());
+
+    const auto first = atlas.place(textures[0]);
+    const auto second = atlas.place(textures[1]);
+    ASSERT_NE(first.x0, second.x0);
+    ASSERT_EQ(textiles[first.Tile].Tile[first.y0 * 256 + first.x0], 5u);
+    ASSERT_EQ(textiles[second.Tile].Tile[second.y0 * 256 + second.x0], 7u);
+}
+
+TEST(TextileAtlas, PackedRegionsReused)
+{
+    std::vector<tr_textile16> textiles;
+    Source source;
+
+    TextileAtlas atlas;
+    atlas.add(std::vector<tr_object_texture_psx>{ texture(1, 1, 0, 0, 64) });
+    atlas.pack(textiles, source.function());
+    const auto rows = source.rows;
+
+    const tr_sprite_texture_psx sprite{ .Clut = 1, .Tile = 1, .u0 = 8, .v0 = 8, .u1 = 24, .v1 = 24 };
+    atlas.add(std::vector<tr_sprite_texture_psx>{ sprite });
+    atlas.pack(textiles, source.function());
+
+    ASSERT_EQ(source.rows, rows);
+    const auto placed = atlas.place(sprite);
+    ASSERT_EQ(placed.Tile, 0u);
+    ASSERT_EQ(placed.u0, 8u);
+    ASSERT_EQ(placed.v1, 24u);
+}
+
+TEST(TextileAtlas, FullTextilesStartNewTextile)
+{
+    std::vector<tr_object_texture_psx> textures;
+    for (uint16_t clut = 0; clut < 5; ++clut)
+    {
+        textures.push_back(texture(0, clut, 0, 0, 128));
+    }
+    std::vector<tr_textile16> textiles;
+    Source source;
+
+    TextileAtlas atlas;
+    atlas.add(textures);
+    atlas.pack(textiles, source.function());
+
+    // 129x129 regions fit one per textile.
+    ASSERT_EQ(textiles.size(), 5u);
+    ASSERT_EQ(atlas.place(textures[4]).Tile, 4u);
+}
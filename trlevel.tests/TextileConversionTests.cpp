@@ -0,0 +1,99 @@
+#include <trlevel/TextileConversion.h>
+#include <cstring>
+#include <random>
+
+using namespace trlevel;
+
+namespace
+{
+    // The conversion that PSX textiles used before the bulk functions.
+    uint16_t expected_texel4(std::span<const tr_colorindex4> input, uint32_t texel, const tr_clut& clut)
+    {
+        const tr_colorindex4& index = input[texel / 2];
+        const tr_rgba5551& colour = clut.Colour[(texel % 2) ? index.b : index.a];
+        return static_cast<uint16_t>((colour.Alpha << 15) | (colour.Red << 10) | (colour.Green << 5) | colour.Blue);
+    }
+
+    template <typename T>
+    std::vector<T> random_values(std::size_t count)
+    {
+        std::mt19937 random(1234);
+        std::vector<T> values(count);
+        for (auto& value : values)
+        {
+            value = static_cast<T>(random());
+        }
+        return values;
+    }
+}
+
+TEST(TextileConversion, Textile16MatchesScalarForEveryValue)
+{
+    std::vector<uint16_t> input(65536);
+    for (uint32_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint16_t>(i);
+    }
+
+    std::vector<uint32_t> output(input.size());
+    std::vector<uint32_t> scalar_output(input.size());
+    convert_textile16(input, output);
+    scalar::convert_textile16(input, scalar_output);
+    for (uint32_t i = 0; i < input.size(); ++i)
+    {
+        ASSERT_EQ(output[i], convert_textile16(input[i])) << i;
+        ASSERT_EQ(scalar_output[i], convert_textile16(input[i])) << i;
+    }
+}
+
+TEST(TextileConversion, Textile16HandlesPartialBlocks)
+{
+    const auto input = random_values<uint16_t>(37);
+    std::vector<uint32_t> output(input.size());
+    convert_textile16(input, output);
+    for (uint32_t i = 0; i < input.size(); ++i)
+    {
+        ASSERT_EQ(output[i], convert_textile16(input[i])) << i;
+    }
+}
+
+TEST(TextileConversion, Textile32MatchesScalar)
+{
+    const auto input = random_values<uint32_t>(1027);
+    std::vector<uint32_t> output(input.size());
+    std::vector<uint32_t> scalar_output(input.size());
+    convert_textile32(input, output);
+    scalar::convert_textile32(input, scalar_output);
+    for (uint32_t i = 0; i < input.size(); ++i)
+    {
+        ASSERT_EQ(output[i], convert_textile32(input[i])) << i;
+        ASSERT_EQ(scalar_output[i], convert_textile32(input[i])) << i;
+    }
+}
+
+TEST(TextileConversion, Textile4MatchesScalar)
+{
+    const auto bytes = random_values<uint8_t>(256);
+    std::vector<tr_colorindex4> input(bytes.size());
+    std::memcpy(input.data(), bytes.data(), bytes.size());
+
+    const auto colours = random_values<uint16_t>(16);
+    tr_clut clut;
+    std::memcpy(clut.Colour, colours.data(), sizeof(clut.Colour));
+
+    for (const uint32_t start : { 0u, 1u, 30u, 33u })
+    {
+        for (const std::size_t count : { 1u, 31u, 32u, 65u, 200u })
+        {
+            std::vector<uint16_t> output(count);
+            std::vector<uint16_t> scalar_output(count);
+            expand_textile4(input, start, clut, output);
+            scalar::expand_textile4(input, start, clut, scalar_output);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(output[i], expected_texel4(input, start + i, clut)) << start << " " << count << " " << i;
+                ASSERT_EQ(scalar_output[i], expected_texel4(input, start + i, clut)) << start << " " << count << " " << i;
+            }
+        }
+    }
+}
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <optional>
 #include <memory>
+#include <span>
 
 #include "trtypes.h"
 #include "tr_rooms.h"
@@ -45,9 +46,9 @@ namespace trlevel
         // Returns: The number of rooms.
         virtual uint32_t num_rooms() const = 0;
 
-        // Get the room at the specified index.
+        // Get the room at the specified index. The reference is valid for the lifetime of the level.
         // Returns: The room.
-        virtual tr3_room get_room(uint32_t index) const = 0;
+        virtual const tr3_room& get_room(uint32_t index) const = 0;
 
         // Get the number of object textures in the level.
         // Returns: The number of object textures.
@@ -67,9 +68,9 @@ namespace trlevel
         // Returns: The floor data.
         virtual uint16_t get_floor_data(uint32_t index) const = 0;
 
-        // Returns entire floor data vector.
+        // Returns a view of the entire floor data. The view is valid for the lifetime of the level.
         // Returns: The floor data.
-        virtual std::vector<std::uint16_t> get_floor_data_all() const = 0;
+        virtual std::span<const std::uint16_t> get_floor_data_all() const = 0;
 
         /// Get the number of ai objects in the level.
         /// Returns: The number of ai objects.
@@ -116,6 +117,12 @@ namespace trlevel
         /// Get the number of mesh pointers in the level.
         virtual uint32_t num_mesh_pointers() const = 0;
 
+        // Get the offset into the mesh data that a mesh pointer refers to. Pointers with the same
+        // offset share a mesh.
+        // mesh_pointer: The mesh pointer index.
+        // Returns: The mesh data offset.
+        virtual uint32_t get_mesh_pointer(uint32_t mesh_pointer) const = 0;
+
         // Get the mesh referenced by the specified mesh pointer.
         // mesh_pointer: The mesh pointer index.
         // Returns: The mesh.
@@ -164,21 +171,33 @@ namespace trlevel
 
         struct LoadCallbacks
         {
+            /// Converts a sample to WAV data. Samples that are already WAV data are passed without a decoder.
+            using SampleDecoder = std::function<std::vector<uint8_t>(std::span<const uint8_t>)>;
+            /// The bytes of every sample used by the level, shared with whatever keeps the samples after the load.
+            using SampleData = std::shared_ptr<const std::vector<uint8_t>>;
+
             std::function<void(const std::string&)> on_progress_callback;
             std::function<void(const std::vector<uint32_t>&)> on_textile_callback;
-            std::function<void(uint16_t, uint16_t, uint16_t, const std::vector<uint8_t>&)> on_sound_callback;
+            /// Called with each sample as it is stored in the level. The data is a view into the sample data, which can be
+            /// kept to keep the view valid, and should be passed to the decoder, if there is one, when it is needed.
+            std::function<void(uint16_t, uint16_t, uint16_t, std::span<const uint8_t>, const SampleData&, const SampleDecoder&)> on_sound_callback;
+            /// Decode rooms concurrently where the level format supports it. The rooms produced are the same as a serial load.
+            bool parallel_rooms{ false };
+            /// Asks whatever is built from the level to make the rooms around the start position available first and
+            /// finish the rest later. The level itself is always loaded in full.
+            bool progressive{ false };
 
             void on_progress(const std::string& message) const;
             void on_textile(const std::vector<uint32_t>& data) const;
-            void on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, const std::vector<uint8_t>&) const;
+            void on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, std::span<const uint8_t> data, const SampleData& owner, const SampleDecoder& decoder) const;
         };
 
         virtual void load(const LoadCallbacks& callbacks) = 0;
-        virtual std::vector<tr_sound_source> sound_sources() const = 0;
-        virtual std::vector<tr_x_sound_details> sound_details() const = 0;
-        virtual std::vector<int16_t> sound_map() const = 0;
+        virtual std::span<const tr_sound_source> sound_sources() const = 0;
+        virtual std::span<const tr_x_sound_details> sound_details() const = 0;
+        virtual std::span<const int16_t> sound_map() const = 0;
         virtual bool trng() const = 0;
         virtual std::weak_ptr<IPack> pack() const = 0;
-        virtual std::vector<tr4_flyby_camera> flyby_cameras() const = 0;
+        virtual std::span<const tr4_flyby_camera> flyby_cameras() const = 0;
     };
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <trview.common/IFiles.h>
@@ -17,11 +18,12 @@ namespace trlevel
         {
             uint32_t start;
             uint32_t size;
-            std::vector<uint8_t> data;
+            /// View of the part inside the pack file, valid for the lifetime of the pack.
+            std::span<const uint8_t> data;
             std::optional<trlevel::PlatformAndVersion> version;
         };
 
-        using Source = std::function<std::shared_ptr<IPack>(std::basic_ispanstream<uint8_t>&)>;
+        using Source = std::function<std::shared_ptr<IPack>(const std::shared_ptr<const trview::IFiles::MappedFile>&)>;
         virtual ~IPack() = 0;
         virtual void load() = 0;
         virtual const std::vector<Part>& parts() const = 0;
@@ -30,7 +32,7 @@ namespace trlevel
     };
 
     std::string pack_filename(const std::string& filename);
-    std::optional<std::vector<uint8_t>> pack_entry(const IPack& pack, uint32_t offset);
+    std::optional<std::span<const uint8_t>> pack_entry(const IPack& pack, uint32_t offset);
     std::vector<trview::IFiles::File> valid_pack_levels(const IPack& pack);
 }
 
@@ -1,6 +1,7 @@
 #include "Level.h"
 #include "LevelLoadException.h"
 #include "LevelEncryptedException.h"
+#include <algorithm>
 #include <format>
 #include <ranges>
 #include <spanstream>
@@ -34,11 +35,11 @@ namespace trlevel
         }
     }
 
-    void ILevel::LoadCallbacks::on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, const std::vector<uint8_t>& data) const
+    void ILevel::LoadCallbacks::on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, std::span<const uint8_t> data, const SampleData& owner, const SampleDecoder& decoder) const
     {
         if (on_sound_callback)
         {
-            on_sound_callback(sound_map, sound_details, sample_index, data);
+            on_sound_callback(sound_map, sound_details, sample_index, data, owner, decoder);
         }
     }
 
@@ -60,214 +61,6 @@ namespace trlevel
             return transformed.find(L".TRC") != filename.npos;
         }
 
-        std::optional<PlatformAndVersion>  check_for_tr1_psx_without_sound(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR1 PSX sometimes has sound separated
-            file.seekg(sizeof(tr_textile4) * 13 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 32)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            skip(file, sizeof(tr_textile4) * 13 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 32)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 PSX has sound data before the version number - attempt to read
-            // sound data and see if we end up at a TR2 version number.
-            skip(file, read<uint32_t>(file) * sizeof(uint32_t));
-            skip(file, read<uint32_t>(file));
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 45)
-            {
-                return PlatformAndVersion { .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 45 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_psx_version_44(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 beta has TR1 style sounds first.
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 44)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 44 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_version_42(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 42 has sounds, style sounds then 18 textiles + cluts;
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            skip(file, sizeof(tr_textile4) * 18);
-            skip(file, sizeof(tr_clut) * 2048);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 42)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 42 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_psx_version_38(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 38 has TR1 style sounds then 14 textiles + cluts.
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            skip(file, sizeof(tr_textile4) * 14);
-            skip(file, sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 38)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 38 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_psx_version_27(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR1 PSX August 1996 has textiles first.
-            file.seekg(sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 27)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 27 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_may_1996(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR1 PSX May 1996 has textiles first.
-            file.seekg(sizeof(tr_textile4) * 21 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 11)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 11 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_saturn(std::basic_ispanstream<uint8_t>& file)
-        {
-            std::array<uint8_t, 8> data;
-            file.read(&data[0], 8);
-            if ((data | std::ranges::to<std::string>()) == "ROOMFILE")
-            {
-                skip(file, 4);
-                const int32_t version = std::byteswap(read<int32_t>(file));
-                return PlatformAndVersion{ .platform = Platform::Saturn, .version = LevelVersion::Tomb1, .raw_version = version };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr4_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            file.seekg(0x7000);
-            const int32_t potential_version = peek<int32_t>(file);
-            if (is_supported_tr4_psx_version(potential_version))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb4, .raw_version = potential_version };
-            }
-
-            file.seekg(0x7800);
-            const int32_t potential_version_2 = peek<int32_t>(file);
-            if (is_supported_tr4_psx_version(potential_version_2))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb4, .raw_version = potential_version_2 };
-            }
-
-            file.seekg(0x6000);
-            const int32_t potential_version_3 = peek<int32_t>(file);
-            if (is_supported_tr4_psx_version(potential_version_3))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb4, .raw_version = potential_version_3 };
-            }
-
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr5_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            file.seekg(313344);
-            const int32_t potential_version = read<int32_t>(file);
-            if (is_supported_tr5_psx_version(potential_version))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb5, .raw_version = potential_version };
-            }
-            return std::nullopt;
-        }
-
-        class FileResetter final
-        {
-        public:
-            FileResetter(std::basic_ispanstream<uint8_t>& file)
-                : _file(file)
-            {
-                _file.seekg(0, std::ios::beg);
-            }
-
-            ~FileResetter()
-            {
-                _file.clear();
-                _file.seekg(0, std::ios::beg);
-            }
-        private:
-            std::basic_ispanstream<uint8_t>& _file;
-        };
-
-        PlatformAndVersion detect_level_version(std::basic_ispanstream<uint8_t>& file)
-        {
-            const std::vector<std::function<std::optional<PlatformAndVersion>(std::basic_ispanstream<uint8_t>&)>> checks
-            {
-                check_for_tr2_psx,
-                check_for_tr2_psx_version_44,
-                check_for_tr2_version_42,
-                check_for_tr2_psx_version_38,
-                check_for_tr1_psx_version_27,
-                check_for_tr1_may_1996,
-                check_for_tr1_psx_without_sound,
-                check_for_tr1_psx,
-                check_for_tr4_psx,
-                check_for_tr5_psx,
-                check_for_tr1_saturn
-            };
-
-            for (const auto& check : checks)
-            {
-                const FileResetter resetter(file);
-                try
-                {
-                    if (const auto version = check(file))
-                    {
-                        return version.value();
-                    }
-                }
-                catch(...)
-                {
-                }
-            }
-            return {};
-        }
-
         bool has_frame_count(PlatformAndVersion version)
         {
             return (version.version == LevelVersion::Tomb1 && !version.is_tr2_saturn) || is_tr2_version_42(version) || is_tr2_e3(version) || is_tr2_version_38(version);
@@ -419,7 +212,7 @@ namespace trlevel
         return static_cast<uint32_t>(_rooms.size());
     }
 
-    tr3_room Level::get_room(uint32_t index) const
+    const tr3_room& Level::get_room(uint32_t index) const
     {
         return _rooms[index];
     }
@@ -444,8 +237,7 @@ namespace trlevel
         return _floor_data[index];
     }
 
-    std::vector<std::uint16_t> 
-    Level::get_floor_data_all() const
+    std::span<const std::uint16_t> Level::get_floor_data_all() const
     {
         return _floor_data;
     }
@@ -482,15 +274,13 @@ namespace trlevel
 
     bool Level::get_model_by_id(uint32_t id, tr_model& output) const 
     {
-        for (const auto& model : _models)
+        const auto found = _model_lookup.find(id);
+        if (found == _model_lookup.end())
         {
-            if (model.ID == id)
-            {
-                output = model;
-                return true;
-            }
+            return false;
         }
-        return false;
+        output = _models[found->second];
+        return true;
     }
 
     uint32_t Level::num_static_meshes() const
@@ -513,6 +303,11 @@ namespace trlevel
         return static_cast<uint32_t>(_mesh_pointers.size());
     }
 
+    uint32_t Level::get_mesh_pointer(uint32_t mesh_pointer) const
+    {
+        return _mesh_pointers[mesh_pointer];
+    }
+
     tr_mesh Level::get_mesh_by_pointer(uint32_t mesh_pointer) const
     {
         auto index = _mesh_pointers[mesh_pointer];
@@ -631,17 +426,12 @@ namespace trlevel
 
     bool Level::get_sprite_sequence_by_id(int32_t sprite_sequence_id, tr_sprite_sequence& output) const
     {
-        auto found_sequence = std::find_if(_sprite_sequences.begin(), _sprite_sequences.end(), [=](const auto& sequence)
-        {
-            return sequence.SpriteID == sprite_sequence_id; 
-        });
-
-        if (found_sequence == _sprite_sequences.end())
+        const auto found = _sprite_sequence_lookup.find(sprite_sequence_id);
+        if (found == _sprite_sequence_lookup.end())
         {
             return false;
         }
-
-        output = *found_sequence;
+        output = _sprite_sequences[found->second];
         return true;
     }
 
@@ -656,12 +446,12 @@ namespace trlevel
 
     bool Level::find_first_entity_by_type(int16_t type, tr2_entity& entity) const
     {
-        auto found = std::find_if(_entities.begin(), _entities.end(), [type](const auto& e) { return e.TypeID == type; });
-        if (found == _entities.end())
+        const auto found = _entity_type_lookup.find(type);
+        if (found == _entity_type_lookup.end())
         {
             return false;
         }
-        entity = *found;
+        entity = _entities[found->second];
         return true;
     }
 
@@ -702,17 +492,22 @@ namespace trlevel
 
             const bool is_packed = _filename.starts_with("pack") && _pack;
             const bool is_pack_preview = _filename.starts_with("pack-preview") && _pack;
-            auto bytes = is_packed ? pack_entry(*_pack, std::stoi(_name)) : _files->load_file(_filename);
+            // Packed levels are views into the pack, other levels are mapped for the duration of the load.
+            const auto mapped = is_packed ? nullptr : _files->map_file(_filename);
+            const auto bytes = is_packed ? pack_entry(*_pack, std::stoi(_name)) :
+                mapped ? std::optional<std::span<const uint8_t>>(mapped->data()) : std::nullopt;
             if (!bytes.has_value())
             {
                 throw LevelLoadException();
             }
 
-            std::basic_ispanstream<uint8_t> file{ std::span(*bytes) };
+            std::basic_ispanstream<uint8_t> file{ *bytes };
             file.exceptions(std::ios::failbit);
             log_file(activity, file, std::format("Opened file \"{}\"", _filename));
 
-            read_header(file, *bytes, activity, callbacks);
+            // Only populated if the level needs decrypting.
+            std::vector<uint8_t> decrypted;
+            read_header(file, decrypted, activity, callbacks);
 
             if (is_pack_preview)
             {
@@ -732,7 +527,7 @@ namespace trlevel
                 {{.platform = Platform::PSX, .version = LevelVersion::Tomb3 }, [&]() { load_tr3_psx(file, activity, callbacks); }},
                 {{.platform = Platform::PSX, .version = LevelVersion::Tomb4 }, [&]() { load_tr4_psx(file, activity, callbacks); }},
                 {{.platform = Platform::PSX, .version = LevelVersion::Tomb5 }, [&]() { load_tr5_psx(file, activity, callbacks); }},
-                {{.platform = Platform::PSX, .version = LevelVersion::Unknown, .is_pack = true }, [&]() { load_psx_pack(file, activity, callbacks); }},
+                {{.platform = Platform::PSX, .version = LevelVersion::Unknown, .is_pack = true }, [&]() { load_psx_pack(mapped, activity, callbacks); }},
                 {{.platform = Platform::PC, .version = LevelVersion::Tomb1 }, [&]() { load_tr1_pc(file, activity, callbacks); }},
                 {{.platform = Platform::PC, .version = LevelVersion::Tomb2 }, [&]() { load_tr2_pc(file, activity, callbacks); }},
                 {{.platform = Platform::PC, .version = LevelVersion::Tomb3 }, [&]() { load_tr3_pc(file, activity, callbacks); }},
@@ -748,6 +543,9 @@ namespace trlevel
             if (loader != loaders.end())
             {
                 loader->second();
+                // A stage of its own so that benchmarks can time the ID lookups apart from the rest of the load.
+                callbacks.on_progress("Generating lookups");
+                generate_lookups();
                 callbacks.on_progress("Loading complete");
                 return;
             }
@@ -769,35 +567,28 @@ namespace trlevel
         }
     }
 
-    std::vector<tr_sound_source> Level::sound_sources() const
+    std::span<const tr_sound_source> Level::sound_sources() const
     {
         return _sound_sources;
     }
 
-    std::vector<tr_x_sound_details> Level::sound_details() const
+    std::span<const tr_x_sound_details> Level::sound_details() const
     {
         return _sound_details;
     }
 
-    std::vector<int16_t> Level::sound_map() const
+    std::span<const int16_t> Level::sound_map() const
     {
         return _sound_map;
     }
 
-    void Level::read_header(std::basic_ispanstream<uint8_t>& file, std::vector<uint8_t>& bytes, trview::Activity& activity, const LoadCallbacks& callbacks)
+    void Level::read_header(std::basic_ispanstream<uint8_t>& file, std::vector<uint8_t>& decrypted, trview::Activity& activity, const LoadCallbacks& callbacks)
     {
         log_file(activity, file, "Reading version number from file");
-        uint32_t raw_version = read<uint32_t>(file);
 
-        // For levels where the version number is not the first bytes check the
-        // appropriate location in the file.
-        _platform_and_version = detect_level_version(file);
-
-        // If specific version checks failed we can check the first bytes.
-        if (_platform_and_version.version == LevelVersion::Unknown)
-        {
-            _platform_and_version = convert_level_version(raw_version);
-        }
+        // For levels where the version number is not the first bytes the signature
+        // table checks the appropriate locations, otherwise the first bytes are used.
+        _platform_and_version = detect_level_version(file.span());
 
         log_file(activity, file, std::format("Version number is {} ({}), Platform is {}", _platform_and_version.raw_version, to_string(get_version()), to_string(platform())));
         if (_platform_and_version.version == LevelVersion::Unknown)
@@ -813,7 +604,10 @@ namespace trlevel
         {
             callbacks.on_progress("Decrypting");
             log_file(activity, file, std::format("File is encrypted, decrypting"));
-            _decrypter->decrypt(bytes);
+            const auto encrypted = file.span();
+            decrypted.assign(encrypted.begin(), encrypted.end());
+            _decrypter->decrypt(decrypted);
+            file.span(std::span(decrypted));
             file.seekg(0, std::ios::beg);
             _platform_and_version = convert_level_version(read<uint32_t>(file));
             log_file(activity, file, std::format("Version number is {:X} ({})", _platform_and_version.raw_version, to_string(get_version())));
@@ -837,9 +631,11 @@ namespace trlevel
 
     void Level::load_sound_fx(trview::Activity& activity, const LoadCallbacks& callbacks)
     {
-        if (const auto main = load_main_sfx())
+        _main_sfx = load_main_sfx();
+        if (_main_sfx)
         {
-            std::basic_ispanstream<uint8_t> sfx_file{ std::span(*main) };
+            const auto main = _main_sfx->data();
+            std::basic_ispanstream<uint8_t> sfx_file{ main };
             sfx_file.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
 
             // Remastered has a sound map like structure at the start of main.sfx, so skip that if present:
@@ -863,30 +659,39 @@ namespace trlevel
             }
 
             int16_t overall_index = 0;
-            while (static_cast<std::size_t>(sfx_file.tellg()) < main->size())
+            while (static_cast<std::size_t>(sfx_file.tellg()) < main.size())
             {
                 skip(sfx_file, 4);
                 uint32_t size = read<uint32_t>(sfx_file);
                 sfx_file.seekg(-8, std::ios::cur);
                 if (std::ranges::find(_sample_indices, static_cast<uint32_t>(overall_index)) != _sample_indices.end())
                 {
-                    _sound_samples.push_back({ main->begin() + sfx_file.tellg(), main->begin() + sfx_file.tellg() + size + 8 });
+                    _sound_samples.push_back(read_span(sfx_file, size + 8));
+                }
+                else
+                {
+                    sfx_file.seekg(size + 8, std::ios::cur);
                 }
                 overall_index++;
-                sfx_file.seekg(size + 8, std::ios::cur);
             }
         }
     }
 
-    std::optional<std::vector<uint8_t>> Level::load_main_sfx() const
+    std::shared_ptr<const trview::IFiles::MappedFile> Level::load_main_sfx() const
     {
         const auto path = trview::path_for_filename(_filename);
-        const auto og_main = _files->load_file(std::format("{}/MAIN.SFX", path));
-        if (og_main.has_value())
+        if (auto og_main = _files->map_file(std::format("{}/MAIN.SFX", path)))
         {
             return og_main;
         }
-        return _files->load_file(std::format("{}/../SFX/MAIN.SFX", path));
+        return _files->map_file(std::format("{}/../SFX/MAIN.SFX", path));
+    }
+
+    void Level::add_sound_sample(std::vector<uint8_t>&& data)
+    {
+        // Moving the vector keeps its buffer, so the view stays valid as more samples are added.
+        _sound_sample_data.push_back(std::move(data));
+        _sound_samples.push_back(_sound_sample_data.back());
     }
 
     bool Level::trng() const
@@ -929,13 +734,15 @@ namespace trlevel
         callbacks.on_progress("Reading sprite textures");
         log_file(activity, file, "Reading sprite textures");
         auto textures = read_vector<uint32_t, tr_sprite_texture_psx>(file);
+        _textile4_atlas.add(textures);
+        pack_textile4();
         _sprite_textures = textures
             | std::views::transform([&](const auto texture) -> tr_sprite_texture
                 {
-                    const uint16_t tile = convert_textile4(texture.Tile, texture.Clut);
+                    const auto placed = _textile4_atlas.place(texture);
                     const uint16_t width = (texture.u1 - texture.u0) * 256 + 255;
                     const uint16_t height = (texture.v1 - texture.v0) * 256 + 255;
-                    return { tile, texture.u0, texture.v0, width, height, texture.LeftSide, texture.TopSide, texture.RightSide, texture.BottomSide };
+                    return { placed.Tile, placed.u0, placed.v0, width, height, texture.LeftSide, texture.TopSide, texture.RightSide, texture.BottomSide };
                 })
             | std::ranges::to<std::vector>();
         log_file(activity, file, std::format("Read {} sprite textures", _sprite_textures.size()));
@@ -992,15 +799,50 @@ namespace trlevel
         return _pack;
     }
 
-    std::vector<tr4_flyby_camera> Level::flyby_cameras() const
+    std::span<const tr4_flyby_camera> Level::flyby_cameras() const
     {
         return _flyby_cameras;
     }
 
+    void Level::generate_lookups()
+    {
+        // Only the first model, sprite sequence or entity with each ID is recorded so that lookups
+        // return the same result as a search from the start of the list.
+        _model_lookup.clear();
+        _model_lookup.reserve(_models.size());
+        for (std::size_t i = 0; i < _models.size(); ++i)
+        {
+            _model_lookup.try_emplace(_models[i].ID, i);
+        }
+
+        _sprite_sequence_lookup.clear();
+        _sprite_sequence_lookup.reserve(_sprite_sequences.size());
+        for (std::size_t i = 0; i < _sprite_sequences.size(); ++i)
+        {
+            _sprite_sequence_lookup.try_emplace(_sprite_sequences[i].SpriteID, i);
+        }
+
+        _entity_type_lookup.clear();
+        for (std::size_t i = 0; i < _entities.size(); ++i)
+        {
+            _entity_type_lookup.try_emplace(_entities[i].TypeID, i);
+        }
+    }
+
     void Level::generate_sounds(const LoadCallbacks& callbacks)
     {
         callbacks.on_progress("Generating sounds");
-        for (auto sound_map_index = 0; sound_map_index < _sound_map.size(); ++sound_map_index)
+
+        struct Use
+        {
+            uint16_t sound_map;
+            uint16_t sound_details;
+            uint16_t sample_index;
+        };
+
+        // Nothing keeps the samples when there is no callback, so they don't need to be gathered.
+        std::vector<Use> uses;
+        for (auto sound_map_index = 0; callbacks.on_sound_callback && sound_map_index < _sound_map.size(); ++sound_map_index)
         {
             const int16_t sound_details_index = _sound_map[sound_map_index];
             if (sound_details_index == -1)
@@ -1015,12 +857,45 @@ namespace trlevel
                 const uint16_t sample_index = static_cast<uint16_t>(sound_detail.tr_sound_details.Sample + s);
                 if (sample_index < _sound_samples.size())
                 {
-                    callbacks.on_sound(static_cast<uint16_t>(sound_map_index), sound_details_index, sample_index, { _sound_samples[sample_index] });
+                    uses.push_back({ static_cast<uint16_t>(sound_map_index), static_cast<uint16_t>(sound_details_index), sample_index });
                 }
             }
         }
 
+        // The samples that are used are gathered into one buffer that outlives the level, so that whatever keeps the
+        // sounds can hold views into it rather than copying each sample.
+        std::vector<std::optional<std::pair<std::size_t, std::size_t>>> ranges(_sound_samples.size());
+        std::size_t total = 0;
+        for (const auto& use : uses)
+        {
+            auto& range = ranges[use.sample_index];
+            if (!range)
+            {
+                range = { total, _sound_samples[use.sample_index].size() };
+                total += range->second;
+            }
+        }
+
+        auto data = std::make_shared<std::vector<uint8_t>>(total);
+        for (std::size_t i = 0; i < ranges.size(); ++i)
+        {
+            if (ranges[i])
+            {
+                std::ranges::copy(_sound_samples[i], data->begin() + ranges[i]->first);
+            }
+        }
+
+        const LoadCallbacks::SampleData owner = data;
+        for (const auto& use : uses)
+        {
+            const auto& [offset, size] = *ranges[use.sample_index];
+            callbacks.on_sound(use.sound_map, use.sound_details, use.sample_index, std::span<const uint8_t>(*owner).subspan(offset, size), owner, _sample_decoder);
+        }
+
         _sound_data = {};
         _sound_samples = {};
+        _sound_sample_data = {};
+        _sample_decoder = nullptr;
+        _main_sfx = nullptr;
     }
 }
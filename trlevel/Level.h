@@ -9,6 +9,7 @@
 #include "ILevel.h"
 #include "trtypes.h"
 #include "IDecrypter.h"
+#include "TextileAtlas.h"
 
 #include <trview.common/Logs/ILog.h>
 #include <trview.common/Logs/Activity.h>
@@ -62,7 +63,7 @@ namespace trlevel
 
         // Get the room at the specified index.
         // Returns: The room.
-        virtual tr3_room get_room(uint32_t index) const override;
+        virtual const tr3_room& get_room(uint32_t index) const override;
 
         // Get the number of object textures in the level.
         // Returns: The number of object textures.
@@ -82,9 +83,9 @@ namespace trlevel
         // Returns: The floor data.
         virtual uint16_t get_floor_data(uint32_t index) const override;
 
-        // Returns entire floor data vector.
+        // Returns a view of the entire floor data.
         // Returns: The floor data.
-        virtual std::vector<std::uint16_t> get_floor_data_all() const override; 
+        virtual std::span<const std::uint16_t> get_floor_data_all() const override;
 
         virtual uint32_t num_ai_objects() const override;
         virtual tr4_ai_object get_ai_object(uint32_t index) const override;
@@ -124,6 +125,7 @@ namespace trlevel
 
         /// Get the number of mesh pointers in the level.
         virtual uint32_t num_mesh_pointers() const override;
+        uint32_t get_mesh_pointer(uint32_t mesh_pointer) const override;
 
         // Get the mesh at the specified index.
         // index: The index of the mesh to get.
@@ -169,21 +171,21 @@ namespace trlevel
         virtual tr_camera get_camera(uint32_t index) const override;
         Platform platform() const override;
         void load(const LoadCallbacks& callbacks) override;
-        std::vector<tr_sound_source> sound_sources() const override;
-        std::vector<tr_x_sound_details> sound_details() const override;
-        std::vector<int16_t> sound_map() const override;
+        std::span<const tr_sound_source> sound_sources() const override;
+        std::span<const tr_x_sound_details> sound_details() const override;
+        std::span<const int16_t> sound_map() const override;
         bool trng() const override;
         PlatformAndVersion platform_and_version() const override;
         std::weak_ptr<IPack> pack() const override;
-        std::vector<tr4_flyby_camera> flyby_cameras() const override;
+        std::span<const tr4_flyby_camera> flyby_cameras() const override;
     private:
         void generate_meshes(const std::vector<uint16_t>& mesh_data);
         tr_colour4 colour_from_object_texture(uint32_t texture) const;
-        uint16_t convert_textile4(uint16_t tile, uint16_t clut_id);
+        void pack_textile4();
         uint16_t attribute_for_clut(uint16_t clut_id) const;
 
         // New level bits:
-        void read_header(std::basic_ispanstream<uint8_t>& file, std::vector<uint8_t>& bytes, trview::Activity& activity, const LoadCallbacks& callbacks);
+        void read_header(std::basic_ispanstream<uint8_t>& file, std::vector<uint8_t>& decrypted, trview::Activity& activity, const LoadCallbacks& callbacks);
         void read_object_textures_tr1_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
         void read_object_textures_tr2_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
         void read_object_textures_tr3_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
@@ -238,10 +240,10 @@ namespace trlevel
         void load_tr5_pc(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
         void load_tr5_pc_remastered(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
         void load_tr5_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
-        void load_psx_pack(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
+        void load_psx_pack(const std::shared_ptr<const trview::IFiles::MappedFile>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
 
         void load_sound_fx(trview::Activity& activity, const LoadCallbacks& callbacks);
-        std::optional<std::vector<uint8_t>> load_main_sfx() const;
+        std::shared_ptr<const trview::IFiles::MappedFile> load_main_sfx() const;
         void load_ngle_sound_fx(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const LoadCallbacks& callbacks);
 
         void generate_mesh(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
@@ -259,6 +261,8 @@ namespace trlevel
         void generate_sound_samples(const LoadCallbacks& callbacks);
         void generate_sounds(const LoadCallbacks& callbacks);
         void generate_textiles_from_textile8(const LoadCallbacks& callbacks);
+        void generate_lookups();
+        void add_sound_sample(std::vector<uint8_t>&& data);
 
         PlatformAndVersion _platform_and_version;
 
@@ -270,7 +274,7 @@ namespace trlevel
         std::vector<tr_textile8>  _textile8;
         std::vector<tr_textile16> _textile16;
         std::vector<tr_clut> _clut;
-        std::vector<std::pair<uint16_t, uint16_t>> _converted_t16;
+        TextileAtlas _textile4_atlas;
 
         std::vector<tr3_room>          _rooms;
         std::vector<tr_object_texture> _object_textures;
@@ -293,6 +297,11 @@ namespace trlevel
         std::vector<tr_sprite_texture>        _sprite_textures;
         std::vector<tr_sprite_sequence>       _sprite_sequences;
 
+        // ID lookups built once the level has loaded.
+        std::unordered_map<uint32_t, std::size_t> _model_lookup;
+        std::unordered_map<int32_t, std::size_t>  _sprite_sequence_lookup;
+        std::unordered_map<int16_t, std::size_t>  _entity_type_lookup;
+
         std::string _name;
 
         std::vector<tr_camera> _cameras;
@@ -302,7 +311,13 @@ namespace trlevel
         std::vector<int16_t> _sound_map;
         std::vector<uint32_t> _sample_indices;
         std::vector<uint8_t> _sound_data;
-        std::vector<std::vector<uint8_t>> _sound_samples;
+        // Views of each sound sample until the sounds are generated. Samples that had to be converted are owned by
+        // _sound_sample_data, other samples point into the level file, MAIN.SFX or _sound_data.
+        std::vector<std::span<const uint8_t>> _sound_samples;
+        std::vector<std::vector<uint8_t>> _sound_sample_data;
+        // Set when the samples are stored in a format that has to be decoded before they can be played.
+        LoadCallbacks::SampleDecoder _sample_decoder;
+        std::shared_ptr<const trview::IFiles::MappedFile> _main_sfx;
 
         std::shared_ptr<trview::ILog>   _log;
         std::shared_ptr<IDecrypter>     _decrypter;
@@ -1,6 +1,11 @@
 #include "LevelVersion.h"
 #include <trview.common/Algorithms.h>
 #include "Level_psx.h"
+#include "trtypes.h"
+#include <array>
+#include <bit>
+#include <cstring>
+#include <optional>
 
 namespace trlevel
 {
@@ -61,6 +66,131 @@ namespace trlevel
             }
             return { .platform = Platform::Unknown, .version = LevelVersion::Unknown };
         }
+
+        // Where the offset of a signature is measured from.
+        enum class Anchor
+        {
+            Start,
+            // After TR1 style sound data: size, data, size, data.
+            AfterTr1Sounds,
+            // After TR2 PSX sound data: offset count, offsets, size, data.
+            AfterTr2Sounds
+        };
+
+        enum class Match
+        {
+            Equal,
+            Tr4Psx,
+            Tr5Psx,
+            // "ROOMFILE" at the start of the file and a big endian version at the offset.
+            RoomFile
+        };
+
+        struct VersionSignature
+        {
+            Anchor       anchor;
+            uint64_t     offset;
+            Match        match;
+            int32_t      value;
+            Platform     platform;
+            LevelVersion version;
+        };
+
+        constexpr uint64_t psx_textiles(uint64_t textiles, uint64_t cluts)
+        {
+            return sizeof(tr_textile4) * textiles + sizeof(tr_clut) * cluts;
+        }
+
+        // Checked in order - the first match wins.
+        constexpr std::array<VersionSignature, 13> signatures
+        { {
+            { Anchor::AfterTr2Sounds, 0, Match::Equal, 45, Platform::PSX, LevelVersion::Tomb2 },
+            { Anchor::AfterTr1Sounds, 0, Match::Equal, 44, Platform::PSX, LevelVersion::Tomb2 },
+            { Anchor::AfterTr1Sounds, psx_textiles(18, 2048), Match::Equal, 42, Platform::PSX, LevelVersion::Tomb2 },
+            { Anchor::AfterTr1Sounds, psx_textiles(14, 1024), Match::Equal, 38, Platform::PSX, LevelVersion::Tomb2 },
+            { Anchor::Start, psx_textiles(15, 1024), Match::Equal, 27, Platform::PSX, LevelVersion::Tomb1 },
+            { Anchor::Start, psx_textiles(21, 1024), Match::Equal, 11, Platform::PSX, LevelVersion::Tomb1 },
+            { Anchor::Start, psx_textiles(13, 1024), Match::Equal, 32, Platform::PSX, LevelVersion::Tomb1 },
+            { Anchor::AfterTr1Sounds, psx_textiles(13, 1024), Match::Equal, 32, Platform::PSX, LevelVersion::Tomb1 },
+            { Anchor::Start, 0x7000, Match::Tr4Psx, 0, Platform::PSX, LevelVersion::Tomb4 },
+            { Anchor::Start, 0x7800, Match::Tr4Psx, 0, Platform::PSX, LevelVersion::Tomb4 },
+            { Anchor::Start, 0x6000, Match::Tr4Psx, 0, Platform::PSX, LevelVersion::Tomb4 },
+            { Anchor::Start, 313344, Match::Tr5Psx, 0, Platform::PSX, LevelVersion::Tomb5 },
+            { Anchor::Start, 12, Match::RoomFile, 0, Platform::Saturn, LevelVersion::Tomb1 }
+        } };
+
+        static_assert(level_version_prefix_size >= 313344 + sizeof(int32_t));
+
+        std::optional<int32_t> read_int32(std::span<const uint8_t> data, std::optional<uint64_t> offset)
+        {
+            if (!offset || *offset > data.size() || data.size() - *offset < sizeof(int32_t))
+            {
+                return std::nullopt;
+            }
+            int32_t value = 0;
+            std::memcpy(&value, data.data() + *offset, sizeof(value));
+            return value;
+        }
+
+        std::optional<uint64_t> after_sounds(std::span<const uint8_t> data, uint64_t first_element_size)
+        {
+            const auto first = read_int32(data, 0);
+            if (!first)
+            {
+                return std::nullopt;
+            }
+            const uint64_t second_offset = sizeof(uint32_t) + static_cast<uint32_t>(*first) * first_element_size;
+            const auto second = read_int32(data, second_offset);
+            if (!second)
+            {
+                return std::nullopt;
+            }
+            return second_offset + sizeof(uint32_t) + static_cast<uint32_t>(*second);
+        }
+
+        bool matches(const VersionSignature& signature, std::span<const uint8_t> data, int32_t value)
+        {
+            switch (signature.match)
+            {
+                case Match::Equal:
+                    return value == signature.value;
+                case Match::Tr4Psx:
+                    return is_supported_tr4_psx_version(value);
+                case Match::Tr5Psx:
+                    return is_supported_tr5_psx_version(value);
+                case Match::RoomFile:
+                    return data.size() >= 8 && std::memcmp(data.data(), "ROOMFILE", 8) == 0;
+            }
+            return false;
+        }
+    }
+
+    PlatformAndVersion detect_level_version(std::span<const uint8_t> data)
+    {
+        // Each anchor is worked out once and shared by all of the signatures that use it.
+        const std::array<std::optional<uint64_t>, 3> anchors
+        {
+            0u,
+            after_sounds(data, 1),
+            after_sounds(data, sizeof(uint32_t))
+        };
+
+        for (const auto& signature : signatures)
+        {
+            const auto anchor = anchors[static_cast<std::size_t>(signature.anchor)];
+            const auto value = read_int32(data, anchor ? std::optional<uint64_t>(*anchor + signature.offset) : std::nullopt);
+            if (value && matches(signature, data, *value))
+            {
+                const int32_t raw_version = signature.match == Match::RoomFile ? std::byteswap(*value) : *value;
+                return { .platform = signature.platform, .version = signature.version, .raw_version = raw_version };
+            }
+        }
+
+        if (const auto version = read_int32(data, 0))
+        {
+            return convert_level_version(*version);
+        }
+        return {};
     }
 
     // Converts the level version number into a level version enumeration.
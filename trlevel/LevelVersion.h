@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <unordered_map>
 
@@ -47,6 +48,19 @@ namespace trlevel
     // Returns: The level version.
     PlatformAndVersion convert_level_version(int32_t version);
 
+    // The number of bytes from the start of a level that detect_level_version needs
+    // to check every signature at a fixed offset.
+    constexpr std::size_t level_version_prefix_size = 313344 + sizeof(int32_t);
+
+    // Detects the platform and version of a level from its leading bytes. Versions that
+    // are not at the start of the file are found by matching a table of signatures,
+    // otherwise the first four bytes are converted with convert_level_version.
+    // Signatures that would be read from beyond the end of data are not matched, so this
+    // can be called with a prefix of the file. This does not throw.
+    // data: The level data or a prefix of it.
+    // Returns: The level version.
+    PlatformAndVersion detect_level_version(std::span<const uint8_t> data);
+
     bool is_tr1_version_21(PlatformAndVersion version);
     bool is_tr1_may_1996(PlatformAndVersion version);
     bool is_tr1_pc_may_1996(PlatformAndVersion version);
@@ -2,19 +2,16 @@
 
 namespace trlevel
 {
-    namespace
+    void skip(std::basic_ispanstream<uint8_t>& file, uint32_t size)
     {
-        void skip_vector_compressed(std::basic_ispanstream<uint8_t>& file)
-        {
-            skip(file, sizeof(uint32_t));
-            auto compressed_size = read<uint32_t>(file);
-            skip(file, compressed_size);
-        }
+        file.seekg(size, std::ios::cur);
     }
 
-    void skip(std::basic_ispanstream<uint8_t>& file, uint32_t size)
+    std::span<const uint8_t> read_span(std::basic_ispanstream<uint8_t>& file, uint32_t size)
     {
-        file.seekg(size, std::ios::cur);
+        const auto start = static_cast<std::size_t>(file.tellg());
+        skip(file, size);
+        return file.span().subspan(start, size);
     }
 
     void log_file(trview::Activity& activity, std::basic_ispanstream<uint8_t>& stream, const std::string& text)
@@ -29,19 +26,28 @@ namespace trlevel
 
     std::vector<uint8_t> read_compressed(std::basic_ispanstream<uint8_t>& file)
     {
-        auto uncompressed_size = read<uint32_t>(file);
-        auto compressed_size = read<uint32_t>(file);
-        auto compressed = read_vector<uint8_t>(file, compressed_size);
-        std::vector<uint8_t> uncompressed_data(uncompressed_size);
+        return inflate_chunk(find_compressed(file));
+    }
+
+    CompressedChunk find_compressed(std::basic_ispanstream<uint8_t>& file)
+    {
+        const auto uncompressed_size = read<uint32_t>(file);
+        const auto compressed_size = read<uint32_t>(file);
+        return { .uncompressed_size = uncompressed_size, .data = read_span(file, compressed_size) };
+    }
+
+    std::vector<uint8_t> inflate_chunk(const CompressedChunk& chunk)
+    {
+        std::vector<uint8_t> uncompressed_data(chunk.uncompressed_size);
 
         z_stream stream;
         memset(&stream, 0, sizeof(stream));
         int result = inflateInit(&stream);
         // Exception...
-        stream.avail_in = compressed_size;
-        stream.next_in = &compressed[0];
-        stream.avail_out = uncompressed_size;
-        stream.next_out = &uncompressed_data[0];
+        stream.avail_in = static_cast<uInt>(chunk.data.size());
+        stream.next_in = const_cast<Bytef*>(chunk.data.data());
+        stream.avail_out = chunk.uncompressed_size;
+        stream.next_out = uncompressed_data.data();
         result = inflate(&stream, Z_NO_FLUSH);
         inflateEnd(&stream);
 
@@ -53,7 +59,7 @@ namespace trlevel
         callbacks.on_progress("Reading AI objects");
         log_file(activity, file, "Reading AI objects");
         const auto ai_objects = read_vector<uint32_t, tr4_ai_object>(file);
-        log_file(activity, file, std::format("Read {} AI objects", ai_objects.size()));
+        log_file(activity, file, "Read {} AI objects", ai_objects.size());
         return ai_objects;
     }
 
@@ -62,7 +68,7 @@ namespace trlevel
         callbacks.on_progress("Reading animated textures");
         log_file(activity, file, "Reading animated textures");
         std::vector<uint16_t> animated_textures = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} animated textures", animated_textures.size()));
+        log_file(activity, file, "Read {} animated textures", animated_textures.size());
         return animated_textures;
     }
 
@@ -71,7 +77,7 @@ namespace trlevel
         callbacks.on_progress("Reading animated textures UV count");
         log_file(activity, file, "Reading animated textures UV count");
         uint8_t animated_textures_uv_count = read<uint8_t>(file);
-        log_file(activity, file, std::format("Animated texture UV count: {}", animated_textures_uv_count));
+        log_file(activity, file, "Animated texture UV count: {}", animated_textures_uv_count);
         return animated_textures_uv_count;
     }
 
@@ -94,7 +100,7 @@ namespace trlevel
         callbacks.on_progress("Reading anim commands");
         log_file(activity, file, "Reading anim commands");
         const auto anim_commands = read_vector<uint32_t, tr_anim_command>(file);
-        log_file(activity, file, std::format("Read {} anim commands", anim_commands.size()));
+        log_file(activity, file, "Read {} anim commands", anim_commands.size());
         return anim_commands;
     }
 
@@ -103,7 +109,7 @@ namespace trlevel
         callbacks.on_progress("Reading anim dispatches");
         log_file(activity, file, "Reading anim dispatches");
         const auto anim_dispatches = read_vector<uint32_t, tr_anim_dispatch>(file);
-        log_file(activity, file, std::format("Read {} anim dispatches", anim_dispatches.size()));
+        log_file(activity, file, "Read {} anim dispatches", anim_dispatches.size());
         return anim_dispatches;
     }
 
@@ -113,7 +119,7 @@ namespace trlevel
         log_file(activity, file, "Reading boxes");
         std::vector<tr2_box> boxes = read_vector<uint32_t, tr2_box>(file);
         uint32_t num_boxes = static_cast<uint32_t>(boxes.size());
-        log_file(activity, file, std::format("Read {} boxes", num_boxes));
+        log_file(activity, file, "Read {} boxes", num_boxes);
         return boxes;
     }
 
@@ -122,7 +128,7 @@ namespace trlevel
         callbacks.on_progress("Reading cameras");
         log_file(activity, file, "Reading cameras");
         const auto cameras = read_vector<uint32_t, tr_camera>(file);
-        log_file(activity, file, std::format("Read {} cameras", cameras.size()));
+        log_file(activity, file, "Read {} cameras", cameras.size());
         return cameras;
     }
 
@@ -131,7 +137,7 @@ namespace trlevel
         callbacks.on_progress("Reading cinematic frames");
         log_file(activity, file, "Reading cinematic frames");
         std::vector<tr_cinematic_frame> cinematic_frames = read_vector<uint16_t, tr_cinematic_frame>(file);
-        log_file(activity, file, std::format("Read {} cinematic frames", cinematic_frames.size()));
+        log_file(activity, file, "Read {} cinematic frames", cinematic_frames.size());
         return cinematic_frames;
     }
 
@@ -140,7 +146,7 @@ namespace trlevel
         callbacks.on_progress("Reading demo data");
         log_file(activity, file, "Reading demo data");
         auto demo_data = read_vector<uint16_t, uint8_t>(file);
-        log_file(activity, file, std::format("Read {} demo data", demo_data.size()));
+        log_file(activity, file, "Read {} demo data", demo_data.size());
         return demo_data;
     }
 
@@ -150,7 +156,7 @@ namespace trlevel
         log_file(activity, file, "Reading entities");
         // TR4 entity is in here, OCB is not set but goes into intensity2 (convert later).
         const auto entities = read_vector<uint32_t, tr2_entity>(file);
-        log_file(activity, file, std::format("Read {} entities", entities.size()));
+        log_file(activity, file, "Read {} entities", entities.size());
         return entities;
     }
 
@@ -159,7 +165,7 @@ namespace trlevel
         callbacks.on_progress("Reading floor data");
         log_file(activity, file, "Reading floor data");
         const auto floor_data = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} floor data", floor_data.size()));
+        log_file(activity, file, "Read {} floor data", floor_data.size());
         return floor_data;
     }
 
@@ -168,15 +174,15 @@ namespace trlevel
         callbacks.on_progress("Reading flyby cameras");
         log_file(activity, file, "Reading flyby cameras");
         std::vector<tr4_flyby_camera> flyby_cameras = read_vector<uint32_t, tr4_flyby_camera>(file);
-        log_file(activity, file, std::format("Read {} flyby cameras", flyby_cameras.size()));
+        log_file(activity, file, "Read {} flyby cameras", flyby_cameras.size());
         return flyby_cameras;
     }
 
     void read_fog_bulbs_tr5_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room, uint32_t num_fog_bulbs)
     {
-        log_file(activity, file, std::format("Reading {} fog bulbs", num_fog_bulbs));
+        log_file(activity, file, "Reading {} fog bulbs", num_fog_bulbs);
         auto fog_bulbs = read_vector<tr5_fog_bulb>(file, num_fog_bulbs);
-        log_file(activity, file, std::format("Read {} fog bulbs", fog_bulbs.size()));
+        log_file(activity, file, "Read {} fog bulbs", fog_bulbs.size());
 
         log_file(activity, file, "Converting lights to fog bulbs");
         uint32_t fog_bulb = 0;
@@ -196,7 +202,7 @@ namespace trlevel
         callbacks.on_progress("Reading frames");
         log_file(activity, file, "Reading frames");
         const auto frames = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} frames", frames.size()));
+        log_file(activity, file, "Read {} frames", frames.size());
         return frames;
     }
 
@@ -214,7 +220,7 @@ namespace trlevel
         callbacks.on_progress("Reading mesh data");
         log_file(activity, file, "Reading mesh data");
         const auto mesh_data = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} mesh data", mesh_data.size()));
+        log_file(activity, file, "Read {} mesh data", mesh_data.size());
         return mesh_data;
     }
 
@@ -223,7 +229,7 @@ namespace trlevel
         callbacks.on_progress("Reading mesh pointers");
         log_file(activity, file, "Reading mesh pointers");
         const auto mesh_pointers = read_vector<uint32_t, uint32_t>(file);
-        log_file(activity, file, std::format("Read {} mesh pointers", mesh_pointers.size()));
+        log_file(activity, file, "Read {} mesh pointers", mesh_pointers.size());
         return mesh_pointers;
     }
 
@@ -232,7 +238,7 @@ namespace trlevel
         callbacks.on_progress("Reading mesh trees");
         log_file(activity, file, "Reading mesh trees");
         const auto meshtree = read_vector<uint32_t, uint32_t>(file);
-        log_file(activity, file, std::format("Read {} mesh trees", meshtree.size()));
+        log_file(activity, file, "Read {} mesh trees", meshtree.size());
         return meshtree;
     }
 
@@ -241,7 +247,7 @@ namespace trlevel
         callbacks.on_progress("Reading models");
         log_file(activity, file, "Reading models");
         auto models = read_vector<uint32_t, tr_model>(file);
-        log_file(activity, file, std::format("Read {} models", models.size()));
+        log_file(activity, file, "Read {} models", models.size());
         return models;
     }
 
@@ -250,7 +256,7 @@ namespace trlevel
         callbacks.on_progress("Reading models");
         log_file(activity, file, "Reading models");
         const auto models = convert_models(read_vector<uint32_t, tr5_model>(file));
-        log_file(activity, file, std::format("Read {} models", models.size()));
+        log_file(activity, file, "Read {} models", models.size());
         return models;
     }
 
@@ -258,7 +264,7 @@ namespace trlevel
     {
         log_file(activity, file, "Reading number of data words");
         uint32_t NumDataWords = read<uint32_t>(file);
-        log_file(activity, file, std::format("{} data words to process", NumDataWords));
+        log_file(activity, file, "{} data words to process", NumDataWords);
         return NumDataWords;
     }
 
@@ -267,7 +273,7 @@ namespace trlevel
         callbacks.on_progress("Reading object textures");
         log_file(activity, file, "Reading object textures");
         auto object_textures = read_vector<uint32_t, tr_object_texture>(file);
-        log_file(activity, file, std::format("Read {} object textures", object_textures.size()));
+        log_file(activity, file, "Read {} object textures", object_textures.size());
         return object_textures;
     }
 
@@ -276,7 +282,7 @@ namespace trlevel
         callbacks.on_progress("Reading object textures");
         log_file(activity, file, "Reading object textures");
         const auto object_textures = convert_object_textures(read_vector<uint32_t, tr4_object_texture>(file));
-        log_file(activity, file, std::format("Read {} object textures", object_textures.size()));
+        log_file(activity, file, "Read {} object textures", object_textures.size());
         return object_textures;
     }
 
@@ -285,7 +291,7 @@ namespace trlevel
         callbacks.on_progress("Reading object textures");
         log_file(activity, file, "Reading object textures");
         const auto object_textures = convert_object_textures(read_vector<uint32_t, tr5_object_texture>(file));
-        log_file(activity, file, std::format("Read {} object textures", object_textures.size()));
+        log_file(activity, file, "Read {} object textures", object_textures.size());
         return object_textures;
     }
 
@@ -294,7 +300,7 @@ namespace trlevel
         callbacks.on_progress("Reading overlaps");
         log_file(activity, file, "Reading overlaps");
         std::vector<uint16_t> overlaps = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} overlaps", overlaps.size()));
+        log_file(activity, file, "Read {} overlaps", overlaps.size());
         return overlaps;
     }
 
@@ -302,35 +308,35 @@ namespace trlevel
     {
         log_file(activity, file, "Reading alternate group");
         room.alternate_group = read<uint8_t>(file);
-        log_file(activity, file, std::format("Read alternate group: {}", room.alternate_group));
+        log_file(activity, file, "Read alternate group: {}", room.alternate_group);
     }
 
     void read_room_alternate_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading alternate room");
         room.alternate_room = read<int16_t>(file);
-        log_file(activity, file, std::format("Read alternate room: {}", room.alternate_room));
+        log_file(activity, file, "Read alternate room: {}", room.alternate_room);
     }
 
     void read_room_ambient_intensity_1(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading ambient intensity 1");
         room.ambient_intensity_1 = read<int16_t>(file);
-        log_file(activity, file, std::format("Read ambient intensity 1: {}", room.ambient_intensity_1));
+        log_file(activity, file, "Read ambient intensity 1: {}", room.ambient_intensity_1);
     }
 
     void read_room_colour(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading room colour");
         room.colour = read<uint32_t>(file);
-        log_file(activity, file, std::format("Read room colour {:X}", room.colour));
+        log_file(activity, file, "Read room colour {:X}", room.colour);
     }
 
     void read_room_flags(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading flags");
         room.flags = read<int16_t>(file);
-        log_file(activity, file, std::format("Read flags: {:X}", room.flags));
+        log_file(activity, file, "Read flags: {:X}", room.flags);
     }
 
     tr_room_info read_room_info(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file)
@@ -343,7 +349,7 @@ namespace trlevel
 
     std::vector<tr5_room_layer> read_room_layers(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const tr5_room_header& header)
     {
-        log_file(activity, file, std::format("Reading {} layers", header.num_layers));
+        log_file(activity, file, "Reading {} layers", header.num_layers);
         return read_vector<tr5_room_layer>(file, header.num_layers);
     }
 
@@ -351,97 +357,97 @@ namespace trlevel
     {
         log_file(activity, file, "Reading light mode");
         room.light_mode = read<int16_t>(file);
-        log_file(activity, file, std::format("Read light mode: {}", room.light_mode));
+        log_file(activity, file, "Read light mode: {}", room.light_mode);
     }
 
     void read_room_lights_tr5_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room, uint16_t num_lights)
     {
-        log_file(activity, file, std::format("Reading {} lights", num_lights));
+        log_file(activity, file, "Reading {} lights", num_lights);
         room.lights = convert_lights(read_vector<tr5_room_light>(file, num_lights));
-        log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+        log_file(activity, file, "Read {} lights", room.lights.size());
     }
 
     void read_room_portals(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading portals");
         room.portals = read_vector<uint16_t, tr_room_portal>(file);
-        log_file(activity, file, std::format("Read {} portals", room.portals.size()));
+        log_file(activity, file, "Read {} portals", room.portals.size());
     }
 
     void read_room_rectangles(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading rectangles");
         room.data.rectangles = convert_rectangles(read_vector<int16_t, tr_face4>(file));
-        log_file(activity, file, std::format("Read {} rectangles", room.data.rectangles.size()));
+        log_file(activity, file, "Read {} rectangles", room.data.rectangles.size());
     }
 
     void read_room_reverb_info(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading reverb info");
         room.reverb_info = read<uint8_t>(file);
-        log_file(activity, file, std::format("Read reverb info: {}", room.reverb_info));
+        log_file(activity, file, "Read reverb info: {}", room.reverb_info);
     }
 
     void read_room_sectors(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading number of z sectors");
         room.num_z_sectors = read<uint16_t>(file);
-        log_file(activity, file, std::format("There are {} z sectors", room.num_z_sectors));
+        log_file(activity, file, "There are {} z sectors", room.num_z_sectors);
         log_file(activity, file, "Reading number of x sectors");
         room.num_x_sectors = read<uint16_t>(file);
-        log_file(activity, file, std::format("There are {} x sectors", room.num_x_sectors));
-        log_file(activity, file, std::format("Reading {} sectors", room.num_z_sectors * room.num_x_sectors));
+        log_file(activity, file, "There are {} x sectors", room.num_x_sectors);
+        log_file(activity, file, "Reading {} sectors", room.num_z_sectors * room.num_x_sectors);
         room.sector_list = read_vector<tr_room_sector>(file, room.num_z_sectors * room.num_x_sectors);
-        log_file(activity, file, std::format("Read {} sectors", room.sector_list.size()));
+        log_file(activity, file, "Read {} sectors", room.sector_list.size());
     }
 
     void read_room_sectors_tr5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
-        log_file(activity, file, std::format("Reading {} sectors ({} x {})", room.num_x_sectors * room.num_z_sectors, room.num_x_sectors, room.num_z_sectors));
+        log_file(activity, file, "Reading {} sectors ({} x {})", room.num_x_sectors * room.num_z_sectors, room.num_x_sectors, room.num_z_sectors);
         room.sector_list = read_vector<tr_room_sector>(file, room.num_z_sectors * room.num_x_sectors);
-        log_file(activity, file, std::format("Read {} sectors", room.sector_list.size()));
+        log_file(activity, file, "Read {} sectors", room.sector_list.size());
     }
 
     void read_room_sprites(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading sprites");
         room.data.sprites = read_vector<int16_t, tr_room_sprite>(file);
-        log_file(activity, file, std::format("Read {} sprites", room.data.sprites.size()));
+        log_file(activity, file, "Read {} sprites", room.data.sprites.size());
     }
 
     void read_room_static_meshes(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading static meshes");
         room.static_meshes = read_vector<uint16_t, tr3_room_staticmesh>(file);
-        log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
     }
 
     void read_room_static_meshes_tr5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room, const tr5_room_header& header)
     {
-        log_file(activity, file, std::format("Reading {} static meshes", header.num_static_meshes));
+        log_file(activity, file, "Reading {} static meshes", header.num_static_meshes);
         room.static_meshes = read_vector<tr3_room_staticmesh>(file, header.num_static_meshes);
-        log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
     }
 
     void read_room_triangles(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading triangles");
         room.data.triangles = convert_triangles(read_vector<int16_t, tr_face3>(file));
-        log_file(activity, file, std::format("Read {} triangles", room.data.triangles.size()));
+        log_file(activity, file, "Read {} triangles", room.data.triangles.size());
     }
 
     void read_room_vertices_tr3_4(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading vertices");
         room.data.vertices = convert_vertices(read_vector<int16_t, tr3_room_vertex>(file));
-        log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+        log_file(activity, file, "Read {} vertices", room.data.vertices.size());
     }
 
     void read_room_water_scheme(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading water scheme");
         room.water_scheme = read<uint8_t>(file);
-        log_file(activity, file, std::format("Read water scheme: {}", room.water_scheme));
+        log_file(activity, file, "Read water scheme: {}", room.water_scheme);
     }
 
     std::vector<uint32_t> read_sample_indices(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks)
@@ -449,7 +455,7 @@ namespace trlevel
         callbacks.on_progress("Reading sample indices");
         log_file(activity, file, "Reading sample indices");
         auto sample_indices = read_vector<uint32_t, uint32_t>(file);
-        log_file(activity, file, std::format("Read {} sample indices", sample_indices.size()));
+        log_file(activity, file, "Read {} sample indices", sample_indices.size());
         return sample_indices;
     }
 
@@ -458,7 +464,7 @@ namespace trlevel
         callbacks.on_progress("Reading sound data");
         log_file(activity, file, "Reading sound data");
         const auto sound_data = read_vector<int32_t, uint8_t>(file);
-        log_file(activity, file, std::format("Read {} sound data", sound_data.size()));
+        log_file(activity, file, "Read {} sound data", sound_data.size());
         return sound_data;
     }
 
@@ -467,7 +473,7 @@ namespace trlevel
         callbacks.on_progress("Reading sound details");
         log_file(activity, file, "Reading sound details");
         auto sound_details = read_vector<uint32_t, tr_x_sound_details>(file);
-        log_file(activity, file, std::format("Read {} sound details", sound_details.size()));
+        log_file(activity, file, "Read {} sound details", sound_details.size());
         return sound_details;
     }
 
@@ -491,7 +497,7 @@ namespace trlevel
         callbacks.on_progress("Reading sound sources");
         log_file(activity, file, "Reading sound sources");
         const auto sound_sources = read_vector<uint32_t, tr_sound_source>(file);
-        log_file(activity, file, std::format("Read {} sound sources", sound_sources.size()));
+        log_file(activity, file, "Read {} sound sources", sound_sources.size());
         return sound_sources;
     }
 
@@ -500,7 +506,7 @@ namespace trlevel
         callbacks.on_progress("Reading sprite sequences");
         log_file(activity, file, "Reading sprite sequences");
         const auto sprite_sequences = read_vector<uint32_t, tr_sprite_sequence>(file);
-        log_file(activity, file, std::format("Read {} sprite sequences", sprite_sequences.size()));
+        log_file(activity, file, "Read {} sprite sequences", sprite_sequences.size());
         return sprite_sequences;
     }
 
@@ -509,7 +515,7 @@ namespace trlevel
         callbacks.on_progress("Reading sprite textures");
         log_file(activity, file, "Reading sprite textures");
         auto sprite_textures = read_vector<uint32_t, tr_sprite_texture>(file);
-        log_file(activity, file, std::format("Read {} sprite textures", sprite_textures.size()));
+        log_file(activity, file, "Read {} sprite textures", sprite_textures.size());
         return sprite_textures;
     }
 
@@ -518,7 +524,7 @@ namespace trlevel
         callbacks.on_progress("Reading state changes");
         log_file(activity, file, "Reading state changes");
         const auto state_changes = read_vector<uint32_t, tr_state_change>(file);
-        log_file(activity, file, std::format("Read {} state changes", state_changes.size()));
+        log_file(activity, file, "Read {} state changes", state_changes.size());
         return state_changes;
     }
 
@@ -527,7 +533,7 @@ namespace trlevel
         callbacks.on_progress("Reading static meshes");
         log_file(activity, file, "Reading static meshes");
         auto static_meshes = read_vector<uint32_t, tr_staticmesh>(file);
-        log_file(activity, file, std::format("Read {} static meshes", static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", static_meshes.size());
         std::unordered_map<uint32_t, tr_staticmesh> mesh_map;
         for (const auto& mesh : static_meshes)
         {
@@ -543,27 +549,21 @@ namespace trlevel
 
         uint32_t num_textiles = read<uint32_t>(file);
         callbacks.on_progress(std::format("Skipping {} 8-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Skipping {} 8-bit textiles", num_textiles));
+        log_file(activity, file, "Skipping {} 8-bit textiles", num_textiles);
         skip(file, sizeof(tr_textile8) * num_textiles);
 
         callbacks.on_progress(std::format("Reading {} 16-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Reading {} 16-bit textiles", num_textiles));
+        log_file(activity, file, "Reading {} 16-bit textiles", num_textiles);
         stream_vector<tr_textile16>(file, num_textiles, [&](auto&& t) { callbacks.on_textile(convert_textile(t)); });
         return num_textiles;
     }
 
-    uint32_t read_textiles_tr4_5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks)
+    void read_textiles_tr4_5(trview::Activity& activity, CompressedTextiles& textiles, const ILevel::LoadCallbacks& callbacks)
     {
-        log_file(activity, file, "Reading textile counts");
-        uint16_t num_room_textiles = read<uint16_t>(file);
-        uint16_t num_obj_textiles = read<uint16_t>(file);
-        uint16_t num_bump_textiles = read<uint16_t>(file);
-        log_file(activity, file, std::format("Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles));
-        const auto num_textiles = num_room_textiles + num_obj_textiles + num_bump_textiles;
-
+        const auto num_textiles = textiles.num_textiles;
         callbacks.on_progress(std::format("Reading {} 32-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Reading {} 32-bit textiles", num_textiles));
-        auto textile32 = read_vector_compressed<tr_textile32>(file, num_textiles);
+        activity.log(std::format("Reading {} 32-bit textiles", num_textiles));
+        auto textile32 = read_vector_compressed<tr_textile32>(textiles.textile32, num_textiles);
 
         constexpr auto is_blank = [](const auto& t)
             {
@@ -582,8 +582,8 @@ namespace trlevel
             activity.log(trview::Message::Status::Warning, "32-bit textiles were all blank, discarding");
             textile32 = {};
             callbacks.on_progress(std::format("Reading {} 16-bit textiles", num_textiles));
-            log_file(activity, file, std::format("Reading {} 16-bit textiles", num_textiles));
-            auto textile16 = read_vector_compressed<tr_textile16>(file, num_textiles);
+            activity.log(std::format("Reading {} 16-bit textiles", num_textiles));
+            auto textile16 = read_vector_compressed<tr_textile16>(textiles.textile16, num_textiles);
 
             for (const auto& textile : textile16)
             {
@@ -597,19 +597,41 @@ namespace trlevel
                 callbacks.on_textile(convert_textile(textile));
             }
             textile32 = {};
-
-            callbacks.on_progress(std::format("Skipping {} 16-bit textiles", num_textiles));
-            log_file(activity, file, std::format("Skipping {} 16-bit textiles", num_textiles));
-            skip_vector_compressed(file);
+            activity.log(std::format("Skipped {} 16-bit textiles", num_textiles));
         }
 
-        log_file(activity, file, "Reading misc textiles");
-        const auto textile32_misc = read_vector_compressed<tr_textile32>(file, 2);
+        activity.log("Reading misc textiles");
+        const auto textile32_misc = read_vector_compressed<tr_textile32>(textiles.textile32_misc, 2);
         for (const auto& textile : textile32_misc)
         {
             callbacks.on_textile(convert_textile(textile));
         }
-        return num_textiles;
+    }
+
+    CompressedTextiles start_textiles_tr4_5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks)
+    {
+        log_file(activity, file, "Reading textile counts");
+        uint16_t num_room_textiles = read<uint16_t>(file);
+        uint16_t num_obj_textiles = read<uint16_t>(file);
+        uint16_t num_bump_textiles = read<uint16_t>(file);
+        log_file(activity, file, "Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles);
+
+        callbacks.on_progress("Decompressing textiles");
+        log_file(activity, file, "Finding compressed 32-bit textiles");
+        const auto textile32 = find_compressed(file);
+        log_file(activity, file, "Finding compressed 16-bit textiles");
+        const auto textile16 = find_compressed(file);
+        log_file(activity, file, "Finding compressed misc textiles");
+        const auto textile32_misc = find_compressed(file);
+
+        // The 16-bit textiles are only needed if the 32-bit textiles turn out to be blank, so only inflate them on demand.
+        return
+        {
+            .num_textiles = static_cast<uint32_t>(num_room_textiles + num_obj_textiles + num_bump_textiles),
+            .textile32 = std::async(std::launch::async, inflate_chunk, textile32),
+            .textile16 = std::async(std::launch::deferred, inflate_chunk, textile16),
+            .textile32_misc = std::async(std::launch::async, inflate_chunk, textile32_misc)
+        };
     }
 
     void read_zones(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks, uint32_t num_boxes)
@@ -617,7 +639,18 @@ namespace trlevel
         callbacks.on_progress("Reading zones");
         log_file(activity, file, "Reading zones");
         std::vector<int16_t> zones = read_vector<int16_t>(file, num_boxes * 10);
-        log_file(activity, file, std::format("Read {} zones", zones.size()));
+        log_file(activity, file, "Read {} zones", zones.size());
+    }
+
+    void skip_room_data_tr1_4(std::basic_ispanstream<uint8_t>& file)
+    {
+        skip(file, static_cast<uint32_t>(sizeof(tr1_4_room_info)));
+        const uint32_t num_data_words = read<uint32_t>(file);
+        skip(file, static_cast<uint32_t>(num_data_words * sizeof(uint16_t)));
+        skip_vector<uint16_t, tr_room_portal>(file);
+        const uint16_t num_z_sectors = read<uint16_t>(file);
+        const uint16_t num_x_sectors = read<uint16_t>(file);
+        skip(file, static_cast<uint32_t>(num_z_sectors * num_x_sectors * sizeof(tr_room_sector)));
     }
 
     void skip_xela(std::basic_ispanstream<uint8_t>& file)
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <concepts>
 #include <cstdint>
+#include <future>
+#include <span>
 #include <unordered_map>
 #include <vector>
 #include <spanstream>
@@ -15,6 +18,22 @@ namespace trlevel
 {
     /* Common file reading functions */
 
+    /// A zlib compressed block, still in the level file buffer.
+    struct CompressedChunk
+    {
+        uint32_t uncompressed_size{ 0u };
+        std::span<const uint8_t> data;
+    };
+
+    /// TR4/5 textiles that are being inflated on worker threads.
+    struct CompressedTextiles
+    {
+        uint32_t num_textiles{ 0u };
+        std::future<std::vector<uint8_t>> textile32;
+        std::future<std::vector<uint8_t>> textile16;
+        std::future<std::vector<uint8_t>> textile32_misc;
+    };
+
     template <typename T>
     T peek(std::basic_ispanstream<uint8_t>& file);
 
@@ -25,10 +44,20 @@ namespace trlevel
     T read(std::basic_ispanstream<uint8_t>& file);
 
     std::vector<uint8_t> read_compressed(std::basic_ispanstream<uint8_t>& file);
+    CompressedChunk find_compressed(std::basic_ispanstream<uint8_t>& file);
+    std::vector<uint8_t> inflate_chunk(const CompressedChunk& chunk);
 
     template < typename DataType >
     std::vector<DataType> read_vector_compressed(std::basic_ispanstream<uint8_t>& file, uint32_t elements);
 
+    template < typename DataType >
+    std::vector<DataType> read_vector_compressed(std::future<std::vector<uint8_t>>& inflated, uint32_t elements);
+
+    /// Copies the next out.size() elements straight from the file's buffer. If there is not enough data
+    /// failbit is set on the file instead and out is left unchanged.
+    template < typename DataType >
+    void read_into(std::basic_ispanstream<uint8_t>& file, std::span<DataType> out);
+
     template < typename DataType, typename SizeType >
     std::vector<DataType> read_vector(std::basic_ispanstream<uint8_t>& file, SizeType size);
 
@@ -36,6 +65,11 @@ namespace trlevel
     std::vector<DataType> read_vector(std::basic_ispanstream<uint8_t>& file);
 
     void skip(std::basic_ispanstream<uint8_t>& file, uint32_t size);
+    /// Returns a view of the next size bytes of the file's buffer and moves past them.
+    std::span<const uint8_t> read_span(std::basic_ispanstream<uint8_t>& file, uint32_t size);
+
+    template < typename SizeType, typename DataType >
+    void skip_vector(std::basic_ispanstream<uint8_t>& file);
 
     template < typename DataType, typename SizeType >
     void stream_vector(std::basic_ispanstream<uint8_t>& file, SizeType size, const std::function<void(const DataType&)>& out);
@@ -44,6 +78,9 @@ namespace trlevel
 
     void log_file(trview::Activity& activity, std::basic_ispanstream<uint8_t>& stream, const std::string& text);
     void log_file(trview::Activity& activity, std::istream& stream, const std::string& text);
+    /// Records a trace event rather than a formatted message. The event must be a string literal.
+    template <std::integral... Args>
+    void log_file(trview::Activity& activity, std::basic_ispanstream<uint8_t>& stream, const char* event, Args... args);
 
     /* Shared level data reading functions */
 
@@ -97,6 +134,10 @@ namespace trlevel
     void read_room_water_scheme(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room);
     template <typename size_type>
     std::vector<tr3_room> read_rooms(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks, std::function<void(trview::Activity& activity, std::basic_ispanstream<uint8_t>&, tr3_room&)> load_function);
+    /// Reads rooms using skip_function to find where each room starts. If parallel room loading has been requested the rooms are then
+    /// decoded concurrently, otherwise this is the same as the serial read_rooms.
+    template <typename size_type>
+    std::vector<tr3_room> read_rooms(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks, std::function<void(trview::Activity& activity, std::basic_ispanstream<uint8_t>&, tr3_room&)> load_function, std::function<void(std::basic_ispanstream<uint8_t>&)> skip_function);
     std::vector<uint32_t> read_sample_indices(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
     std::vector<uint8_t> read_sound_data(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
     std::vector<tr_x_sound_details> read_sound_details(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
@@ -108,8 +149,10 @@ namespace trlevel
     std::vector<tr_state_change> read_state_changes(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
     std::unordered_map<uint32_t, tr_staticmesh> read_static_meshes(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
     uint32_t read_textiles(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
-    uint32_t read_textiles_tr4_5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
+    void read_textiles_tr4_5(trview::Activity& activity, CompressedTextiles& textiles, const ILevel::LoadCallbacks& callbacks);
+    CompressedTextiles start_textiles_tr4_5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks);
     void read_zones(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks, uint32_t num_boxes);
+    void skip_room_data_tr1_4(std::basic_ispanstream<uint8_t>& file);
     void skip_xela(std::basic_ispanstream<uint8_t>& file);
 }
 
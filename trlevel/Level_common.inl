@@ -1,7 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <bit>
+#include <cstring>
+#include <execution>
+#include <numeric>
 #include <span>
+#include <type_traits>
 
 namespace trlevel
 {
@@ -29,13 +34,41 @@ namespace trlevel
         return value;
     }
 
+    template < typename DataType >
+    void read_into(std::basic_ispanstream<uint8_t>& file, std::span<DataType> out)
+    {
+        static_assert(std::is_trivially_copyable_v<DataType>, "read_into requires a trivially copyable type");
+
+        const auto at = file.tellg();
+        const auto buffer = file.span();
+        const std::size_t bytes = out.size_bytes();
+        if (at < 0 || buffer.size() - static_cast<std::size_t>(at) < bytes)
+        {
+            file.setstate(std::ios::failbit);
+            return;
+        }
+
+        if (bytes > 0)
+        {
+            std::memcpy(out.data(), buffer.data() + static_cast<std::size_t>(at), bytes);
+            file.seekg(static_cast<std::streamoff>(bytes), std::ios::cur);
+        }
+    }
+
     template < typename DataType, typename SizeType >
     std::vector<DataType> read_vector(std::basic_ispanstream<uint8_t>& file, SizeType size)
     {
         std::vector<DataType> data(size);
-        for (SizeType i = 0; i < size; ++i)
+        if constexpr (std::is_trivially_copyable_v<DataType>)
+        {
+            read_into(file, std::span(data));
+        }
+        else
         {
-            read<DataType>(file, data[i]);
+            for (SizeType i = 0; i < size; ++i)
+            {
+                read<DataType>(file, data[i]);
+            }
         }
         return data;
     }
@@ -47,6 +80,19 @@ namespace trlevel
         return read_vector<DataType, SizeType>(file, size);
     }
 
+    template <std::integral... Args>
+    void log_file(trview::Activity& activity, std::basic_ispanstream<uint8_t>& stream, const char* event, Args... args)
+    {
+        activity.trace(static_cast<uint64_t>(stream.tellg()), event, args...);
+    }
+
+    template < typename SizeType, typename DataType >
+    void skip_vector(std::basic_ispanstream<uint8_t>& file)
+    {
+        const auto size = read<SizeType>(file);
+        skip(file, static_cast<uint32_t>(size * sizeof(DataType)));
+    }
+
     template < typename DataType >
     std::vector<DataType> read_vector_compressed(std::basic_ispanstream<uint8_t>& file, uint32_t elements)
     {
@@ -56,6 +102,15 @@ namespace trlevel
         return read_vector<DataType>(data_stream, elements);
     }
 
+    template < typename DataType >
+    std::vector<DataType> read_vector_compressed(std::future<std::vector<uint8_t>>& inflated, uint32_t elements)
+    {
+        const auto uncompressed_data = inflated.get();
+        std::basic_ispanstream<uint8_t> data_stream{ std::span(uncompressed_data) };
+        data_stream.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
+        return read_vector<DataType>(data_stream, elements);
+    }
+
     template <typename size_type>
     std::vector<tr3_room> read_rooms(
         trview::Activity& activity,
@@ -69,22 +124,106 @@ namespace trlevel
         const size_type num_rooms = read<size_type>(file);
 
         callbacks.on_progress(std::format("Reading {} rooms", num_rooms));
-        log_file(activity, file, std::format("Reading {} rooms", num_rooms));
+        log_file(activity, file, "Reading {} rooms", num_rooms);
         for (auto i = 0u; i < num_rooms; ++i)
         {
             trview::Activity room_activity(activity, std::format("Room {}", i));
             callbacks.on_progress(std::format("Reading room {}", i));
-            log_file(room_activity, file, std::format("Reading room {}", i));
+            log_file(room_activity, file, "Reading room {}", i);
             tr3_room room;
             load_function(room_activity, file, room);
 
-            log_file(room_activity, file, std::format("Read room {}", i));
+            log_file(room_activity, file, "Read room {}", i);
             rooms.push_back(room);
         }
 
         return rooms;
     }
 
+    template <typename size_type>
+    std::vector<tr3_room> read_rooms(
+        trview::Activity& activity,
+        std::basic_ispanstream<uint8_t>& file,
+        const ILevel::LoadCallbacks& callbacks,
+        std::function<void(trview::Activity& activity, std::basic_ispanstream<uint8_t>&, tr3_room&)> load_function,
+        std::function<void(std::basic_ispanstream<uint8_t>&)> skip_function)
+    {
+        if (!callbacks.parallel_rooms)
+        {
+            return read_rooms<size_type>(activity, file, callbacks, load_function);
+        }
+
+        const auto rooms_start = file.tellg();
+        const auto read_serial = [&]()
+            {
+                file.clear();
+                file.seekg(rooms_start);
+                return read_rooms<size_type>(activity, file, callbacks, load_function);
+            };
+
+        // Find the start of each room so that they can be decoded independently.
+        std::vector<std::streamoff> offsets;
+        try
+        {
+            log_file(activity, file, "Reading number of rooms");
+            const size_type num_rooms = read<size_type>(file);
+            callbacks.on_progress(std::format("Scanning {} rooms", num_rooms));
+            log_file(activity, file, "Scanning {} rooms", num_rooms);
+            offsets.reserve(num_rooms + 1);
+            for (auto i = 0u; i < num_rooms; ++i)
+            {
+                offsets.push_back(file.tellg());
+                skip_function(file);
+            }
+            offsets.push_back(file.tellg());
+        }
+        catch (const std::exception& e)
+        {
+            log_file(activity, file, std::format("Failed to scan rooms ({}), reading serially", e.what()));
+            return read_serial();
+        }
+
+        const std::size_t num_rooms = offsets.size() - 1;
+        callbacks.on_progress(std::format("Reading {} rooms", num_rooms));
+        log_file(activity, file, "Reading {} rooms", num_rooms);
+
+        std::vector<tr3_room> rooms(num_rooms);
+        std::vector<uint32_t> indices(num_rooms);
+        std::iota(indices.begin(), indices.end(), 0u);
+        std::atomic<bool> failed{ false };
+        std::for_each(std::execution::par, indices.begin(), indices.end(), [&](uint32_t i)
+            {
+                try
+                {
+                    std::basic_ispanstream<uint8_t> room_file{ file.span() };
+                    room_file.exceptions(file.exceptions());
+                    room_file.seekg(offsets[i]);
+                    trview::Activity room_activity(activity, std::format("Room {}", i));
+                    log_file(room_activity, room_file, "Reading room {}", i);
+                    load_function(room_activity, room_file, rooms[i]);
+                    log_file(room_activity, room_file, "Read room {}", i);
+                    // A room that doesn't end where the scan said it would means the scan and the loader disagree.
+                    if (room_file.tellg() != offsets[i + 1])
+                    {
+                        failed = true;
+                    }
+                }
+                catch (...)
+                {
+                    failed = true;
+                }
+            });
+
+        if (failed)
+        {
+            log_file(activity, file, "Parallel room read did not match room scan, reading serially");
+            return read_serial();
+        }
+
+        file.seekg(offsets.back());
+        return rooms;
+    }
+
     template < typename DataType, typename SizeType >
     void stream_vector(std::basic_ispanstream<uint8_t>& file, SizeType size, const std::function<void(const DataType&)>& out)
     {
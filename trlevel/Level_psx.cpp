@@ -2,6 +2,7 @@
 #include "Level_common.h"
 #include "Level.h"
 #include "IPack.h"
+#include "TextileConversion.h"
 
 #include <trview.common/Algorithms.h>
 
@@ -39,10 +40,9 @@ namespace trlevel
     /// <summary>
     /// Based on vag2wav from http://unhaut.epizy.com/psxsdk/
     /// </summary>
-    std::vector<uint8_t> convert_vag_to_wav(const std::vector<uint8_t>& bytes, uint32_t sample_frequency)
+    std::vector<uint8_t> convert_vag_to_wav(std::span<const uint8_t> bytes, uint32_t sample_frequency)
     {
-        std::span span{ &bytes[0], bytes.size() };
-        std::basic_ispanstream<uint8_t> in_stream{ span };
+        std::basic_ispanstream<uint8_t> in_stream{ bytes };
         in_stream.exceptions(std::istream::failbit | std::istream::badbit | std::istream::eofbit);
         in_stream.seekg(16, std::ios::beg);
 
@@ -141,13 +141,14 @@ namespace trlevel
         file.seekg(sample_start + 510, std::ios::beg);
         skip(file, 4);
 
+        _sample_decoder = [=](auto&& bytes) { return convert_vag_to_wav(bytes, sample_frequency); };
         for (uint32_t s = 0; s < sample_sizes.size(); ++s)
         {
             callbacks.on_progress(std::format("Loading sound {} of {}", s, sample_sizes.size()));
             log_file(activity, file, std::format("Loading sound {} of {}", s, sample_sizes.size()));
             if (sample_sizes[s] > 0)
             {
-                _sound_samples.push_back(convert_vag_to_wav(read_vector<uint8_t>(file, sample_sizes[s]), sample_frequency));
+                add_sound_sample(read_vector<uint8_t>(file, sample_sizes[s]));
             }
         }
 
@@ -160,7 +161,8 @@ namespace trlevel
         log_file(activity, file, "Reading sounds");
 
         const auto sound_offsets = read_vector<uint32_t, uint32_t>(file);
-        const auto sound_data = read_vector<uint32_t, byte>(file);
+        _sound_data = read_vector<uint32_t, byte>(file);
+        _sample_decoder = [=](auto&& bytes) { return convert_vag_to_wav(bytes, sample_frequency); };
 
         for (uint32_t s = 0; s < sound_offsets.size(); ++s)
         {
@@ -168,9 +170,9 @@ namespace trlevel
             log_file(activity, file, std::format("Loading sound {} of {}", s, sound_offsets.size()));
             const std::size_t offset = sound_offsets[s];
             const std::size_t size = s == sound_offsets.size() - 1 ?
-                sound_data.size() - offset - 1 :
+                _sound_data.size() - offset - 1 :
                 sound_offsets[s + 1] - offset;
-            _sound_samples.push_back(convert_vag_to_wav({ &sound_data[offset], &sound_data[offset + size] }, sample_frequency));
+            _sound_samples.push_back(std::span<const uint8_t>(_sound_data).subspan(offset, size));
         }
 
         log_file(activity, file, std::format("Read {} sounds", sound_offsets.size()));
@@ -209,42 +211,19 @@ namespace trlevel
         };
     }
 
-    uint16_t Level::convert_textile4(uint16_t tile, uint16_t clut_id)
+    void Level::pack_textile4()
     {
-        // Check if we've already converted this tile + clut
-        for (auto i = _converted_t16.begin(); i < _converted_t16.end(); ++i)
-        {
-            if (i->first == tile && i->second == clut_id)
-            {
-                return static_cast<uint16_t>(std::distance(_converted_t16.begin(), i));
-            }
-        }
-        // If not, create new conversion
-        _converted_t16.push_back(std::make_pair(tile, clut_id));
-
-        tr_textile16& tile16 = _textile16.emplace_back();
-        if (tile < _textile4.size() && clut_id < _clut.size())
-        {
-            const tr_textile4& tile4 = _textile4[tile];
-            const tr_clut& clut = _clut[clut_id];
-            for (int x = 0; x < 256; ++x)
+        _textile4_atlas.pack(_textile16, [&](uint16_t tile, uint16_t clut_id, uint32_t x, uint32_t y, std::span<uint16_t> output)
             {
-                for (int y = 0; y < 256; ++y)
+                if (tile >= _textile4.size() || clut_id >= _clut.size())
                 {
-                    const std::size_t pixel = (y * 256 + x);
-                    const tr_colorindex4& index = tile4.Tile[pixel / 2];
-                    const tr_rgba5551& colour = clut.Colour[(x % 2) ? index.b : index.a];
-                    tile16.Tile[pixel] = (colour.Alpha << 15) | (colour.Red << 10) | (colour.Green << 5) | colour.Blue;
+                    std::ranges::fill(output, static_cast<uint16_t>(0));
+                    return;
                 }
-            }
-        }
-        else
-        {
-            memset(tile16.Tile, 0, sizeof(tile16.Tile));
-        }
 
+                expand_textile4(_textile4[tile].Tile, y * 256 + x, _clut[clut_id], output);
+            });
         _num_textiles = static_cast<uint32_t>(_textile16.size());
-        return static_cast<uint16_t>(_textile16.size() - 1);
     }
 
     uint16_t attribute_for_object_texture(const tr_object_texture_psx& texture, const tr_clut& clut)
@@ -258,9 +237,9 @@ namespace trlevel
         return std::ranges::any_of(clut.Colour, [](auto&& c) { return c.Red == 0 && c.Green == 0 && c.Blue == 0; }) ? 1 : 0;
     }
 
-    void Level::load_psx_pack(std::basic_ispanstream<uint8_t>& file, trview::Activity&, const LoadCallbacks&)
+    void Level::load_psx_pack(const std::shared_ptr<const trview::IFiles::MappedFile>& file, trview::Activity&, const LoadCallbacks&)
     {
-        if (_pack_source)
+        if (_pack_source && file)
         {
             _pack = _pack_source(file);
             _pack->set_filename(_filename);
@@ -13,7 +13,7 @@ namespace trlevel
 {
     uint16_t attribute_for_object_texture(const tr_object_texture_psx& texture, const tr_clut& clut);
     std::vector<tr_room_vertex> convert_psx_vertex_lighting(std::vector<tr_room_vertex> vertices);
-    std::vector<uint8_t> convert_vag_to_wav(const std::vector<uint8_t>& bytes, uint32_t sample_frequency);
+    std::vector<uint8_t> convert_vag_to_wav(std::span<const uint8_t> bytes, uint32_t sample_frequency);
     bool is_supported_tr4_psx_version(int32_t version);
     bool is_supported_tr5_psx_version(int32_t version);
     std::vector<tr4_ai_object> read_ai_objects(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const tr4_psx_level_info& info, const ILevel::LoadCallbacks& callbacks);
@@ -82,14 +82,14 @@ namespace trlevel
         {
             log_file(activity, file, "Reading lights");
             room.lights = convert_lights(read_vector<uint16_t, tr_room_light>(file));
-            log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+            log_file(activity, file, "Read {} lights", room.lights.size());
         }
 
         void read_room_static_meshes_tr1_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
         {
             log_file(activity, file, "Reading static meshes");
             room.static_meshes = convert_room_static_meshes(read_vector<uint16_t, tr_room_staticmesh>(file));
-            log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+            log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
         }
 
         uint16_t attribute_for_object_texture(tr_object_texture& ot, const std::vector<tr_textile8>& textiles)
@@ -222,6 +222,15 @@ namespace trlevel
             read_room_flags(activity, file, room);
         }
 
+        void skip_tr1_pc_room(std::basic_ispanstream<uint8_t>& file)
+        {
+            skip_room_data_tr1_4(file);
+            skip(file, 2); // ambient intensity
+            skip_vector<uint16_t, tr_room_light>(file);
+            skip_vector<uint16_t, tr_room_staticmesh>(file);
+            skip(file, 4); // alternate room, flags
+        }
+
         tr_object_texture convert_object_texture(const tr_object_texture_may_1996& texture)
         {
             return
@@ -261,7 +270,7 @@ namespace trlevel
     {
         log_file(activity, file, "Reading vertices");
         room.data.vertices = convert_vertices(read_vector<int16_t, tr_room_vertex>(file));
-        log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+        log_file(activity, file, "Read {} vertices", room.data.vertices.size());
     }
 
     void read_zones_tr1(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks, uint32_t num_boxes)
@@ -279,7 +288,7 @@ namespace trlevel
         {
             const auto start = _sample_indices[s];
             const auto end = s + 1 < _sample_indices.size() ? _sample_indices[s + 1] : _sound_data.size();
-            _sound_samples.push_back({ _sound_data.begin() + start, _sound_data.begin() + end });
+            _sound_samples.push_back(std::span<const uint8_t>(_sound_data).subspan(start, end - start));
         }
     }
 
@@ -662,7 +671,7 @@ namespace trlevel
         read_textiles_tr1_pc(file, activity, callbacks);
         read<uint32_t>(file);
 
-        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr1_pc_room);
+        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr1_pc_room, skip_tr1_pc_room);
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
@@ -1259,12 +1259,12 @@ namespace trlevel
                 out_stream.seekp(40, std::ios::beg);
                 write<uint32_t>(out_stream, file_size - 44);
                 results.resize(file_size);
-                _sound_samples.push_back(results);
+                add_sound_sample(std::move(results));
             }
             else
             {
                 skip(file, 16);
-                _sound_samples.push_back({});
+                add_sound_sample({});
             }
         };
 
@@ -12,7 +12,7 @@ namespace trlevel
         {
             log_file(activity, file, "Reading vertices");
             room.data.vertices = convert_vertices(read_vector<int16_t, tr2_room_vertex>(file));
-            log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+            log_file(activity, file, "Read {} vertices", room.data.vertices.size());
         }
 
         void load_tr2_pc_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
@@ -40,6 +40,15 @@ namespace trlevel
             read_room_flags(activity, file, room);
         }
 
+        void skip_tr2_pc_room(std::basic_ispanstream<uint8_t>& file)
+        {
+            skip_room_data_tr1_4(file);
+            skip(file, 6); // ambient intensity 1 & 2, light mode
+            skip_vector<uint16_t, tr2_room_light>(file);
+            skip_vector<uint16_t, tr3_room_staticmesh>(file);
+            skip(file, 4); // alternate room, flags
+        }
+
         uint32_t convert_textile16_pc_e3(uint16_t t)
         {
             uint16_t r = (t & 0x7c00) >> 10;
@@ -68,14 +77,14 @@ namespace trlevel
     {
         log_file(activity, file, "Reading ambient intensity 2");
         room.ambient_intensity_2 = read<int16_t>(file);
-        log_file(activity, file, std::format("Read ambient intensity 2: {}", room.ambient_intensity_2));
+        log_file(activity, file, "Read ambient intensity 2: {}", room.ambient_intensity_2);
     }
 
     void read_room_lights_tr2_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading lights");
         room.lights = convert_lights(read_vector<uint16_t, tr2_room_light>(file));
-        log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+        log_file(activity, file, "Read {} lights", room.lights.size());
     }
 
     void Level::read_textiles_tr2_pc_e3(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -101,7 +110,7 @@ namespace trlevel
 
         read<uint32_t>(file);
 
-        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr2_pc_room);
+        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr2_pc_room, skip_tr2_pc_room);
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
@@ -137,7 +146,7 @@ namespace trlevel
             skip(file, 4); // RIFF
             uint32_t size = peek<uint32_t>(file);
             file.seekg(-4, std::ios::cur);
-            _sound_samples.push_back(read_vector<uint8_t>(file, size + 4));
+            _sound_samples.push_back(read_span(file, size + 4));
         }
         generate_sounds(callbacks);
         callbacks.on_progress("Generating meshes");
@@ -158,7 +167,7 @@ namespace trlevel
 
         read<uint32_t>(file);
 
-        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr2_pc_room);
+        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr2_pc_room, skip_tr2_pc_room);
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
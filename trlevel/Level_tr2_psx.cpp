@@ -620,11 +620,12 @@ namespace trlevel
         callbacks.on_progress("Reading object textures");
         log_file(activity, file, "Reading object textures");
         _object_textures_psx = read_vector<uint32_t, tr_object_texture_psx>(file);
+        _textile4_atlas.add(_object_textures_psx);
+        pack_textile4();
         _object_textures = _object_textures_psx
             | std::views::transform([&](const auto texture)
                 {
-                    tr_object_texture_psx new_texture = texture;
-                    new_texture.Tile = convert_textile4(texture.Tile, texture.Clut);
+                    tr_object_texture_psx new_texture = _textile4_atlas.place(texture);
                     new_texture.Clut = 0U; // Unneeded after conversion
                     new_texture.Attribute = texture.Attribute;
                     return new_texture;
@@ -33,6 +33,15 @@ namespace trlevel
             read_room_reverb_info(activity, file, room);
             skip(file, 1); // filler in TR3
         }
+
+        void skip_tr3_pc_room(std::basic_ispanstream<uint8_t>& file)
+        {
+            skip_room_data_tr1_4(file);
+            skip(file, 4); // ambient intensity, light mode
+            skip_vector<uint16_t, tr3_room_light>(file);
+            skip_vector<uint16_t, tr3_room_staticmesh>(file);
+            skip(file, 7); // alternate room, flags, water scheme, reverb info, filler
+        }
     }
 
     void Level::load_tr3_pc(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -50,7 +59,7 @@ namespace trlevel
             return;
         }
 
-        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr3_pc_room);
+        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr3_pc_room, skip_tr3_pc_room);
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
@@ -89,6 +98,6 @@ namespace trlevel
     {
         log_file(activity, file, "Reading lights");
         room.lights = convert_lights(read_vector<uint16_t, tr3_room_light>(file));
-        log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+        log_file(activity, file, "Read {} lights", room.lights.size());
     }
 }
@@ -26,7 +26,7 @@ namespace trlevel
         {
             log_file(activity, file, "Reading lights");
             room.lights = convert_lights(read_vector<uint16_t, tr4_room_light>(file));
-            log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+            log_file(activity, file, "Read {} lights", room.lights.size());
         }
 
         void load_tr4_pc_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
@@ -55,6 +55,15 @@ namespace trlevel
             read_room_alternate_group(activity, file, room);
         }
 
+        void skip_tr4_pc_room(std::basic_ispanstream<uint8_t>& file)
+        {
+            skip_room_data_tr1_4(file);
+            skip(file, 4); // colour
+            skip_vector<uint16_t, tr4_room_light>(file);
+            skip_vector<uint16_t, tr3_room_staticmesh>(file);
+            skip(file, 7); // alternate room, flags, water scheme, reverb info, alternate group
+        }
+
         uint32_t read_textiles_tr4_remastered(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks)
         {
             log_file(activity, file, "Reading textile counts");
@@ -98,7 +107,9 @@ namespace trlevel
     void Level::load_tr4_pc(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
     {
         skip(file, 4); // version number
-        _num_textiles = read_textiles_tr4_5(activity, file, callbacks);
+        // Textiles are inflated on worker threads while the level data is inflated and parsed here.
+        auto textiles = start_textiles_tr4_5(activity, file, callbacks);
+        _num_textiles = textiles.num_textiles;
         log_file(activity, file, "Reading and decompressing level data");
         callbacks.on_progress("Decompressing level data");
         const std::vector<uint8_t> level_data = read_compressed(file);
@@ -112,10 +123,11 @@ namespace trlevel
             if (data_stream.eof())
             {
                 // VICT.TR2 ends here.
+                read_textiles_tr4_5(activity, textiles, callbacks);
                 return;
             }
 
-            _rooms = read_rooms<uint16_t>(activity, data_stream, callbacks, load_tr4_pc_room);
+            _rooms = read_rooms<uint16_t>(activity, data_stream, callbacks, load_tr4_pc_room, skip_tr4_pc_room);
             _floor_data = read_floor_data(activity, data_stream, callbacks);
             _mesh_data = read_mesh_data(activity, data_stream, callbacks);
             _mesh_pointers = read_mesh_pointers(activity, data_stream, callbacks);
@@ -156,6 +168,8 @@ namespace trlevel
             _sample_indices = read_sample_indices(activity, data_stream, callbacks);
         }
 
+        read_textiles_tr4_5(activity, textiles, callbacks);
+
         const auto sound_start = file.tellg();
         try
         {
@@ -209,7 +223,7 @@ namespace trlevel
         log_file(activity, file, "Reading level data");
         callbacks.on_progress("Processing level data");
 
-        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr4_pc_room);
+        _rooms = read_rooms<uint16_t>(activity, file, callbacks, load_tr4_pc_room, skip_tr4_pc_room);
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
@@ -262,7 +276,7 @@ namespace trlevel
             uint32_t uncompressed = read<uint32_t>(file);
             uncompressed;
             uint32_t compressed = read<uint32_t>(file);
-            _sound_samples.push_back(read_vector<uint8_t>(file, compressed));
+            _sound_samples.push_back(read_span(file, compressed));
         }
         log_file(activity, file, std::format("Read {} sound samples", num_samples));
     }
@@ -270,16 +284,17 @@ namespace trlevel
     void Level::load_ngle_sound_fx(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const LoadCallbacks& callbacks)
     {
         const auto ngle_samples = read_sound_samples_ngle(activity, file, callbacks);
-        if (const auto main = load_main_sfx())
+        _main_sfx = load_main_sfx();
+        if (_main_sfx)
         {
-            std::basic_ispanstream<uint8_t> sfx_file{ std::span(*main) };
+            std::basic_ispanstream<uint8_t> sfx_file{ _main_sfx->data() };
             sfx_file.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
 
             for (uint32_t i = 0; i < ngle_samples.size(); ++i)
             {
                 const auto sample = ngle_samples[i];
                 sfx_file.seekg(sample.start);
-                _sound_samples.push_back(read_vector<uint8_t>(sfx_file, sample.size));
+                _sound_samples.push_back(read_span(sfx_file, sample.size));
             }
         }
     }
@@ -2,6 +2,7 @@
 #include "Level_common.h"
 #include "Level_psx.h"
 #include "Level_tr3.h"
+#include "TextileConversion.h"
 #include <trview.common/Algorithms.h>
 
 #include <ranges>
@@ -471,7 +472,8 @@ namespace trlevel
         const auto sound_offsets = read_vector<uint32_t>(file, info.num_sounds);
 
         file.seekg(start + info.sound_data_offset, std::ios::beg);
-        const auto sound_data = read_vector<byte>(file, info.sound_data_length);
+        _sound_data = read_vector<byte>(file, info.sound_data_length);
+        _sample_decoder = [=](auto&& bytes) { return convert_vag_to_wav(bytes, sample_frequency); };
 
         for (uint32_t s = 0; s < sound_offsets.size(); ++s)
         {
@@ -479,9 +481,9 @@ namespace trlevel
             log_file(activity, file, std::format("Loading sound {} of {}", s, sound_offsets.size()));
             const std::size_t offset = sound_offsets[s];
             const std::size_t size = s == sound_offsets.size() - 1 ?
-                sound_data.size() - offset - 1 :
+                _sound_data.size() - offset - 1 :
                 sound_offsets[s + 1] - offset;
-            _sound_samples.push_back(convert_vag_to_wav({ &sound_data[offset], &sound_data[offset + size] }, sample_frequency));
+            _sound_samples.push_back(std::span<const uint8_t>(_sound_data).subspan(offset, size));
         }
 
         log_file(activity, file, std::format("Read {} sounds", sound_offsets.size()));
@@ -611,50 +613,28 @@ namespace trlevel
         file.seekg(start + info.textiles_offset);
         const auto textile_bytes = read_vector<uint8_t>(file, 0x80000);
 
-        auto convert_textile4_tr4_psx = [&](tr_object_texture_psx& t)
+        auto clut_for = [&](uint16_t clut_id)
             {
-                const auto [tx, ty] = tile_to_x_y(t.Tile);
-                const auto [cx, cy] = clut_to_clut(t.Clut);
-                tr_clut clut = *reinterpret_cast<const tr_clut*>(&textile_bytes[cy * 1024 + cx]);
-
-                // Check if we've already converted this tile + clut
-                for (auto i = _converted_t16.begin(); i < _converted_t16.end(); ++i)
-                {
-                    if (i->first == t.Tile && i->second == t.Clut)
-                    {
-                        t.Attribute = attribute_for_object_texture(t, clut),
-                            t.Tile = static_cast<uint16_t>(std::distance(_converted_t16.begin(), i));
-                        t.Clut = 0;
-                        return;
-                    }
-                }
-                // If not, create new conversion
-                _converted_t16.push_back(std::make_pair(t.Tile, t.Clut));
-
-                tr_textile16& tile16 = _textile16.emplace_back();
-                for (int y = 0; y < 256; ++y)
-                {
-                    for (int x = 0; x < 256; ++x)
-                    {
-                        const std::size_t src_pixel = ((ty + y) * 1024) + (tx + (x / 2));
-                        const std::size_t dest_pixel = y * 256 + x;
-                        const tr_colorindex4 index = *reinterpret_cast<const tr_colorindex4*>(&textile_bytes[src_pixel]);
-                        const tr_rgba5551& colour = clut.Colour[(x % 2) ? index.b : index.a];
-                        tile16.Tile[dest_pixel] = (colour.Alpha << 15) | (colour.Red << 10) | (colour.Green << 5) | colour.Blue;
-                    }
-                }
-
-                _num_textiles = static_cast<uint32_t>(_textile16.size());
-                t.Attribute = attribute_for_object_texture(t, clut);
-                t.Tile = static_cast<uint16_t>(_textile16.size() - 1);
-                t.Clut = 0;
+                const auto [cx, cy] = clut_to_clut(clut_id);
+                return *reinterpret_cast<const tr_clut*>(&textile_bytes[cy * 1024 + cx]);
             };
 
+        _textile4_atlas.add(_object_textures_psx);
+        _textile4_atlas.pack(_textile16, [&](uint16_t tile, uint16_t clut_id, uint32_t x, uint32_t y, std::span<uint16_t> output)
+            {
+                const auto [tx, ty] = tile_to_x_y(tile);
+                const std::size_t row = ((ty + y) * 1024) + tx;
+                expand_textile4({ reinterpret_cast<const tr_colorindex4*>(&textile_bytes[row]), 128 }, x, clut_for(clut_id), output);
+            });
+        _num_textiles = static_cast<uint32_t>(_textile16.size());
+
         _object_textures = _object_textures_psx
-            | std::views::transform([&](auto texture)
+            | std::views::transform([&](const auto texture)
                 {
-                    convert_textile4_tr4_psx(texture);
-                    return texture;
+                    tr_object_texture_psx new_texture = _textile4_atlas.place(texture);
+                    new_texture.Attribute = attribute_for_object_texture(texture, clut_for(texture.Clut));
+                    new_texture.Clut = 0;
+                    return new_texture;
                 })
             | std::views::transform([&](const auto texture) -> tr_object_texture
                 {
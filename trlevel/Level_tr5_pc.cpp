@@ -93,6 +93,12 @@ namespace trlevel
             file.seekg(room_end, std::ios::beg);
         }
 
+        void skip_tr5_pc_room(std::basic_ispanstream<uint8_t>& file)
+        {
+            skip_xela(file);
+            skip(file, read<uint32_t>(file));
+        }
+
         void load_tr5_pc_remastered_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
         {
             log_file(activity, file, "Reading room data information");
@@ -192,7 +198,9 @@ namespace trlevel
     void Level::load_tr5_pc(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
     {
         skip(file, 4); // version number
-        _num_textiles = read_textiles_tr4_5(activity, file, callbacks);
+        // Textiles are inflated on worker threads while the level data is parsed here.
+        auto textiles = start_textiles_tr4_5(activity, file, callbacks);
+        _num_textiles = textiles.num_textiles;
         log_file(activity, file, "Reading Lara type");
         _lara_type = read<uint16_t>(file);
         log_file(activity, file, std::format("Lara type: {}", _lara_type));
@@ -215,10 +223,11 @@ namespace trlevel
         if (file.eof())
         {
             // VICT.TR2 ends here.
+            read_textiles_tr4_5(activity, textiles, callbacks);
             return;
         }
 
-        _rooms = read_rooms<uint32_t>(activity, file, callbacks, load_tr5_pc_room);
+        _rooms = read_rooms<uint32_t>(activity, file, callbacks, load_tr5_pc_room, skip_tr5_pc_room);
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
@@ -260,6 +269,7 @@ namespace trlevel
         _sample_indices = read_sample_indices(activity, file, callbacks);
 
         file.seekg(at + static_cast<std::fpos_t>(uncompressed_size), std::ios::beg);
+        read_textiles_tr4_5(activity, textiles, callbacks);
 
         const auto sound_start = file.tellg();
         try
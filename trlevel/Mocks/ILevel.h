@@ -18,12 +18,12 @@ namespace trlevel
             MOCK_METHOD(tr_colour4, get_palette_entry, (uint32_t), (const, override));
             MOCK_METHOD(tr_colour4, get_palette_entry, (uint32_t, uint32_t), (const, override));
             MOCK_METHOD(uint32_t, num_rooms, (), (const, override));
-            MOCK_METHOD(tr3_room, get_room, (uint32_t), (const, override));
+            MOCK_METHOD(const tr3_room&, get_room, (uint32_t), (const, override));
             MOCK_METHOD(uint32_t, num_object_textures, (), (const, override));
             MOCK_METHOD(tr_object_texture, get_object_texture, (uint32_t), (const, override));
             MOCK_METHOD(uint32_t, num_floor_data, (), (const, override));
             MOCK_METHOD(uint16_t, get_floor_data, (uint32_t), (const, override));
-            MOCK_METHOD(std::vector<uint16_t>, get_floor_data_all, (), (const, override));
+            MOCK_METHOD(std::span<const uint16_t>, get_floor_data_all, (), (const, override));
             MOCK_METHOD(uint32_t, num_ai_objects, (), (const, override));
             MOCK_METHOD(tr4_ai_object, get_ai_object, (uint32_t), (const, override));
             MOCK_METHOD(uint32_t, num_entities, (), (const, override));
@@ -34,6 +34,7 @@ namespace trlevel
             MOCK_METHOD(uint32_t, num_static_meshes, (), (const, override));
             MOCK_METHOD(std::optional<tr_staticmesh>, get_static_mesh, (uint32_t), (const, override));
             MOCK_METHOD(uint32_t, num_mesh_pointers, (), (const, override));
+            MOCK_METHOD(uint32_t, get_mesh_pointer, (uint32_t), (const, override));
             MOCK_METHOD(tr_mesh, get_mesh_by_pointer, (uint32_t), (const, override));
             MOCK_METHOD(std::vector<tr_meshtree_node>, get_meshtree, (uint32_t, uint32_t), (const, override));
             MOCK_METHOD(tr2_frame, get_frame, (uint32_t, uint32_t), (const, override));
@@ -46,13 +47,15 @@ namespace trlevel
             MOCK_METHOD(tr_camera, get_camera, (uint32_t), (const, override));
             MOCK_METHOD(Platform, platform, (), (const, override));
             MOCK_METHOD(void, load, (const LoadCallbacks&), (override));
-            MOCK_METHOD(std::vector<tr_sound_source>, sound_sources, (), (const, override));
-            MOCK_METHOD(std::vector<tr_x_sound_details>, sound_details, (), (const, override));
-            MOCK_METHOD(std::vector<int16_t>, sound_map, (), (const, override));
+            MOCK_METHOD(std::span<const tr_sound_source>, sound_sources, (), (const, override));
+            MOCK_METHOD(std::span<const tr_x_sound_details>, sound_details, (), (const, override));
+            MOCK_METHOD(std::span<const int16_t>, sound_map, (), (const, override));
             MOCK_METHOD(bool, trng, (), (const, override));
             MOCK_METHOD(PlatformAndVersion, platform_and_version, (), (const, override));
             MOCK_METHOD(std::weak_ptr<IPack>, pack, (), (const, override));
-            MOCK_METHOD(std::vector<tr4_flyby_camera>, flyby_cameras, (), (const, override));
+            MOCK_METHOD(std::span<const tr4_flyby_camera>, flyby_cameras, (), (const, override));
+
+            tr3_room default_room{};
         };
     }
 }
@@ -6,7 +6,11 @@ namespace trlevel
 {
     namespace mocks
     {
-        MockLevel::MockLevel() {}
+        MockLevel::MockLevel()
+        {
+            ON_CALL(*this, get_room).WillByDefault(testing::ReturnRef(default_room));
+        }
+
         MockLevel::~MockLevel() {}
     }
 }
\ No newline at end of file
@@ -21,22 +21,19 @@ namespace trlevel
     {
     }
 
-    Pack::Pack(std::basic_ispanstream<uint8_t>& file, const trlevel::ILevel::PackSource& level_source)
-        : _level_source(level_source)
+    Pack::Pack(const std::shared_ptr<const trview::IFiles::MappedFile>& file, const trlevel::ILevel::PackSource& level_source)
+        : _data(file->data().begin(), file->data().end()), _level_source(level_source)
     {
-        file.seekg(8, std::ios::beg);
-        _parts = read_vector<Header>(file, 50) |
+        const std::span<const uint8_t> bytes = _data;
+        std::basic_ispanstream<uint8_t> stream{ bytes };
+        stream.exceptions(std::ios::failbit);
+        stream.seekg(8, std::ios::beg);
+        _parts = read_vector<Header>(stream, 50) |
             std::views::filter([](auto&& h) { return h.size > 0; }) |
             std::views::transform([&](auto&& h) -> Part
                 {
-                    file.seekg(h.start, std::ios::beg);
-                    std::vector<uint8_t> data;
-                    if (h.size > 0)
-                    {
-                        data.resize(h.size);
-                        file.read(&data[0], h.size);
-                    }
-                    return { .start = h.start, .size = h.size, .data = data };
+                    stream.seekg(h.start + h.size, std::ios::beg);
+                    return { .start = h.start, .size = h.size, .data = bytes.subspan(h.start, h.size) };
                 }) | std::ranges::to<std::vector>();
     }
 
@@ -91,7 +88,7 @@ namespace trlevel
         return filename;
     }
 
-    std::optional<std::vector<uint8_t>> pack_entry(const IPack& pack, uint32_t offset)
+    std::optional<std::span<const uint8_t>> pack_entry(const IPack& pack, uint32_t offset)
     {
         for (const auto& p : pack.parts())
         {
@@ -11,13 +11,18 @@ namespace trlevel
     class Pack final : public IPack, public std::enable_shared_from_this<IPack>
     {
     public:
-        explicit Pack(std::basic_ispanstream<uint8_t>& file, const trlevel::ILevel::PackSource& level_source);
+        /// <summary>
+        /// Create a pack from the contents of a pack file. The contents are copied rather than kept as views into the
+        /// mapping, as a mapped file can't be written to and the pack is in use for as long as its levels are browsed.
+        /// </summary>
+        explicit Pack(const std::shared_ptr<const trview::IFiles::MappedFile>& file, const trlevel::ILevel::PackSource& level_source);
         virtual ~Pack() = default;
         void load() override;
         const std::vector<Part>& parts() const override;
         std::string filename() const override;
         void set_filename(const std::string& filename) override;
     private:
+        std::vector<uint8_t> _data;
         std::vector<Part> _parts;
         trlevel::ILevel::PackSource _level_source;
         std::string _filename;
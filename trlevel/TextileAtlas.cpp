@@ -0,0 +1,237 @@
+#include "TextileAtlas.h"
+#include "TileMapper.h"
+
+#include <ranges>
+#include <tuple>
+
+namespace trlevel
+{
+    namespace
+    {
+        constexpr uint32_t Max_Coordinate{ 255u };
+
+        uint32_t key_for(uint16_t tile, uint16_t clut)
+        {
+            return (static_cast<uint32_t>(tile) << 16) | clut;
+        }
+
+        uint32_t width(const TextileAtlas::Rect& rect)
+        {
+            return rect.right - rect.left + 1;
+        }
+
+        uint32_t height(const TextileAtlas::Rect& rect)
+        {
+            return rect.bottom - rect.top + 1;
+        }
+
+        bool contains(const TextileAtlas::Rect& outer, const TextileAtlas::Rect& inner)
+        {
+            return inner.left >= outer.left && inner.right <= outer.right && inner.top >= outer.top && inner.bottom <= outer.bottom;
+        }
+
+        bool overlaps(const TextileAtlas::Rect& a, const TextileAtlas::Rect& b)
+        {
+            return a.left <= b.right && b.left <= a.right && a.top <= b.bottom && b.top <= a.bottom;
+        }
+
+        TextileAtlas::Rect merge(const TextileAtlas::Rect& a, const TextileAtlas::Rect& b)
+        {
+            return { std::min(a.left, b.left), std::min(a.top, b.top), std::max(a.right, b.right), std::max(a.bottom, b.bottom) };
+        }
+
+        TextileAtlas::Rect bounds(std::initializer_list<uint8_t> xs, std::initializer_list<uint8_t> ys)
+        {
+            return { std::ranges::min(xs), std::ranges::min(ys), std::ranges::max(xs), std::ranges::max(ys) };
+        }
+
+        TextileAtlas::Rect bounds(const tr_object_texture_psx& texture)
+        {
+            return bounds({ texture.x0, texture.x1, texture.x2, texture.x3 }, { texture.y0, texture.y1, texture.y2, texture.y3 });
+        }
+
+        TextileAtlas::Rect bounds(const tr_sprite_texture_psx& texture)
+        {
+            return bounds({ texture.u0, texture.u1 }, { texture.v0, texture.v1 });
+        }
+
+        // One pixel around the region is kept so that filtering at the edges and coordinates that mark the end of
+        // a region sample the same texels as the original textile.
+        TextileAtlas::Rect padded(const TextileAtlas::Rect& rect)
+        {
+            return
+            {
+                rect.left ? rect.left - 1 : 0,
+                rect.top ? rect.top - 1 : 0,
+                std::min(rect.right + 1, Max_Coordinate),
+                std::min(rect.bottom + 1, Max_Coordinate)
+            };
+        }
+
+        uint8_t offset(uint8_t value, int32_t amount)
+        {
+            return static_cast<uint8_t>(value + amount);
+        }
+    }
+
+    TextileAtlas::TextileAtlas()
+    {
+    }
+
+    TextileAtlas::~TextileAtlas()
+    {
+    }
+
+    void TextileAtlas::add(std::span<const tr_object_texture_psx> textures)
+    {
+        for (const auto& texture : textures)
+        {
+            add(texture.Tile, texture.Clut, bounds(texture));
+        }
+    }
+
+    void TextileAtlas::add(std::span<const tr_sprite_texture_psx> textures)
+    {
+        for (const auto& texture : textures)
+        {
+            add(texture.Tile, texture.Clut, bounds(texture));
+        }
+    }
+
+    void TextileAtlas::add(uint16_t tile, uint16_t clut, const Rect& rect)
+    {
+        _pending[key_for(tile, clut)].push_back(padded(rect));
+    }
+
+    void TextileAtlas::pack(std::vector<tr_textile16>& textiles, const RowSource& source)
+    {
+        if (!_mapper)
+        {
+            // Only the placement is used - pixels are written straight into the 16 bit textiles.
+            _mapper = std::make_unique<TileMapper>(static_cast<uint32_t>(textiles.size()), [](auto&&) {});
+        }
+
+        struct Entry
+        {
+            uint32_t key;
+            Rect rect;
+        };
+
+        std::vector<Entry> entries;
+        for (const auto& [key, rects] : _pending)
+        {
+            std::vector<Rect> merged;
+            for (const auto& rect : rects)
+            {
+                if (!find(key, rect))
+                {
+                    merged.push_back(rect);
+                }
+            }
+
+            // Regions that overlap share texels, so they are combined and expanded once.
+            bool changed = true;
+            while (changed)
+            {
+                changed = false;
+                for (std::size_t i = 0; i < merged.size() && !changed; ++i)
+                {
+                    for (std::size_t j = i + 1; j < merged.size(); ++j)
+                    {
+                        if (overlaps(merged[i], merged[j]))
+                        {
+                            merged[i] = merge(merged[i], merged[j]);
+                            merged.erase(merged.begin() + j);
+                            changed = true;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            for (const auto& rect : merged)
+            {
+                entries.push_back({ key, rect });
+            }
+        }
+        _pending.clear();
+
+        // Tallest first so that less space is left at the bottom of each row.
+        std::ranges::sort(entries, [](const auto& l, const auto& r)
+            {
+                return std::tuple(height(r.rect), l.key, l.rect.top, l.rect.left) < std::tuple(height(l.rect), r.key, r.rect.top, r.rect.left);
+            });
+
+        for (const auto& entry : entries)
+        {
+            const auto position = _mapper->allocate(width(entry.rect), height(entry.rect));
+            if (position.textile >= textiles.size())
+            {
+                textiles.resize(position.textile + 1);
+            }
+
+            auto& textile = textiles[position.textile];
+            for (uint32_t y = 0; y < height(entry.rect); ++y)
+            {
+                source(static_cast<uint16_t>(entry.key >> 16), static_cast<uint16_t>(entry.key & 0xffff),
+                    entry.rect.left, entry.rect.top + y,
+                    std::span<uint16_t>(&textile.Tile[(position.y + y) * 256 + position.x], width(entry.rect)));
+            }
+            _placed[entry.key].push_back({ .rect = entry.rect, .textile = position.textile, .x = position.x, .y = position.y });
+        }
+    }
+
+    tr_object_texture_psx TextileAtlas::place(const tr_object_texture_psx& texture) const
+    {
+        const auto placed = find(key_for(texture.Tile, texture.Clut), bounds(texture));
+        if (!placed)
+        {
+            return texture;
+        }
+
+        const int32_t x = static_cast<int32_t>(placed->x) - static_cast<int32_t>(placed->rect.left);
+        const int32_t y = static_cast<int32_t>(placed->y) - static_cast<int32_t>(placed->rect.top);
+        tr_object_texture_psx result = texture;
+        result.Tile = static_cast<uint16_t>(placed->textile);
+        result.x0 = offset(texture.x0, x);
+        result.y0 = offset(texture.y0, y);
+        result.x1 = offset(texture.x1, x);
+        result.y1 = offset(texture.y1, y);
+        result.x2 = offset(texture.x2, x);
+        result.y2 = offset(texture.y2, y);
+        result.x3 = offset(texture.x3, x);
+        result.y3 = offset(texture.y3, y);
+        return result;
+    }
+
+    tr_sprite_texture_psx TextileAtlas::place(const tr_sprite_texture_psx& texture) const
+    {
+        const auto placed = find(key_for(texture.Tile, texture.Clut), bounds(texture));
+        if (!placed)
+        {
+            return texture;
+        }
+
+        const int32_t x = static_cast<int32_t>(placed->x) - static_cast<int32_t>(placed->rect.left);
+        const int32_t y = static_cast<int32_t>(placed->y) - static_cast<int32_t>(placed->rect.top);
+        tr_sprite_texture_psx result = texture;
+        result.Tile = static_cast<uint16_t>(placed->textile);
+        result.u0 = offset(texture.u0, x);
+        result.v0 = offset(texture.v0, y);
+        result.u1 = offset(texture.u1, x);
+        result.v1 = offset(texture.v1, y);
+        return result;
+    }
+
+    const TextileAtlas::Placed* TextileAtlas::find(uint32_t key, const Rect& rect) const
+    {
+        const auto found = _placed.find(key);
+        if (found == _placed.end())
+        {
+            return nullptr;
+        }
+
+        const auto placed = std::ranges::find_if(found->second, [&](const auto& p) { return contains(p.rect, rect); });
+        return placed == found->second.end() ? nullptr : &*placed;
+    }
+}
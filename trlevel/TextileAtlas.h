@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "trtypes.h"
+
+namespace trlevel
+{
+    class TileMapper;
+
+    // Expands the parts of 4 bit textiles that are used by PSX textures into shared 16 bit textiles. Each region
+    // is expanded once for each clut it is used with, rather than converting the whole textile for every clut.
+    class TextileAtlas final
+    {
+    public:
+        // Inclusive pixel bounds in a 256x256 textile.
+        struct Rect
+        {
+            uint32_t left;
+            uint32_t top;
+            uint32_t right;
+            uint32_t bottom;
+        };
+
+        // Writes output.size() pixels of row y of a 4 bit tile, starting at x, converted with the clut.
+        using RowSource = std::function<void(uint16_t tile, uint16_t clut, uint32_t x, uint32_t y, std::span<uint16_t> output)>;
+
+        TextileAtlas();
+        ~TextileAtlas();
+        // Records the regions used by the textures. They are expanded by the next call to pack.
+        void add(std::span<const tr_object_texture_psx> textures);
+        void add(std::span<const tr_sprite_texture_psx> textures);
+        // Expands the regions added since the last call into the textiles, adding textiles as they are needed.
+        void pack(std::vector<tr_textile16>& textiles, const RowSource& source);
+        // Gets a copy of the texture moved to where its region was packed. The clut is not changed and textures that
+        // were never packed are returned as they are.
+        tr_object_texture_psx place(const tr_object_texture_psx& texture) const;
+        tr_sprite_texture_psx place(const tr_sprite_texture_psx& texture) const;
+    private:
+        struct Placed
+        {
+            Rect rect;
+            uint32_t textile;
+            uint32_t x;
+            uint32_t y;
+        };
+
+        void add(uint16_t tile, uint16_t clut, const Rect& rect);
+        const Placed* find(uint32_t key, const Rect& rect) const;
+
+        // Keyed by tile and clut.
+        std::unordered_map<uint32_t, std::vector<Rect>> _pending;
+        std::unordered_map<uint32_t, std::vector<Placed>> _placed;
+        std::unique_ptr<TileMapper> _mapper;
+    };
+}
@@ -0,0 +1,248 @@
+#include "TextileConversion.h"
+
+#include <array>
+#include <immintrin.h>
+#include <trview.common/Cpu.h>
+
+namespace trlevel
+{
+    namespace
+    {
+        // Expands a 5 bit channel to 8 bits. (c / 31.0f) * 255.0f truncates to the same value as c * 255 / 31.
+        constexpr std::array<uint8_t, 32> Expand5 = []()
+            {
+                std::array<uint8_t, 32> result{};
+                for (uint32_t c = 0; c < result.size(); ++c)
+                {
+                    result[c] = static_cast<uint8_t>(c * 255 / 31);
+                }
+                return result;
+            }();
+
+        // (c * 1053) >> 7 is c * 255 / 31 for every 5 bit value and fits in 16 bits.
+        constexpr int16_t Expand5Multiplier = 1053;
+        constexpr int Expand5Shift = 7;
+
+        uint32_t convert_texel16(uint16_t t)
+        {
+            const uint32_t r = Expand5[(t >> 10) & 0x1f];
+            const uint32_t g = Expand5[(t >> 5) & 0x1f];
+            const uint32_t b = Expand5[t & 0x1f];
+            const uint32_t a = t & 0x8000 ? 0xff : 0x00;
+            return a << 24 | b << 16 | g << 8 | r;
+        }
+
+        uint32_t convert_texel32(uint32_t t)
+        {
+            return (t & 0xff00ff00) | ((t >> 16) & 0xff) | ((t & 0xff) << 16);
+        }
+
+        std::array<uint16_t, 16> clut_colours(const tr_clut& clut)
+        {
+            std::array<uint16_t, 16> result;
+            for (uint32_t i = 0; i < result.size(); ++i)
+            {
+                const tr_rgba5551& colour = clut.Colour[i];
+                result[i] = static_cast<uint16_t>((colour.Alpha << 15) | (colour.Red << 10) | (colour.Green << 5) | colour.Blue);
+            }
+            return result;
+        }
+
+        uint16_t expand_texel4(std::span<const tr_colorindex4> input, uint32_t texel, const std::array<uint16_t, 16>& colours)
+        {
+            const tr_colorindex4 index = input[texel / 2];
+            return colours[(texel % 2) ? index.b : index.a];
+        }
+
+        // Splits 16 bit texels into the two 16 bit halves of the output: r | g << 8 and b | a << 8.
+        template <typename V, typename Ops>
+        void split_texels16(V t, V& low, V& high)
+        {
+            const V mask = Ops::set1_epi16(0x1f);
+            const V multiplier = Ops::set1_epi16(Expand5Multiplier);
+            const V r = Ops::srli_epi16(Ops::mullo_epi16(Ops::and_si(Ops::srli_epi16(t, 10), mask), multiplier), Expand5Shift);
+            const V g = Ops::srli_epi16(Ops::mullo_epi16(Ops::and_si(Ops::srli_epi16(t, 5), mask), multiplier), Expand5Shift);
+            const V b = Ops::srli_epi16(Ops::mullo_epi16(Ops::and_si(t, mask), multiplier), Expand5Shift);
+            const V a = Ops::and_si(Ops::srai_epi16(t, 15), Ops::set1_epi16(0xff));
+            low = Ops::or_si(r, Ops::slli_epi16(g, 8));
+            high = Ops::or_si(b, Ops::slli_epi16(a, 8));
+        }
+
+        struct Sse2
+        {
+            static __m128i set1_epi16(int16_t v) { return _mm_set1_epi16(v); }
+            static __m128i srli_epi16(__m128i v, int n) { return _mm_srli_epi16(v, n); }
+            static __m128i srai_epi16(__m128i v, int n) { return _mm_srai_epi16(v, n); }
+            static __m128i slli_epi16(__m128i v, int n) { return _mm_slli_epi16(v, n); }
+            static __m128i mullo_epi16(__m128i a, __m128i b) { return _mm_mullo_epi16(a, b); }
+            static __m128i and_si(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+            static __m128i or_si(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+        };
+
+        struct Avx2
+        {
+            static __m256i set1_epi16(int16_t v) { return _mm256_set1_epi16(v); }
+            static __m256i srli_epi16(__m256i v, int n) { return _mm256_srli_epi16(v, n); }
+            static __m256i srai_epi16(__m256i v, int n) { return _mm256_srai_epi16(v, n); }
+            static __m256i slli_epi16(__m256i v, int n) { return _mm256_slli_epi16(v, n); }
+            static __m256i mullo_epi16(__m256i a, __m256i b) { return _mm256_mullo_epi16(a, b); }
+            static __m256i and_si(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+            static __m256i or_si(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+        };
+
+        std::size_t convert_textile16_sse2(std::span<const uint16_t> input, std::span<uint32_t> output)
+        {
+            std::size_t i = 0;
+            for (; i + 8 <= input.size(); i += 8)
+            {
+                __m128i low;
+                __m128i high;
+                split_texels16<__m128i, Sse2>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i])), low, high);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]), _mm_unpacklo_epi16(low, high));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i + 4]), _mm_unpackhi_epi16(low, high));
+            }
+            return i;
+        }
+
+        std::size_t convert_textile16_avx2(std::span<const uint16_t> input, std::span<uint32_t> output)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= input.size(); i += 16)
+            {
+                __m256i low;
+                __m256i high;
+                split_texels16<__m256i, Avx2>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&input[i])), low, high);
+                // Unpacking works within each 128 bit lane, so the lanes are put back in order afterwards.
+                const __m256i first = _mm256_unpacklo_epi16(low, high);
+                const __m256i second = _mm256_unpackhi_epi16(low, high);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]), _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i + 8]), _mm256_permute2x128_si256(first, second, 0x31));
+            }
+            return i;
+        }
+
+        std::size_t convert_textile32_sse2(std::span<const uint32_t> input, std::span<uint32_t> output)
+        {
+            const __m128i keep = _mm_set1_epi32(static_cast<int>(0xff00ff00));
+            const __m128i low_byte = _mm_set1_epi32(0xff);
+            std::size_t i = 0;
+            for (; i + 4 <= input.size(); i += 4)
+            {
+                const __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+                const __m128i result = _mm_or_si128(_mm_and_si128(t, keep),
+                    _mm_or_si128(_mm_and_si128(_mm_srli_epi32(t, 16), low_byte), _mm_slli_epi32(_mm_and_si128(t, low_byte), 16)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]), result);
+            }
+            return i;
+        }
+
+        std::size_t convert_textile32_avx2(std::span<const uint32_t> input, std::span<uint32_t> output)
+        {
+            const __m256i swap = _mm256_setr_epi8(
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+            std::size_t i = 0;
+            for (; i + 8 <= input.size(); i += 8)
+            {
+                const __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&input[i]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]), _mm256_shuffle_epi8(t, swap));
+            }
+            return i;
+        }
+
+        // Expands 32 texels at a time from byte aligned input. Returns the number of texels written.
+        std::size_t expand_textile4_avx2(const uint8_t* input, const std::array<uint16_t, 16>& colours, std::span<uint16_t> output)
+        {
+            // The low and high bytes of each colour, repeated in both lanes so each lane can look them up.
+            alignas(32) std::array<uint8_t, 32> low_bytes;
+            alignas(32) std::array<uint8_t, 32> high_bytes;
+            for (uint32_t c = 0; c < colours.size(); ++c)
+            {
+                low_bytes[c] = low_bytes[c + 16] = static_cast<uint8_t>(colours[c] & 0xff);
+                high_bytes[c] = high_bytes[c + 16] = static_cast<uint8_t>(colours[c] >> 8);
+            }
+            const __m256i low_table = _mm256_load_si256(reinterpret_cast<const __m256i*>(low_bytes.data()));
+            const __m256i high_table = _mm256_load_si256(reinterpret_cast<const __m256i*>(high_bytes.data()));
+            const __m128i nibble = _mm_set1_epi8(0x0f);
+
+            std::size_t i = 0;
+            for (; i + 32 <= output.size(); i += 32)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i / 2));
+                const __m128i low = _mm_and_si128(bytes, nibble);
+                const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+                // Texels 0-15 in the first lane and 16-31 in the second.
+                const __m256i indices = _mm256_set_m128i(_mm_unpackhi_epi8(low, high), _mm_unpacklo_epi8(low, high));
+                const __m256i low_colour = _mm256_shuffle_epi8(low_table, indices);
+                const __m256i high_colour = _mm256_shuffle_epi8(high_table, indices);
+                const __m256i first = _mm256_unpacklo_epi8(low_colour, high_colour);
+                const __m256i second = _mm256_unpackhi_epi8(low_colour, high_colour);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]), _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i + 16]), _mm256_permute2x128_si256(first, second, 0x31));
+            }
+            return i;
+        }
+    }
+
+    void convert_textile16(std::span<const uint16_t> input, std::span<uint32_t> output)
+    {
+        const std::size_t done = trview::has_avx2() ? convert_textile16_avx2(input, output) : convert_textile16_sse2(input, output);
+        scalar::convert_textile16(input.subspan(done), output.subspan(done));
+    }
+
+    void convert_textile32(std::span<const uint32_t> input, std::span<uint32_t> output)
+    {
+        const std::size_t done = trview::has_avx2() ? convert_textile32_avx2(input, output) : convert_textile32_sse2(input, output);
+        scalar::convert_textile32(input.subspan(done), output.subspan(done));
+    }
+
+    void expand_textile4(std::span<const tr_colorindex4> input, uint32_t start, const tr_clut& clut, std::span<uint16_t> output)
+    {
+        // SSE2 has no byte shuffle to look up the clut with, so only AVX2 has a vector version.
+        if (!trview::has_avx2() || output.empty())
+        {
+            scalar::expand_textile4(input, start, clut, output);
+            return;
+        }
+
+        const auto colours = clut_colours(clut);
+        std::size_t done = 0;
+        if (start % 2)
+        {
+            output[done++] = expand_texel4(input, start, colours);
+        }
+        done += expand_textile4_avx2(reinterpret_cast<const uint8_t*>(input.data()) + (start + done) / 2, colours, output.subspan(done));
+        for (; done < output.size(); ++done)
+        {
+            output[done] = expand_texel4(input, static_cast<uint32_t>(start + done), colours);
+        }
+    }
+
+    namespace scalar
+    {
+        void convert_textile16(std::span<const uint16_t> input, std::span<uint32_t> output)
+        {
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                output[i] = convert_texel16(input[i]);
+            }
+        }
+
+        void convert_textile32(std::span<const uint32_t> input, std::span<uint32_t> output)
+        {
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                output[i] = convert_texel32(input[i]);
+            }
+        }
+
+        void expand_textile4(std::span<const tr_colorindex4> input, uint32_t start, const tr_clut& clut, std::span<uint16_t> output)
+        {
+            const auto colours = clut_colours(clut);
+            for (std::size_t i = 0; i < output.size(); ++i)
+            {
+                output[i] = expand_texel4(input, static_cast<uint32_t>(start + i), colours);
+            }
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "trtypes.h"
+
+namespace trlevel
+{
+    // Bulk texel conversions. Each uses AVX2 when the processor supports it and SSE2 or scalar code otherwise, and
+    // produces exactly the same values as the single texel functions in trtypes.h. The output must be at least as
+    // large as the input.
+
+    // Convert 16 bit ARGB1555 texels into 32 bit values, as convert_textile16 does for one texel.
+    void convert_textile16(std::span<const uint16_t> input, std::span<uint32_t> output);
+
+    // Convert 32 bit ARGB texels into 32 bit values, as convert_textile32 does for one texel.
+    void convert_textile32(std::span<const uint32_t> input, std::span<uint32_t> output);
+
+    // Expand 4 bit indices into 16 bit ARGB1555 texels using the clut. Each index byte holds two texels, the
+    // first in the low nibble.
+    // input: The index bytes.
+    // start: The texel in input to start from.
+    // clut: The colours for the indices.
+    // output: Receives output.size() texels.
+    void expand_textile4(std::span<const tr_colorindex4> input, uint32_t start, const tr_clut& clut, std::span<uint16_t> output);
+
+    namespace scalar
+    {
+        // Versions that never use SIMD, for tests and benchmarks.
+        void convert_textile16(std::span<const uint16_t> input, std::span<uint32_t> output);
+        void convert_textile32(std::span<const uint32_t> input, std::span<uint32_t> output);
+        void expand_textile4(std::span<const tr_colorindex4> input, uint32_t start, const tr_clut& clut, std::span<uint16_t> output);
+    }
+}
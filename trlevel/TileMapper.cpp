@@ -57,6 +57,14 @@ namespace trlevel
         return new_sprite_texture;
     }
 
+    TileMapper::Position TileMapper::allocate(uint32_t width, uint32_t height)
+    {
+        find_space(width, height);
+        const Position position{ .textile = textile_number, .x = x_current, .y = y_current };
+        adjust_cursor(width, height);
+        return position;
+    }
+
     void TileMapper::finish()
     {
         publish();
@@ -12,9 +12,18 @@ namespace trlevel
     class TileMapper final
     {
     public:
+        struct Position
+        {
+            uint32_t textile;
+            uint32_t x;
+            uint32_t y;
+        };
+
         TileMapper(uint32_t initial_textile_count, const std::function<void(const std::vector<uint32_t>&)>& publish_callback);
         tr_object_texture map(const std::vector<uint32_t>& data, uint32_t width, uint32_t height);
         tr_sprite_texture map_sprite(const std::vector<uint32_t>& data, uint32_t width, uint32_t height, const tr_sprite_texture_saturn& sprite_texture);
+        // Reserves space for a region without copying any data into the textile.
+        Position allocate(uint32_t width, uint32_t height);
         void finish();
     private:
         void find_space(uint32_t width, uint32_t height);
@@ -1,4 +1,5 @@
 #include "trtypes.h"
+#include "TextileConversion.h"
 #include <ranges>
 
 namespace trlevel
@@ -41,12 +42,16 @@ namespace trlevel
 
     std::vector<uint32_t> convert_textile(const tr_textile16& tile)
     {
-        return tile.Tile | std::views::transform(convert_textile16) | std::ranges::to<std::vector>();
+        std::vector<uint32_t> result(std::size(tile.Tile));
+        convert_textile16(tile.Tile, result);
+        return result;
     }
 
     std::vector<uint32_t> convert_textile(const tr_textile32& tile)
     {
-        return tile.Tile | std::views::transform(convert_textile32) | std::ranges::to<std::vector>();
+        std::vector<uint32_t> result(std::size(tile.Tile));
+        convert_textile32(tile.Tile, result);
+        return result;
     }
 
     // Convert a set of Tomb Raider I static meshes into a format compatible
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+namespace trview
+{
+    namespace benchmarks
+    {
+        void run_picking(uint32_t iterations);
+        void run_transparency(uint32_t iterations);
+        void run_room_build(uint32_t iterations);
+        void run_deduplicate_triangles(uint32_t iterations);
+        void run_floordata(uint32_t iterations);
+    }
+}
@@ -0,0 +1,183 @@
+#include "Benchmarks.h"
+
+#include <execution>
+#include <format>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <trlevel/Mocks/ILevel.h>
+#include <trview.app/Elements/Level.h>
+#include <trview.app/Elements/Room.h>
+#include <trview.app/Mocks/Elements/ICameraSink.h>
+#include <trview.app/Mocks/Elements/IFlyby.h>
+#include <trview.app/Mocks/Elements/IItem.h>
+#include <trview.app/Mocks/Elements/ILevel.h>
+#include <trview.app/Mocks/Elements/ILight.h>
+#include <trview.app/Mocks/Elements/INgPlusSwitcher.h>
+#include <trview.app/Mocks/Elements/IRoom.h>
+#include <trview.app/Mocks/Elements/ISector.h>
+#include <trview.app/Mocks/Elements/ISoundSource.h>
+#include <trview.app/Mocks/Elements/IStaticMesh.h>
+#include <trview.app/Mocks/Elements/ITrigger.h>
+#include <trview.app/Mocks/Geometry/IMesh.h>
+#include <trview.app/Mocks/Geometry/IModelStorage.h>
+#include <trview.app/Mocks/Geometry/ITransparencyBuffer.h>
+#include <trview.app/Mocks/Graphics/ILevelTextureStorage.h>
+#include <trview.app/Mocks/Graphics/IMeshStorage.h>
+#include <trview.app/Mocks/Graphics/ISelectionRenderer.h>
+#include <trview.app/Mocks/Sound/ISoundStorage.h>
+#include <trview.common/Mocks/Logs/ILog.h>
+#include <trview.graphics/mocks/IBuffer.h>
+#include <trview.graphics/mocks/IDevice.h>
+#include <trview.graphics/mocks/IShaderStorage.h>
+#include <trview.tests.common/Benchmark.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace trview::tests::benchmark;
+using namespace DirectX::SimpleMath;
+using testing::Return;
+
+namespace trview
+{
+    namespace benchmarks
+    {
+        namespace
+        {
+            trlevel::tr3_room create_room_with_floor(uint16_t size)
+            {
+                trlevel::tr3_room room{ .alternate_group = 0 };
+                room.num_x_sectors = size;
+                room.num_z_sectors = size;
+                for (uint16_t x = 0; x <= size; ++x)
+                {
+                    for (uint16_t z = 0; z <= size; ++z)
+                    {
+                        room.data.vertices.push_back({ .vertex = { static_cast<int16_t>(x * 1024), 0, static_cast<int16_t>(z * 1024) } });
+                    }
+                }
+
+                for (uint16_t x = 0; x < size; ++x)
+                {
+                    for (uint16_t z = 0; z < size; ++z)
+                    {
+                        const uint16_t v = x * (size + 1) + z;
+                        room.data.rectangles.push_back({ .vertices = { v, static_cast<uint16_t>(v + 1), static_cast<uint16_t>(v + size + 2), static_cast<uint16_t>(v + size + 1) } });
+                    }
+                }
+                return room;
+            }
+
+            struct GeneratedRoom
+            {
+                std::vector<std::vector<ISector::Triangle>> sectors;
+                std::set<uint16_t> neighbours;
+            };
+
+            /// Generates rooms with triangles on a small grid so that many triangles are shared between rooms, some with
+            /// the same vertices in a different order.
+            std::vector<GeneratedRoom> generate_rooms(uint32_t rooms, uint32_t triangles_per_room, uint32_t seed)
+            {
+                std::mt19937 random(seed);
+                std::uniform_int_distribution<int> coordinate(0, 3);
+                std::uniform_int_distribution<uint32_t> room_number(0, rooms - 1);
+                const auto vertex = [&]() { return Vector3(static_cast<float>(coordinate(random)), static_cast<float>(coordinate(random)) * 0.25f, static_cast<float>(coordinate(random))); };
+
+                std::vector<GeneratedRoom> result(rooms);
+                for (auto& room : result)
+                {
+                    room.sectors.resize(4);
+                    for (uint32_t t = 0; t < triangles_per_room; ++t)
+                    {
+                        room.sectors[t % room.sectors.size()].push_back(ISector::Triangle(vertex(), vertex(), vertex(), SectorFlag::None, 0));
+                    }
+
+                    for (int n = 0; n < 3; ++n)
+                    {
+                        room.neighbours.insert(static_cast<uint16_t>(room_number(random)));
+                    }
+                }
+                return result;
+            }
+
+            /// Loads the generated rooms into a level with every other part of the level mocked, so that the time is
+            /// mostly spent matching up the sector triangles.
+            std::shared_ptr<Level> load_level(const std::vector<GeneratedRoom>& rooms)
+            {
+                auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+                ON_CALL(mock_level, num_rooms()).WillByDefault(Return(static_cast<uint32_t>(rooms.size())));
+
+                auto level = std::make_shared<Level>(mock_shared<graphics::mocks::MockDevice>(), mock_shared<graphics::mocks::MockShaderStorage>(),
+                    mock_shared<MockLevelTextureStorage>(), mock_unique<MockTransparencyBuffer>(), mock_unique<MockSelectionRenderer>(),
+                    mock_shared<MockLog>(), [](auto&&...) { return mock_unique<graphics::mocks::MockBuffer>(); }, mock_shared<MockSoundStorage>(),
+                    mock_shared<MockNgPlusSwitcher>());
+                level->initialise(std::move(mock_level_ptr), mock_shared<MockMeshStorage>(), mock_shared<MockModelStorage>(),
+                    [](auto&&...) { return mock_shared<MockItem>(); },
+                    [](auto&&...) { return mock_shared<MockItem>(); },
+                    [&](auto&&, auto&&, auto&&, auto&&, uint32_t index, auto&&...)
+                    {
+                        auto room = mock_shared<MockRoom>()->with_number(index);
+                        std::vector<std::shared_ptr<ISector>> sectors;
+                        for (const auto& triangles : rooms[index].sectors)
+                        {
+                            auto sector = mock_shared<MockSector>();
+                            ON_CALL(*sector, triangles).WillByDefault(Return(triangles));
+                            sectors.push_back(sector);
+                        }
+                        ON_CALL(*room, sectors).WillByDefault(Return(sectors));
+                        ON_CALL(*room, neighbours).WillByDefault(Return(rooms[index].neighbours));
+                        return room;
+                    },
+                    [](auto&&...) { return mock_shared<MockTrigger>(); },
+                    [](auto&&...) { return mock_shared<MockLight>(); },
+                    [](auto&&...) { return mock_shared<MockCameraSink>(); },
+                    [](auto&&...) { return mock_shared<MockSoundSource>(); },
+                    [](auto&&...) { return mock_shared<MockFlyby>(); },
+                    {});
+                return level;
+            }
+        }
+
+        // Compares building rooms one at a time with building them at the same time, as a level load does.
+        void run_room_build(uint32_t iterations)
+        {
+            auto texture_storage = mock_shared<MockLevelTextureStorage>();
+            ON_CALL(*texture_storage, num_tiles).WillByDefault(Return(1));
+            ON_CALL(*texture_storage, num_object_textures).WillByDefault(Return(1));
+            auto tr_level = mock_shared<trlevel::mocks::MockLevel>();
+            const auto level_room = create_room_with_floor(24);
+            const IMesh::Source mesh_source = [](auto&&...) { return mock_shared<MockMesh>(); };
+            const IStaticMesh::MeshSource static_mesh_source = [](auto&&...) { return mock_shared<MockStaticMesh>(); };
+            const IStaticMesh::PositionSource static_mesh_position_source = [](auto&&...) { return mock_shared<MockStaticMesh>(); };
+            const ISector::Source sector_source = [](auto&&...) { return mock_shared<MockSector>(); };
+            const LevelFloordata floordata;
+
+            for (const uint32_t count : { 16u, 64u, 256u })
+            {
+                std::vector<uint32_t> indices(count);
+                std::iota(indices.begin(), indices.end(), 0u);
+                const auto build = [&](uint32_t i)
+                    {
+                        auto room = std::make_shared<Room>(level_room, mesh_source, texture_storage, i, std::weak_ptr<ILevel>{});
+                        room->build(*tr_level, floordata, level_room, static_mesh_source, static_mesh_position_source, sector_source, 0, std::nullopt);
+                    };
+
+                print(measure(std::format("build {} rooms serial", count), iterations, 0, [&]() { std::for_each(std::execution::seq, indices.begin(), indices.end(), build); }));
+                print(measure(std::format("build {} rooms parallel", count), iterations, 0, [&]() { std::for_each(std::execution::par, indices.begin(), indices.end(), build); }));
+            }
+        }
+
+        // Loads levels of increasing size where the sector triangles shared between neighbouring rooms have to be found.
+        void run_deduplicate_triangles(uint32_t iterations)
+        {
+            for (const uint32_t total : { 10000u, 50000u, 200000u })
+            {
+                const auto rooms = generate_rooms(200, total / 200, total);
+                print(measure(std::format("deduplicate {} triangles", total), iterations, 0, [&]() { load_level(rooms); }));
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include "Benchmarks.h"
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <trlevel/Decrypter.h>
+#include <trlevel/Level.h>
+#include <trlevel.benchmarks/SyntheticLevel.h>
+#include <trview.app/Elements/Floordata.h>
+#include <trview.common/Files.h>
+#include <trview.common/Logs/Log.h>
+#include <trview.tests.common/Benchmark.h>
+
+using namespace trview::tests::benchmark;
+
+namespace trview
+{
+    namespace benchmarks
+    {
+        namespace
+        {
+            void write_file(const std::filesystem::path& path, const std::vector<uint8_t>& bytes)
+            {
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            }
+
+            /// Loads a generated level so that floordata is decoded from the same sectors a real level would have.
+            std::shared_ptr<trlevel::Level> load_synthetic_level(const trlevel::PlatformAndVersion& target, const std::filesystem::path& folder)
+            {
+                const auto synthetic = trlevel::generate_level(target, {});
+                std::filesystem::create_directories(folder);
+                const auto filename = (folder / synthetic.filename).string();
+                write_file(filename, synthetic.level);
+                for (const auto& [file, bytes] : synthetic.files)
+                {
+                    write_file(folder / file, bytes);
+                }
+
+                auto level = std::make_shared<trlevel::Level>(filename, nullptr, std::make_shared<Files>(), std::make_shared<trlevel::Decrypter>(), std::make_shared<Log>());
+                level->load({});
+                return level;
+            }
+        }
+
+        // Compares decoding each distinct floordata list once for the whole level with decoding the list for every sector.
+        void run_floordata(uint32_t iterations)
+        {
+            const auto directory = std::filesystem::temp_directory_path() / "trview.app.benchmarks";
+            for (const auto version : { trlevel::LevelVersion::Tomb1, trlevel::LevelVersion::Tomb4 })
+            {
+                const trlevel::PlatformAndVersion target{ .platform = trlevel::Platform::PC, .version = version };
+                const auto level = load_synthetic_level(target, directory / std::format("tr{}_pc", static_cast<int>(version)));
+
+                std::vector<uint32_t> sector_indices;
+                for (uint32_t r = 0; r < level->num_rooms(); ++r)
+                {
+                    for (const auto& sector : level->get_room(r).sector_list)
+                    {
+                        sector_indices.push_back(sector.floordata_index);
+                    }
+                }
+
+                const auto floordata = level->get_floor_data_all();
+                const auto bytes = floordata.size() * sizeof(uint16_t);
+                print(measure(std::format("tr{}_pc LevelFloordata", static_cast<int>(version)), iterations, bytes, [&]()
+                    {
+                        const LevelFloordata result(*level);
+                        if (result.size() != floordata.size())
+                        {
+                            throw std::runtime_error("Floordata decoded with the wrong size");
+                        }
+                    }));
+                print(measure(std::format("tr{}_pc parse_floordata per sector", static_cast<int>(version)), iterations, bytes, [&]()
+                    {
+                        for (const auto index : sector_indices)
+                        {
+                            parse_floordata(floordata, index, FloordataMeanings::None, level->trng(), level->platform_and_version());
+                        }
+                    }));
+            }
+            std::filesystem::remove_all(directory);
+        }
+    }
+}
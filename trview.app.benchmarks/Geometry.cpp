@@ -0,0 +1,189 @@
+#include "Benchmarks.h"
+
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <trview.app/Geometry/TriangleBvh.h>
+#include <trview.app/Geometry/TrianglePacket.h>
+#include <trview.app/Geometry/TransparencySort.h>
+#include <trview.app/Geometry/TransparentTriangle.h>
+#include <trview.tests.common/Benchmark.h>
+
+using namespace trview::tests::benchmark;
+
+namespace trview
+{
+    namespace benchmarks
+    {
+        // Compares picking against a mesh with and without the triangle hierarchy. Each run casts a fixed number of
+        // rays, so the time is the cost of that many rays at each triangle count.
+        void run_picking(uint32_t iterations)
+        {
+            using namespace DirectX::SimpleMath;
+
+            const uint32_t rays = 1000;
+            std::mt19937 random(1234);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> offset(-2.0f, 2.0f);
+
+            for (const uint32_t count : { 256u, 1024u, 4096u, 16384u })
+            {
+                std::vector<Triangle> triangles;
+                for (uint32_t t = 0; t < count; ++t)
+                {
+                    const Vector3 centre(position(random), position(random) * 0.1f, position(random));
+                    triangles.push_back(Triangle(
+                        centre + Vector3(offset(random), offset(random), offset(random)),
+                        centre + Vector3(offset(random), offset(random), offset(random)),
+                        centre + Vector3(offset(random), offset(random), offset(random))));
+                }
+
+                std::vector<std::pair<Vector3, Vector3>> ray_set;
+                for (uint32_t r = 0; r < rays; ++r)
+                {
+                    const Vector3 start(position(random), 50.0f, position(random));
+                    Vector3 direction = Vector3(position(random), 0.0f, position(random)) - start;
+                    direction.Normalize();
+                    ray_set.push_back({ start, direction });
+                }
+
+                std::size_t hits = 0;
+                print(measure(std::format("pick {} brute force", count), iterations, 0, [&]()
+                    {
+                        for (const auto& [start, direction] : ray_set)
+                        {
+                            float nearest = FLT_MAX;
+                            for (const auto& triangle : triangles)
+                            {
+                                float distance = 0;
+                                if (direction.Dot(triangle.normal) < 0 &&
+                                    DirectX::TriangleTests::Intersects(start, direction, triangle.v0, triangle.v1, triangle.v2, distance) &&
+                                    distance < nearest)
+                                {
+                                    nearest = distance;
+                                }
+                            }
+                            hits += nearest != FLT_MAX;
+                        }
+                    }));
+
+                std::vector<TrianglePacket> packets;
+                pack_triangles(triangles, packets);
+                const auto packed = [&](auto&& intersect)
+                    {
+                        std::size_t packed_hits = 0;
+                        for (const auto& [start, direction] : ray_set)
+                        {
+                            float nearest = FLT_MAX;
+                            TrianglePacket::Lanes distances;
+                            for (const auto& packet : packets)
+                            {
+                                for (uint32_t mask = intersect(packet, start, direction, nearest, distances); mask; mask &= mask - 1)
+                                {
+                                    nearest = std::min(nearest, distances[std::countr_zero(mask)]);
+                                }
+                            }
+                            packed_hits += nearest != FLT_MAX;
+                        }
+                        return packed_hits;
+                    };
+
+                std::size_t scalar_hits = 0;
+                std::size_t simd_hits = 0;
+                print(measure(std::format("pick {} packets scalar", count), iterations, 0, [&]() { scalar_hits += packed(scalar::intersect_packet); }));
+                print(measure(std::format("pick {} packets simd", count), iterations, 0, [&]() { simd_hits += packed(intersect_packet); }));
+                if (scalar_hits != hits || simd_hits != hits)
+                {
+                    throw std::runtime_error("Packet picking did not match testing every triangle");
+                }
+
+                std::optional<TriangleBvh> bvh;
+                print(measure(std::format("pick {} build", count), 1, 0, [&]() { bvh.emplace(triangles); }));
+                print(measure(std::format("pick {} bvh", count), iterations, 0, [&]()
+                    {
+                        for (const auto& [start, direction] : ray_set)
+                        {
+                            hits -= bvh->pick(start, direction).has_value();
+                        }
+                    }));
+
+                if (hits != 0)
+                {
+                    throw std::runtime_error("Hierarchy picking did not match testing every triangle");
+                }
+            }
+        }
+
+        // Compares sorting transparent triangles by comparing their distances with sorting precomputed distances, both from
+        // scratch and while the camera moves a little each frame. Each run collects the triangles again, as a frame does.
+        void run_transparency(uint32_t iterations)
+        {
+            using namespace DirectX::SimpleMath;
+
+            std::mt19937 random(1234);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+
+            for (const uint32_t count : { 50000u, 100000u, 250000u, 500000u })
+            {
+                std::vector<TransparentTriangle> triangles;
+                triangles.reserve(count);
+                for (uint32_t t = 0; t < count; ++t)
+                {
+                    const Vector3 centre(position(random), position(random) * 0.1f, position(random));
+                    triangles.push_back(TransparentTriangle(centre, centre + Vector3(0.5f, 0, 0), centre + Vector3(0, 0, 0.5f), Color(1, 1, 1), Color(1, 1, 1), Color(1, 1, 1)));
+                }
+
+                Vector3 eye(0, 20.0f, 0);
+                std::vector<TransparentTriangle> collected;
+                print(measure(std::format("transparency {} std::sort", count), iterations, 0, [&]()
+                    {
+                        collected = triangles;
+                        std::sort(collected.begin(), collected.end(), [&](const auto& l, const auto& r)
+                            {
+                                return Vector3::DistanceSquared(eye, l.position) > Vector3::DistanceSquared(eye, r.position);
+                            });
+                    }));
+
+                std::vector<float> distances(count);
+                const auto collect_and_sort = [&](TransparencySort& sorter) -> const std::vector<uint32_t>&
+                    {
+                        collected = triangles;
+                        for (uint32_t t = 0; t < count; ++t)
+                        {
+                            distances[t] = Vector3::DistanceSquared(eye, collected[t].position);
+                        }
+                        return sorter.sort(distances);
+                    };
+
+                print(measure(std::format("transparency {} radix", count), iterations, 0, [&]()
+                    {
+                        TransparencySort sorter;
+                        collect_and_sort(sorter);
+                    }));
+
+                TransparencySort coherent;
+                collect_and_sort(coherent);
+                uint32_t refined = 0;
+                print(measure(std::format("transparency {} coherent", count), iterations, 0, [&]()
+                    {
+                        eye += Vector3(0.002f, 0, 0.002f);
+                        collect_and_sort(coherent);
+                        refined += coherent.refined();
+                    }));
+                std::cout << std::format("transparency {} refined {} of {} frames\n", count, refined, iterations);
+
+                TransparencySort fresh;
+                if (collect_and_sort(coherent) != collect_and_sort(fresh))
+                {
+                    throw std::runtime_error("Coherent transparency sort did not match sorting from scratch");
+                }
+            }
+        }
+    }
+}
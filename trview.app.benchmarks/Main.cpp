@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <format>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <external/imgui/imgui_internal.h>
+#include <trview.tests.common/Benchmark.h>
+
+#include "Benchmarks.h"
+
+using namespace trview::benchmarks;
+using namespace trview::tests::benchmark;
+
+namespace
+{
+    struct Options
+    {
+        uint32_t iterations{ 5 };
+    };
+
+    Options parse_options(int argc, char** argv)
+    {
+        Options options;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "--iterations" && i + 1 < argc)
+            {
+                options.iterations = std::max(static_cast<uint32_t>(std::stoul(argv[++i])), 1u);
+            }
+            else
+            {
+                throw std::invalid_argument(std::format("Unknown argument {}", arg));
+            }
+        }
+        return options;
+    }
+}
+
+void ImGuiTrviewTestEngineHook_ItemText(ImGuiContext*, ImGuiID, const char*)
+{
+}
+
+void ImGuiTrviewTestEngineHook_RenderedText(ImGuiContext*, ImGuiID, const char*)
+{
+}
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const auto options = parse_options(argc, argv);
+        print_header();
+        run_picking(options.iterations);
+        run_transparency(options.iterations);
+        run_room_build(options.iterations);
+        run_deduplicate_triangles(options.iterations);
+        run_floordata(options.iterations);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#define NOMINMAX
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Windows.h>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
@@ -1,5 +1,6 @@
 #include <trview.app/Application.h>
 #include <trview.app/Mocks/Elements/ILevel.h>
+#include <trview.app/Mocks/Elements/ILevelCache.h>
 #include <trview.app/Mocks/Elements/ILight.h>
 #include <trview.app/Mocks/Elements/ISector.h>
 #include <trview.app/Mocks/Elements/ICameraSink.h>
@@ -66,13 +67,14 @@ namespace
             IRandomizerRoute::Source randomizer_route_source { [](auto&&...) { return mock_shared<MockRandomizerRoute>(); } };
             std::shared_ptr<IFonts> fonts { mock_shared<MockFonts>() };
             std::unique_ptr<IWindows> windows{ mock_unique<MockWindows>() };
+            std::shared_ptr<ILevelCache> level_cache{ mock_shared<MockLevelCache>() };
 
             std::unique_ptr<Application> build()
             {
                 EXPECT_CALL(*shortcuts, add_shortcut).WillRepeatedly([&](auto, auto) -> Event<>&{ return shortcut_handler; });
                 return std::make_unique<Application>(window, std::move(update_checker), std::move(settings_loader),
                     std::move(file_menu), std::move(viewer), route_source, shortcuts, level_source, startup_options, dialogs, files,
-                    std::move(imgui_backend), plugins, randomizer_route_source, fonts, std::move(windows), Application::LoadMode::Sync);
+                    std::move(imgui_backend), plugins, randomizer_route_source, fonts, std::move(windows), level_cache, Application::LoadMode::Sync);
             }
 
             test_module& with_dialogs(std::shared_ptr<IDialogs> dialogs)
@@ -158,6 +160,12 @@ namespace
                 this->fonts = fonts;
                 return *this;
             }
+
+            test_module& with_level_cache(std::shared_ptr<ILevelCache> level_cache)
+            {
+                this->level_cache = level_cache;
+                return *this;
+            }
         };
         return test_module{};
     }
@@ -243,6 +251,22 @@ TEST(Application, WindowContentsResetBeforeViewerLoaded)
     ASSERT_EQ(events.back(), "viewer");
 }
 
+TEST(Application, RouteBoundAgainWhenProgressiveLoadCompletes)
+{
+    auto level = mock_shared<mocks::MockLevel>();
+    auto level_source = [&](auto&&...) { return level; };
+    auto route = mock_shared<MockRoute>();
+    auto application = register_test_module()
+        .with_level_source(level_source)
+        .with_route_source([&](auto&&...) { return route; })
+        .build();
+    application->open("test_path.tr2", ILevel::OpenMode::Full);
+
+    EXPECT_CALL(*route, set_level).Times(1);
+    level->on_load_stage(ILevel::LoadStage::Items);
+    level->on_load_stage(ILevel::LoadStage::Complete);
+}
+
 TEST(Application, PropagatesSettingsWhenUpdated)
 {
     auto [viewer_ptr, viewer] = create_mock<MockViewer>();
@@ -252,6 +276,16 @@ TEST(Application, PropagatesSettingsWhenUpdated)
     viewer.on_settings({});
 }
 
+TEST(Application, PropagatesSettingsToLevelCache)
+{
+    auto [viewer_ptr, viewer] = create_mock<MockViewer>();
+    auto level_cache = mock_shared<MockLevelCache>();
+    EXPECT_CALL(*level_cache, set_settings).Times(2);
+
+    auto application = register_test_module().with_viewer(std::move(viewer_ptr)).with_level_cache(level_cache).build();
+    viewer.on_settings({});
+}
+
 TEST(Application, SavesSettingsOnShutdown)
 {
     auto [settings_loader_ptr, settings_loader] = create_mock<MockSettingsLoader>();
@@ -259,6 +293,25 @@ TEST(Application, SavesSettingsOnShutdown)
     auto application = register_test_module().with_settings_loader(std::move(settings_loader_ptr)).build();
 }
 
+TEST(Application, ParallelRoomsSettingUsedToLoadLevel)
+{
+    UserSettings settings;
+    settings.parallel_rooms = false;
+    auto [settings_loader_ptr, settings_loader] = create_mock<MockSettingsLoader>();
+    ON_CALL(settings_loader, load_user_settings).WillByDefault(Return(settings));
+
+    std::optional<bool> parallel_rooms;
+    auto level_source = [&](auto&&, auto&&, const trlevel::ILevel::LoadCallbacks& callbacks)
+        {
+            parallel_rooms = callbacks.parallel_rooms;
+            return mock_unique<mocks::MockLevel>();
+        };
+    auto application = register_test_module().with_settings_loader(std::move(settings_loader_ptr)).with_level_source(level_source).build();
+    application->open("test.tr2", ILevel::OpenMode::Full);
+
+    ASSERT_EQ(parallel_rooms, false);
+}
+
 TEST(Application, FileOpenedFromCommandLine)
 {
     auto startup_options = mock_shared<MockStartupOptions>();
@@ -0,0 +1,62 @@
+#include <trview.app/Elements/Floordata.h>
+#include <trlevel/Mocks/ILevel.h>
+
+using namespace trview;
+using namespace trlevel;
+using testing::NiceMock;
+using testing::Return;
+using testing::ReturnRef;
+
+namespace
+{
+    // A portal list at 1 and a death list at 3.
+    const std::vector<uint16_t> floor_data{ 0x0000, 0x8001, 378, 0x8005 };
+}
+
+TEST(LevelFloordata, AtFindsCommandsAtOffset)
+{
+    const LevelFloordata floordata(floor_data, { 1, 3 }, false);
+
+    const auto& portal = floordata.at(1);
+    ASSERT_EQ(portal.commands.size(), 1);
+    ASSERT_EQ(portal.commands[0].type, Floordata::Command::Function::Portal);
+
+    const auto& death = floordata.at(3);
+    ASSERT_EQ(death.commands.size(), 1);
+    ASSERT_EQ(death.commands[0].type, Floordata::Command::Function::Death);
+}
+
+TEST(LevelFloordata, AtOffsetNotDecodedIsEmpty)
+{
+    const LevelFloordata floordata(floor_data, { 1, 3 }, false);
+    ASSERT_TRUE(floordata.at(0).commands.empty());
+    ASSERT_TRUE(floordata.at(2).commands.empty());
+}
+
+TEST(LevelFloordata, AtIndexPastLastCommandIsEmpty)
+{
+    const LevelFloordata floordata(floor_data, { 1, 3, 10 }, false);
+    ASSERT_EQ(floordata.size(), floor_data.size());
+    ASSERT_TRUE(floordata.at(4).commands.empty());
+    ASSERT_TRUE(floordata.at(10).commands.empty());
+    ASSERT_TRUE(floordata.at(UINT32_MAX).commands.empty());
+}
+
+TEST(LevelFloordata, SectorListsDecodedFromLevel)
+{
+    NiceMock<trlevel::mocks::MockLevel> level;
+    ON_CALL(level, get_floor_data_all).WillByDefault(Return(floor_data));
+
+    tr3_room tr_room{};
+    tr_room.sector_list.push_back({ 1, 0xffff, 255, 0, 255, 0 });
+    tr_room.sector_list.push_back({ 3, 0xffff, 255, 0, 255, 0 });
+    ON_CALL(level, num_rooms).WillByDefault(Return(1));
+    ON_CALL(level, get_room).WillByDefault(ReturnRef(tr_room));
+
+    const LevelFloordata floordata(level);
+    ASSERT_EQ(floordata.at(1).commands.size(), 1);
+    ASSERT_EQ(floordata.at(1).commands[0].type, Floordata::Command::Function::Portal);
+    ASSERT_EQ(floordata.at(3).commands.size(), 1);
+    ASSERT_EQ(floordata.at(3).commands[0].type, Floordata::Command::Function::Death);
+    ASSERT_TRUE(floordata.at(2).commands.empty());
+}
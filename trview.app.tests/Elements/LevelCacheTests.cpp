@@ -0,0 +1,216 @@
+#include <trview.app/Elements/LevelCache.h>
+#include <trview.app/Elements/LevelCacheWriter.h>
+#include <trview.app/Mocks/Elements/ILevelCache.h>
+#include <trview.common/Mocks/IFiles.h>
+
+using namespace trview;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace testing;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    std::shared_ptr<MockMappedFile> mapped(const std::vector<uint8_t>& bytes)
+    {
+        auto file = std::make_shared<NiceMock<MockMappedFile>>();
+        ON_CALL(*file, data).WillByDefault(Return(std::span<const uint8_t>(bytes)));
+        return file;
+    }
+
+    std::shared_ptr<MockFiles> create_files()
+    {
+        auto files = mock_shared<MockFiles>();
+        ON_CALL(*files, appdata_directory).WillByDefault(Return("appdata"));
+        return files;
+    }
+
+    UserSettings enabled(uint32_t size = 1024)
+    {
+        UserSettings settings;
+        settings.level_cache = true;
+        settings.level_cache_size = size;
+        return settings;
+    }
+
+    IFiles::File info(uint32_t size, uint64_t last_write_time)
+    {
+        return { .path = "level.tr2", .friendly_name = "level.tr2", .size = size, .last_write_time = last_write_time };
+    }
+}
+
+TEST(LevelCache, KeyEmptyWhenDisabled)
+{
+    auto files = create_files();
+    EXPECT_CALL(*files, file_info).Times(0);
+    EXPECT_CALL(*files, map_file).Times(0);
+
+    LevelCache cache(files, "1.0.0");
+    ASSERT_FALSE(cache.key("level.tr2").has_value());
+}
+
+TEST(LevelCache, KeyDoesNotReadLevel)
+{
+    auto files = create_files();
+    ON_CALL(*files, file_info("level.tr2")).WillByDefault(Return(info(4, 1)));
+    EXPECT_CALL(*files, map_file).Times(0);
+    EXPECT_CALL(*files, load_file(A<const std::string&>())).Times(0);
+
+    LevelCache cache(files, "1.0.0");
+    cache.set_settings(enabled());
+    ASSERT_TRUE(cache.key("level.tr2").has_value());
+}
+
+TEST(LevelCache, KeyDependsOnFileDetails)
+{
+    auto files = create_files();
+    EXPECT_CALL(*files, file_info("level.tr2"))
+        .WillOnce(Return(info(4, 1)))
+        .WillOnce(Return(info(4, 2)))
+        .WillOnce(Return(info(5, 1)));
+
+    LevelCache cache(files, "1.0.0");
+    cache.set_settings(enabled());
+
+    const auto first = cache.key("level.tr2");
+    const auto written = cache.key("level.tr2");
+    const auto resized = cache.key("level.tr2");
+    ASSERT_NE(first, written);
+    ASSERT_NE(first, resized);
+    ASSERT_NE(written, resized);
+}
+
+TEST(LevelCache, KeyDependsOnVersion)
+{
+    auto files = create_files();
+    ON_CALL(*files, file_info("level.tr2")).WillByDefault(Return(info(4, 1)));
+
+    LevelCache first(files, "1.0.0");
+    first.set_settings(enabled());
+    LevelCache second(files, "1.0.1");
+    second.set_settings(enabled());
+
+    const auto first_key = first.key("level.tr2");
+    ASSERT_TRUE(first_key.has_value());
+    ASSERT_EQ(first_key, first.key("level.tr2"));
+    ASSERT_NE(first_key, second.key("level.tr2"));
+}
+
+TEST(LevelCache, SaveThenLoadRoundTrip)
+{
+    RoomGeometry room;
+    room.vertices.push_back({ .pos = Vector3(1, 2, 3), .normal = Vector3(0, 1, 0), .uv = Vector2(0.5f, 0.25f), .colour = Color(1, 0, 0) });
+    room.indices = { { 0, 1, 2 }, {}, { 3 } };
+    room.collision_triangles.push_back(Triangle(Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 0, 1)));
+
+    const std::vector<uint8_t> level{ 1, 2, 3, 4 };
+    std::vector<uint8_t> saved;
+    auto files = create_files();
+    ON_CALL(*files, map_file("level.tr2")).WillByDefault([&](auto&&) { return mapped(level); });
+    EXPECT_CALL(*files, save_file(A<const std::string&>(), A<const std::vector<uint8_t>&>()))
+        .WillOnce([&](auto&& filename, auto&& bytes)
+            {
+                ASSERT_EQ(filename, "appdata\\trview\\cache\\key.trcache");
+                saved = bytes;
+            });
+    EXPECT_CALL(*files, map_file("appdata\\trview\\cache\\key.trcache")).WillOnce([&](auto&&) { return mapped(saved); });
+    EXPECT_CALL(*files, delete_file).Times(0);
+    EXPECT_CALL(*files, touch_file("appdata\\trview\\cache\\key.trcache")).Times(1);
+
+    LevelCache cache(files, "1.0.0");
+    cache.set_settings(enabled());
+    cache.save("key", "level.tr2", { room, RoomGeometry{} });
+
+    const auto loaded = cache.load("key", "level.tr2");
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->size(), 2u);
+    ASSERT_EQ(loaded->at(0).vertices.size(), 1u);
+    ASSERT_EQ(loaded->at(0).vertices[0].pos, Vector3(1, 2, 3));
+    ASSERT_EQ(loaded->at(0).vertices[0].uv, Vector2(0.5f, 0.25f));
+    ASSERT_EQ(loaded->at(0).indices, room.indices);
+    ASSERT_EQ(loaded->at(0).collision_triangles.size(), 1u);
+    ASSERT_TRUE(loaded->at(1).vertices.empty());
+    ASSERT_TRUE(loaded->at(1).indices.empty());
+}
+
+TEST(LevelCache, InvalidEntryDeleted)
+{
+    const std::vector<uint8_t> bytes{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    auto files = create_files();
+    ON_CALL(*files, map_file("appdata\\trview\\cache\\key.trcache")).WillByDefault(Return(mapped(bytes)));
+    EXPECT_CALL(*files, delete_file("appdata\\trview\\cache\\key.trcache")).Times(1);
+    EXPECT_CALL(*files, touch_file).Times(0);
+
+    LevelCache cache(files, "1.0.0");
+    cache.set_settings(enabled());
+    ASSERT_FALSE(cache.load("key", "level.tr2").has_value());
+}
+
+TEST(LevelCache, ChangedLevelContentsDeleted)
+{
+    std::vector<uint8_t> level{ 1, 2, 3, 4 };
+    std::vector<uint8_t> saved;
+    auto files = create_files();
+    ON_CALL(*files, map_file("level.tr2")).WillByDefault([&](auto&&) { return mapped(level); });
+    ON_CALL(*files, save_file(A<const std::string&>(), A<const std::vector<uint8_t>&>())).WillByDefault([&](auto&&, auto&& bytes) { saved = bytes; });
+    ON_CALL(*files, map_file("appdata\\trview\\cache\\key.trcache")).WillByDefault([&](auto&&) { return mapped(saved); });
+    EXPECT_CALL(*files, delete_file("appdata\\trview\\cache\\key.trcache")).Times(1);
+    EXPECT_CALL(*files, touch_file).Times(0);
+
+    LevelCache cache(files, "1.0.0");
+    cache.set_settings(enabled());
+    cache.save("key", "level.tr2", { RoomGeometry{} });
+
+    level[0] = 5;
+    ASSERT_FALSE(cache.load("key", "level.tr2").has_value());
+}
+
+TEST(LevelCache, TrimRemovesOldestOverLimit)
+{
+    auto files = create_files();
+    ON_CALL(*files, get_files("appdata\\trview\\cache", "\\*.trcache")).WillByDefault(Return(std::vector<IFiles::File>
+        {
+            { .path = "oldest", .size = 300 * 1024, .last_write_time = 1 },
+            { .path = "newest", .size = 600 * 1024, .last_write_time = 3 },
+            { .path = "middle", .size = 600 * 1024, .last_write_time = 2 },
+        }));
+    const std::vector<uint8_t> level{ 1, 2, 3, 4 };
+    ON_CALL(*files, map_file("level.tr2")).WillByDefault(Return(mapped(level)));
+    EXPECT_CALL(*files, delete_file).Times(0);
+    EXPECT_CALL(*files, delete_file("middle")).Times(1);
+
+    LevelCache cache(files, "1.0.0");
+    cache.set_settings(enabled(1));
+    cache.save("key", "level.tr2", {});
+}
+
+TEST(LevelCacheWriter, PartlyBuiltLevelNotSaved)
+{
+    auto cache = mock_shared<MockLevelCache>();
+    EXPECT_CALL(*cache, save).Times(0);
+
+    LevelCacheWriter writer(cache, "key", "level.tr2", 3);
+    writer.add(0, {});
+    writer.add(2, {});
+    writer.add(2, {});
+}
+
+TEST(LevelCacheWriter, SavedOnceEveryRoomBuilt)
+{
+    RoomGeometry room;
+    room.indices = { { 0, 1, 2 } };
+
+    auto cache = mock_shared<MockLevelCache>();
+    std::vector<RoomGeometry> saved;
+    EXPECT_CALL(*cache, save("key", "level.tr2", An<const std::vector<RoomGeometry>&>())).WillOnce([&](auto&&, auto&&, auto&& rooms) { saved = rooms; });
+
+    LevelCacheWriter writer(cache, "key", "level.tr2", 3);
+    writer.add(2, {});
+    writer.add(0, {});
+    writer.add(1, room);
+    writer.add(1, room);
+
+    ASSERT_EQ(saved.size(), 3u);
+    ASSERT_EQ(saved[1].indices, room.indices);
+    ASSERT_TRUE(saved[0].indices.empty());
+}
@@ -24,6 +24,7 @@
 #include <trview.graphics/mocks/IBuffer.h>
 #include <trview.tests.common/Event.h>
 #include <trview.app/Mocks/Elements/INgPlusSwitcher.h>
+#include <random>
 
 using namespace trview;
 using namespace trview::mocks;
@@ -33,6 +34,7 @@ using namespace trlevel;
 using namespace trlevel::mocks;
 using namespace trview::tests;
 using testing::Return;
+using testing::ReturnRef;
 using testing::A;
 using testing::NiceMock;
 using namespace DirectX::SimpleMath;
@@ -249,7 +251,7 @@ TEST(Level, PickUsesCorrectDefaultFilters)
 
     auto room = mock_shared<MockRoom>();
     ON_CALL(*room, visible).WillByDefault(Return(true));
-    EXPECT_CALL(*room, pick(A<const Vector3&>(), A<const Vector3&>(), PickFilter::Geometry | PickFilter::Entities | PickFilter::StaticMeshes | PickFilter::Triggers)).Times(1);
+    EXPECT_CALL(*room, pick_targets(PickFilter::Geometry | PickFilter::Entities | PickFilter::StaticMeshes | PickFilter::Triggers)).Times(1);
 
     auto level = register_test_module()
         .with_level(std::move(mock_level_ptr))
@@ -267,7 +269,7 @@ TEST(Level, PickUsesCorrectOptionalFilters)
 
     auto room = mock_shared<MockRoom>();
     ON_CALL(*room, visible).WillByDefault(Return(true));
-    EXPECT_CALL(*room, pick(A<const Vector3&>(), A<const Vector3&>(), PickFilter::Geometry | PickFilter::Entities | PickFilter::StaticMeshes | PickFilter::Triggers | PickFilter::AllGeometry | PickFilter::Lights)).Times(1);
+    EXPECT_CALL(*room, pick_targets(PickFilter::Geometry | PickFilter::Entities | PickFilter::StaticMeshes | PickFilter::Triggers | PickFilter::AllGeometry | PickFilter::Lights)).Times(1);
 
     auto level = register_test_module()
         .with_level(std::move(mock_level_ptr))
@@ -288,7 +290,7 @@ TEST(Level, PickUsesCorrectMinimalFilters)
 
     auto room = mock_shared<MockRoom>();
     ON_CALL(*room, visible).WillByDefault(Return(true));
-    EXPECT_CALL(*room, pick(A<const Vector3&>(), A<const Vector3&>(), PickFilter::Geometry | PickFilter::StaticMeshes)).Times(1);
+    EXPECT_CALL(*room, pick_targets(PickFilter::Geometry | PickFilter::StaticMeshes)).Times(1);
 
     auto level = register_test_module()
         .with_level(std::move(mock_level_ptr))
@@ -302,6 +304,54 @@ TEST(Level, PickUsesCorrectMinimalFilters)
     level->pick(camera, Vector3::Zero, Vector3::Forward);
 }
 
+TEST(Level, PickSceneReusedUntilFiltersChange)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    EXPECT_CALL(mock_level, num_rooms()).WillRepeatedly(Return(1));
+
+    auto room = mock_shared<MockRoom>();
+    ON_CALL(*room, visible).WillByDefault(Return(true));
+    EXPECT_CALL(*room, pick_targets).Times(2);
+
+    auto level = register_test_module()
+        .with_level(std::move(mock_level_ptr))
+        .with_room_source([&](auto&&...) { return room; })
+        .build();
+
+    const auto scene = level->pick_scene();
+    ASSERT_EQ(level->pick_scene(), scene);
+    level->set_show_lights(true);
+    ASSERT_NE(level->pick_scene(), scene);
+}
+
+TEST(Level, PickTargetsKeptWhileOtherRoomsUpload)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    ON_CALL(mock_level, num_rooms()).WillByDefault(Return(10));
+
+    std::vector<uint32_t> pick_targets_called(10);
+    auto module = register_test_module();
+    module.callbacks.progressive = true;
+    auto level = module
+        .with_level(std::move(mock_level_ptr))
+        .with_room_source(
+            [&](auto&&, auto&&, auto&&, auto&&, uint32_t index, auto&&...)
+            {
+                auto room = mock_shared<MockRoom>()->with_number(index);
+                ON_CALL(*room, visible).WillByDefault(Return(true));
+                ON_CALL(*room, pick_targets).WillByDefault([&pick_targets_called, index](auto&&...) { ++pick_targets_called[index]; return std::vector<PickTarget>{}; });
+                return room;
+            })
+        .build();
+
+    // Only room 0 is uploaded at first, the next step uploads rooms 1 to 8.
+    const auto scene = level->pick_scene();
+    level->continue_load();
+    ASSERT_EQ(level->load_stage(), ILevel::LoadStage::StartRooms);
+    ASSERT_NE(level->pick_scene(), scene);
+    ASSERT_EQ(pick_targets_called, (std::vector<uint32_t>{ 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 }));
+}
+
 TEST(Level, BoundingBoxesNotRenderedWhenDisabled)
 {
     auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
@@ -508,7 +558,7 @@ TEST(Level, SelectedLight)
     room.lights.resize(5);
     auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
     ON_CALL(mock_level, num_rooms).WillByDefault(Return(1));
-    ON_CALL(mock_level, get_room).WillByDefault(Return(room));
+    ON_CALL(mock_level, get_room).WillByDefault(ReturnRef(room));
     
     uint32_t light_source_called = 0;
     auto level = register_test_module()
@@ -635,6 +685,198 @@ TEST(Level, TriggerNotFound)
     ASSERT_EQ(trigger, nullptr);
 }
 
+TEST(Level, RoomsBuiltInParallelAreUploadedInOrder)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    ON_CALL(mock_level, num_rooms()).WillByDefault(Return(16));
+
+    std::vector<std::shared_ptr<MockRoom>> rooms(16);
+    std::vector<uint32_t> uploaded;
+
+    auto module = register_test_module();
+    module.callbacks.parallel_rooms = true;
+    auto level = module
+        .with_level(std::move(mock_level_ptr))
+        .with_room_source(
+            [&](auto&&, auto&&, auto&&, auto&&, uint32_t index, auto&&...)
+            {
+                auto room = mock_shared<MockRoom>()->with_number(index);
+                ON_CALL(*room, upload).WillByDefault([&uploaded, index](auto&&...) { uploaded.push_back(index); });
+                rooms[index] = room;
+                return room;
+            })
+        .build();
+
+    std::vector<uint32_t> expected(16);
+    std::iota(expected.begin(), expected.end(), 0u);
+    ASSERT_EQ(uploaded, expected);
+    for (uint32_t i = 0; i < rooms.size(); ++i)
+    {
+        ASSERT_EQ(level->room(i).lock(), rooms[i]);
+    }
+}
+
+TEST(Level, FullLoadIsComplete)
+{
+    auto level = register_test_module().build();
+    ASSERT_EQ(level->load_stage(), ILevel::LoadStage::Complete);
+}
+
+TEST(Level, ProgressiveLoadUploadsStartRoomsFirst)
+{
+    tr2_entity lara{};
+    lara.TypeID = 0;
+    lara.Room = 2;
+
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    ON_CALL(mock_level, num_rooms()).WillByDefault(Return(5));
+    ON_CALL(mock_level, num_entities()).WillByDefault(Return(1));
+    ON_CALL(mock_level, get_entity(0)).WillByDefault(Return(lara));
+
+    // 0 - 1 - 2 - 3, with 4 not connected.
+    const std::vector<std::set<uint16_t>> neighbours{ { 1 }, { 0, 2 }, { 1, 3 }, { 2 }, {} };
+    std::vector<tr3_room> level_rooms(neighbours.size());
+    for (uint32_t i = 0; i < neighbours.size(); ++i)
+    {
+        for (const auto neighbour : neighbours[i])
+        {
+            level_rooms[i].portals.push_back({ .adjoining_room = neighbour });
+        }
+        ON_CALL(mock_level, get_room(i)).WillByDefault(ReturnRef(level_rooms[i]));
+    }
+
+    std::vector<uint32_t> built;
+    std::vector<uint32_t> uploaded;
+    uint32_t entity_source_called = 0;
+
+    auto module = register_test_module();
+    module.callbacks.progressive = true;
+    auto level = module
+        .with_level(std::move(mock_level_ptr))
+        .with_room_source(
+            [&](auto&&, auto&&, auto&&, auto&&, uint32_t index, auto&&...)
+            {
+                built.push_back(index);
+                auto room = mock_shared<MockRoom>()->with_number(index);
+                ON_CALL(*room, neighbours).WillByDefault(Return(neighbours[index]));
+                ON_CALL(*room, upload).WillByDefault([&uploaded, index](auto&&...) { uploaded.push_back(index); });
+                return room;
+            })
+        .with_entity_source(
+            [&](auto&&...)
+            {
+                ++entity_source_called;
+                return mock_shared<MockItem>();
+            })
+        .build();
+
+    ASSERT_EQ(level->load_stage(), ILevel::LoadStage::StartRooms);
+    ASSERT_EQ(built, (std::vector<uint32_t>{ 2, 1, 3 }));
+    ASSERT_EQ(uploaded, (std::vector<uint32_t>{ 2, 1, 3 }));
+    ASSERT_EQ(level->room(0).lock(), nullptr);
+    ASSERT_EQ(level->start_room().lock(), level->room(2).lock());
+    ASSERT_EQ(entity_source_called, 0);
+
+    std::vector<ILevel::LoadStage> stages;
+    auto token = level->on_load_stage += [&](auto stage) { stages.push_back(stage); };
+    while (level->load_stage() != ILevel::LoadStage::Complete)
+    {
+        level->continue_load();
+    }
+
+    ASSERT_EQ(built, (std::vector<uint32_t>{ 2, 1, 3, 0, 4 }));
+    ASSERT_EQ(uploaded, (std::vector<uint32_t>{ 2, 1, 3, 0, 4 }));
+    ASSERT_EQ(stages, (std::vector<ILevel::LoadStage>{ ILevel::LoadStage::Rooms, ILevel::LoadStage::Triggers, ILevel::LoadStage::Items, ILevel::LoadStage::Complete }));
+    ASSERT_EQ(entity_source_called, 1);
+}
+
+TEST(Level, FinishLoadCompletesProgressiveLoad)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    ON_CALL(mock_level, num_rooms()).WillByDefault(Return(2));
+    ON_CALL(mock_level, num_entities()).WillByDefault(Return(1));
+
+    uint32_t entity_source_called = 0;
+    auto module = register_test_module();
+    module.callbacks.progressive = true;
+    auto level = module
+        .with_level(std::move(mock_level_ptr))
+        .with_entity_source(
+            [&](auto&&...)
+            {
+                ++entity_source_called;
+                return mock_shared<MockItem>();
+            })
+        .build();
+    ASSERT_EQ(level->load_stage(), ILevel::LoadStage::StartRooms);
+
+    level->finish_load();
+    ASSERT_EQ(level->load_stage(), ILevel::LoadStage::Complete);
+    ASSERT_EQ(level->rooms().size(), 2u);
+    ASSERT_EQ(entity_source_called, 1);
+
+    level->finish_load();
+    ASSERT_EQ(level->load_stage(), ILevel::LoadStage::Complete);
+}
+
+TEST(Level, TriggersForItem)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    ON_CALL(mock_level, num_rooms()).WillByDefault(Return(1));
+    ON_CALL(mock_level, num_entities()).WillByDefault(Return(3));
+
+    const std::vector<std::vector<Command>> commands
+    {
+        { Command(0, TriggerCommandType::Object, { 0 }), Command(1, TriggerCommandType::Object, { 0 }) },
+        { Command(0, TriggerCommandType::LookAtItem, { 2 }), Command(1, TriggerCommandType::Camera, { 1 }) },
+        { Command(0, TriggerCommandType::Object, { 2 }) }
+    };
+
+    uint32_t trigger_source_called = 0;
+    std::vector<std::shared_ptr<ITrigger>> triggers;
+    std::vector<std::vector<std::weak_ptr<ITrigger>>> entity_triggers;
+
+    auto level = register_test_module()
+        .with_level(std::move(mock_level_ptr))
+        .with_room_source(
+            [&](auto&&...)
+            {
+                auto room = mock_shared<MockRoom>();
+                auto sector = mock_shared<MockSector>();
+                ON_CALL(*sector, flags).WillByDefault(Return(SectorFlag::Trigger));
+                ON_CALL(*room, sectors).WillByDefault(Return(std::vector<std::shared_ptr<ISector>>(3, sector)));
+                return room;
+            })
+        .with_trigger_source(
+            [&](auto&&...)
+            {
+                auto trigger = mock_shared<MockTrigger>()->with_commands(commands[trigger_source_called++]);
+                triggers.push_back(trigger);
+                return trigger;
+            })
+        .with_entity_source(
+            [&](auto&&, auto&&, auto&&, const std::vector<std::weak_ptr<ITrigger>>& relevant_triggers, auto&&...)
+            {
+                entity_triggers.push_back(relevant_triggers);
+                return mock_shared<MockItem>();
+            })
+        .build();
+
+    const auto locked = [](const std::vector<std::weak_ptr<ITrigger>>& values)
+        {
+            std::vector<std::shared_ptr<ITrigger>> result;
+            std::ranges::transform(values, std::back_inserter(result), [](auto&& t) { return t.lock(); });
+            return result;
+        };
+
+    ASSERT_EQ(entity_triggers.size(), 3);
+    ASSERT_EQ(locked(entity_triggers[0]), (std::vector<std::shared_ptr<ITrigger>>{ triggers[0] }));
+    ASSERT_TRUE(entity_triggers[1].empty());
+    ASSERT_EQ(locked(entity_triggers[2]), (std::vector<std::shared_ptr<ITrigger>>{ triggers[1], triggers[2] }));
+    ASSERT_EQ(locked(level->triggers_for_item(2)), locked(entity_triggers[2]));
+    ASSERT_TRUE(level->triggers_for_item(5).empty());
+}
+
 TEST(Level, Item)
 {
     tr2_entity entity{};
@@ -673,7 +915,7 @@ TEST(Level, Light)
 
     auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
     ON_CALL(mock_level, num_rooms()).WillByDefault(Return(1));
-    ON_CALL(mock_level, get_room).WillByDefault(Return(room));
+    ON_CALL(mock_level, get_room).WillByDefault(ReturnRef(room));
 
     auto level = register_test_module()
         .with_level(std::move(mock_level_ptr))
@@ -856,3 +1098,128 @@ TEST(Level, SetShowSoundSourcesRaisesLevelChangedEvent)
     level->set_show_sound_sources(true);
     ASSERT_EQ(raised, true);
 }
+
+namespace
+{
+    struct GeneratedRoom
+    {
+        std::vector<std::vector<ISector::Triangle>> sectors;
+        std::set<uint16_t> neighbours;
+    };
+
+    /// Generates rooms with triangles on a small grid so that many triangles are shared between rooms, some with
+    /// the same vertices in a different order.
+    std::vector<GeneratedRoom> generate_rooms(uint32_t rooms, uint32_t triangles_per_room, uint32_t seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> coordinate(0, 3);
+        std::uniform_int_distribution<uint32_t> room_number(0, rooms - 1);
+        const auto vertex = [&]() { return Vector3(static_cast<float>(coordinate(random)), static_cast<float>(coordinate(random)) * 0.25f, static_cast<float>(coordinate(random))); };
+
+        std::vector<GeneratedRoom> result(rooms);
+        for (auto& room : result)
+        {
+            room.sectors.resize(4);
+            for (uint32_t t = 0; t < triangles_per_room; ++t)
+            {
+                room.sectors[t % room.sectors.size()].push_back(ISector::Triangle(vertex(), vertex(), vertex(), SectorFlag::None, 0));
+            }
+
+            for (int n = 0; n < 3; ++n)
+            {
+                room.neighbours.insert(static_cast<uint16_t>(room_number(random)));
+            }
+        }
+        return result;
+    }
+
+    /// The original pairwise comparison of every triangle in a room with every triangle in each neighbour.
+    std::vector<std::vector<uint32_t>> pairwise_triangle_rooms(const std::vector<GeneratedRoom>& rooms)
+    {
+        std::vector<std::vector<ISector::Triangle>> triangles;
+        std::vector<std::vector<uint32_t>> result;
+        for (uint32_t r = 0; r < rooms.size(); ++r)
+        {
+            auto& room_triangles = triangles.emplace_back();
+            for (const auto& sector : rooms[r].sectors)
+            {
+                room_triangles.insert(room_triangles.end(), sector.begin(), sector.end());
+            }
+            result.emplace_back(room_triangles.size(), r);
+        }
+
+        for (uint32_t r = 0; r < rooms.size(); ++r)
+        {
+            for (const auto& neighbour : rooms[r].neighbours)
+            {
+                for (uint32_t t = 0; t < triangles[r].size(); ++t)
+                {
+                    for (uint32_t t2 = 0; t2 < triangles[neighbour].size(); ++t2)
+                    {
+                        if (triangles[r][t] == triangles[neighbour][t2])
+                        {
+                            result[r][t] = neighbour;
+                            result[neighbour][t2] = r;
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    /// Loads the generated rooms into a level and returns what each room was given by set_sector_triangle_rooms.
+    std::vector<std::vector<uint32_t>> deduplicated_triangle_rooms(const std::vector<GeneratedRoom>& rooms)
+    {
+        auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+        ON_CALL(mock_level, num_rooms()).WillByDefault(Return(static_cast<uint32_t>(rooms.size())));
+
+        std::vector<std::vector<uint32_t>> result(rooms.size());
+        auto level = register_test_module()
+            .with_level(std::move(mock_level_ptr))
+            .with_room_source(
+                [&](auto&&, auto&&, auto&&, auto&&, uint32_t index, auto&&...)
+                {
+                    auto room = mock_shared<MockRoom>()->with_number(index);
+                    std::vector<std::shared_ptr<ISector>> sectors;
+                    for (const auto& triangles : rooms[index].sectors)
+                    {
+                        auto sector = mock_shared<MockSector>();
+                        ON_CALL(*sector, triangles).WillByDefault(Return(triangles));
+                        sectors.push_back(sector);
+                    }
+                    ON_CALL(*room, sectors).WillByDefault(Return(sectors));
+                    ON_CALL(*room, neighbours).WillByDefault(Return(rooms[index].neighbours));
+                    ON_CALL(*room, set_sector_triangle_rooms).WillByDefault([&result, index](const auto& triangle_rooms) { result[index] = triangle_rooms; });
+                    return room;
+                })
+            .build();
+        return result;
+    }
+}
+
+TEST(Level, DeduplicateTrianglesMatchesPairwiseComparison)
+{
+    for (uint32_t seed = 0; seed < 8; ++seed)
+    {
+        SCOPED_TRACE(std::format("Seed {}", seed));
+        const auto rooms = generate_rooms(16, 64, seed);
+        ASSERT_EQ(deduplicated_triangle_rooms(rooms), pairwise_triangle_rooms(rooms));
+    }
+}
+
+TEST(Level, DeduplicateTrianglesIgnoresTrianglesInOtherOrder)
+{
+    GeneratedRoom first;
+    first.sectors = { { ISector::Triangle(Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 0, 1), SectorFlag::None, 0) } };
+    first.neighbours = { 1 };
+    GeneratedRoom second;
+    second.sectors = { {
+        ISector::Triangle(Vector3(1, 0, 0), Vector3(0, 0, 1), Vector3(0, 0, 0), SectorFlag::None, 0),
+        ISector::Triangle(Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 0, 1), SectorFlag::None, 0) } };
+    second.neighbours = { 0 };
+
+    const auto result = deduplicated_triangle_rooms({ first, second });
+    const std::vector<std::vector<uint32_t>> expected{ { 1 }, { 1, 0 } };
+    ASSERT_EQ(result, expected);
+}
@@ -0,0 +1,66 @@
+#include <trview.app/Elements/RoomGraph.h>
+
+using namespace trview;
+
+namespace
+{
+    std::vector<uint16_t> sorted(std::span<const uint16_t> rooms)
+    {
+        std::vector<uint16_t> result(rooms.begin(), rooms.end());
+        std::ranges::sort(result);
+        return result;
+    }
+
+    /// 0 - 1 - 2 - 3, with 4 as the alternate of 1 and 5 not connected.
+    RoomGraph create_graph()
+    {
+        return RoomGraph({ { 1 }, { 0, 2, 4 }, { 1, 3 }, { 2 }, { 1 }, {} });
+    }
+}
+
+TEST(RoomGraph, Neighbours)
+{
+    const auto graph = create_graph();
+    ASSERT_EQ(graph.size(), 6u);
+    ASSERT_EQ(sorted(graph.neighbours(1)), (std::vector<uint16_t>{ 0, 2, 4 }));
+    ASSERT_TRUE(graph.neighbours(5).empty());
+    ASSERT_TRUE(graph.neighbours(10).empty());
+}
+
+TEST(RoomGraph, NeighboursOutsideGraphIgnored)
+{
+    const RoomGraph graph({ { 1, 7 }, { 0 } });
+    ASSERT_EQ(sorted(graph.neighbours(0)), (std::vector<uint16_t>{ 1 }));
+}
+
+TEST(RoomGraph, RoomsWithinDepth)
+{
+    const auto graph = create_graph();
+    ASSERT_EQ(sorted(graph.rooms_within(0, 0)), (std::vector<uint16_t>{ 0 }));
+    ASSERT_EQ(sorted(graph.rooms_within(0, 1)), (std::vector<uint16_t>{ 0, 1 }));
+    ASSERT_EQ(sorted(graph.rooms_within(0, 2)), (std::vector<uint16_t>{ 0, 1, 2, 4 }));
+    ASSERT_EQ(sorted(graph.rooms_within(0, 3)), (std::vector<uint16_t>{ 0, 1, 2, 3, 4 }));
+    ASSERT_EQ(sorted(graph.rooms_within(0, 100)), (std::vector<uint16_t>{ 0, 1, 2, 3, 4 }));
+    ASSERT_EQ(sorted(graph.rooms_within(5, 3)), (std::vector<uint16_t>{ 5 }));
+    ASSERT_TRUE(graph.rooms_within(10, 1).empty());
+}
+
+TEST(RoomGraph, Distance)
+{
+    const auto graph = create_graph();
+    ASSERT_EQ(graph.distance(0, 0), 0u);
+    ASSERT_EQ(graph.distance(0, 3), 3u);
+    ASSERT_EQ(graph.distance(3, 4), 3u);
+    ASSERT_EQ(graph.distance(0, 5), RoomGraph::Unreachable);
+    ASSERT_EQ(graph.distance(0, 10), RoomGraph::Unreachable);
+}
+
+TEST(RoomGraph, LayersReusedBetweenDepths)
+{
+    const auto graph = create_graph();
+    const auto shallow = graph.rooms_within(1, 1);
+    const auto deep = graph.rooms_within(1, 2);
+    ASSERT_EQ(shallow.data(), deep.data());
+    ASSERT_EQ(shallow.size(), 4u);
+    ASSERT_EQ(deep.size(), 5u);
+}
@@ -13,6 +13,8 @@
 #include <trview.app/Mocks/Elements/ICameraSink.h>
 #include <trview.common/Algorithms.h>
 #include <trview.common/Mocks/Logs/ILog.h>
+#include <trview.app/Geometry/Mesh.h>
+#include <trview.graphics/mocks/IDevice.h>
 
 using namespace trview;
 using namespace trview::mocks;
@@ -30,6 +32,7 @@ namespace
             std::shared_ptr<IMeshStorage> mesh_storage{ mock_shared<MockMeshStorage>() };
             IMesh::Source mesh_source{ [](auto&&...) { return mock_shared<MockMesh>(); } };
             std::shared_ptr<trlevel::ILevel> tr_level{ mock_shared<trlevel::mocks::MockLevel>() };
+            LevelFloordata floordata;
             trlevel::tr3_room room{ .alternate_group = 0 };
             uint32_t index{ 0u };
             std::shared_ptr<ILevel> level{ mock_shared<MockLevel>() };
@@ -41,7 +44,7 @@ namespace
             std::shared_ptr<Room> build()
             {
                 auto new_room = std::make_shared<Room>(room, mesh_source, level_texture_storage, index, level);
-                new_room->initialise(*tr_level, room, *mesh_storage, static_mesh_source, static_mesh_position_source, sector_source, 0, Activity(log, "Level", "Room 0"));
+                new_room->initialise(*tr_level, floordata, room, *mesh_storage, static_mesh_source, static_mesh_position_source, sector_source, 0, Activity(log, "Level", "Room 0"));
                 return new_room;
             }
 
@@ -92,9 +95,35 @@ namespace
                 this->log = log;
                 return *this;
             }
+
+            test_module& with_mesh_source(const IMesh::Source& mesh_source)
+            {
+                this->mesh_source = mesh_source;
+                return *this;
+            }
         };
         return test_module{};
     }
+
+    /// <summary>
+    /// Make a mock element's pick target call its pick function, as the real elements do.
+    /// </summary>
+    template <typename T>
+    void pick_through_target(const std::shared_ptr<T>& element)
+    {
+        ON_CALL(*element, pick_target).WillByDefault([weak = std::weak_ptr<T>(element)]()
+            {
+                return PickTarget
+                {
+                    .bounds = weak.lock()->bounding_box(),
+                    .test = [weak](const auto& position, const auto& direction)
+                        {
+                            const auto element_ptr = weak.lock();
+                            return element_ptr ? element_ptr->pick(position, direction) : PickResult{};
+                        }
+                };
+            });
+    }
 }
 
 /// <summary>
@@ -355,6 +384,7 @@ TEST(Room, PickTestsEntities)
 
     auto room = register_test_module().build();
     auto entity = mock_shared<MockItem>();
+    pick_through_target(entity);
     ON_CALL(*entity, visible).WillByDefault(Return(true));
     EXPECT_CALL(*entity, pick).Times(1).WillOnce(Return(PickResult{ .hit = true, .distance = 0, .position = {}, .centroid = {}, .type = PickResult::Type::Entity, .item = entity }));
     room->add_entity(entity);
@@ -377,6 +407,7 @@ TEST(Room, PickTestsTriggers)
 
     auto room = register_test_module().build();
     auto trigger = mock_shared<MockTrigger>();
+    pick_through_target(trigger);
     ON_CALL(*trigger, visible).WillByDefault(Return(true));
     EXPECT_CALL(*trigger, pick).Times(1).WillOnce(Return(PickResult{ .hit = true, .distance = 0, .position = {}, .centroid = {}, .type = PickResult::Type::Trigger, .trigger = trigger }));
     room->add_trigger(trigger);
@@ -399,11 +430,13 @@ TEST(Room, PickChoosesClosest)
 
     auto room = register_test_module().build();
     auto entity = mock_shared<MockItem>();
+    pick_through_target(entity);
     ON_CALL(*entity, visible).WillByDefault(Return(true));
     EXPECT_CALL(*entity, pick).Times(1).WillOnce(Return(PickResult{ .hit = true, .distance = 0.5f, .position = {}, .centroid = {}, .type = PickResult::Type::Entity, .item = entity }));
     room->add_entity(entity);
 
     auto entity2 = mock_shared<MockItem>();
+    pick_through_target(entity2);
     ON_CALL(*entity2, visible).WillByDefault(Return(true));
     EXPECT_CALL(*entity2, pick).Times(1).WillOnce(Return(PickResult{ .hit = true, .distance = 1.0f, .position = {}, .centroid = {}, .type = PickResult::Type::Entity, .item = entity2 }));
     room->add_entity(entity2);
@@ -427,11 +460,13 @@ TEST(Room, PickChoosesEntityOverTrigger)
 
     auto room = register_test_module().build();
     auto entity = mock_shared<MockItem>();
+    pick_through_target(entity);
     ON_CALL(*entity, visible).WillByDefault(Return(true));
     EXPECT_CALL(*entity, pick).Times(1).WillOnce(Return(PickResult{ .hit = true, .distance = 1.0f, .position = {}, .centroid = {}, .type = PickResult::Type::Entity, .item = entity }));
     room->add_entity(entity);
 
     auto trigger = mock_shared<MockTrigger>();
+    pick_through_target(trigger);
     EXPECT_CALL(*trigger, pick).Times(0);
     room->add_trigger(trigger);
 
@@ -444,6 +479,80 @@ TEST(Room, PickChoosesEntityOverTrigger)
     ASSERT_EQ(result.distance, 1.0f);
 }
 
+/// <summary>
+/// Tests that the pick function doesn't test entities that are behind the room geometry.
+/// </summary>
+TEST(Room, PickSkipsEntitiesBehindGeometry)
+{
+    using namespace DirectX;
+    using namespace DirectX::SimpleMath;
+
+    auto mesh = mock_shared<MockMesh>();
+    ON_CALL(*mesh, pick).WillByDefault(Return(PickResult{ .hit = true, .distance = 1.0f }));
+    auto room = register_test_module().with_mesh_source([&](auto&&...) { return mesh; }).build();
+
+    auto near_entity = mock_shared<MockItem>();
+    pick_through_target(near_entity);
+    ON_CALL(*near_entity, visible).WillByDefault(Return(true));
+    ON_CALL(*near_entity, bounding_box).WillByDefault(Return(BoundingBox(Vector3(0, 0, -1.25f), Vector3(0.5f, 0.5f, 0.5f))));
+    EXPECT_CALL(*near_entity, pick).Times(1).WillOnce(Return(PickResult{ .hit = true, .distance = 0.25f, .position = {}, .centroid = {}, .type = PickResult::Type::Entity, .item = near_entity }));
+    room->add_entity(near_entity);
+
+    auto far_entity = mock_shared<MockItem>();
+    pick_through_target(far_entity);
+    ON_CALL(*far_entity, visible).WillByDefault(Return(true));
+    ON_CALL(*far_entity, bounding_box).WillByDefault(Return(BoundingBox(Vector3(0, 0, 5), Vector3(0.5f, 0.5f, 0.5f))));
+    EXPECT_CALL(*far_entity, pick).Times(0);
+    room->add_entity(far_entity);
+
+    auto results = room->pick(Vector3(0, 0, -2), Vector3(0, 0, 1), PickFilter::Geometry | PickFilter::Entities);
+    ASSERT_EQ(results.size(), 2);
+    ASSERT_EQ(results[0].type, PickResult::Type::Entity);
+    ASSERT_EQ(results[0].item.lock(), near_entity);
+    ASSERT_EQ(results[1].type, PickResult::Type::Room);
+}
+
+/// <summary>
+/// Tests that turning on all geometry mode makes the all geometry meshes pickable before the room has been rendered.
+/// </summary>
+TEST(Room, AllGeometryPickedBeforeRender)
+{
+    using namespace DirectX;
+    using namespace DirectX::SimpleMath;
+
+    trlevel::tr3_room level_room;
+    level_room.num_x_sectors = 1;
+    level_room.num_z_sectors = 1;
+    level_room.sector_list.resize(1);
+    auto sector = mock_shared<MockSector>();
+    ON_CALL(*sector, triangles).WillByDefault(Return(std::vector<ISector::Triangle>
+        {
+            ISector::Triangle(Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 0, 1), SectorFlag::None, 0)
+        }));
+
+    auto room_mesh = mock_shared<MockMesh>();
+    ON_CALL(*room_mesh, pick).WillByDefault(Return(PickResult{}));
+    auto all_geometry_mesh = mock_shared<MockMesh>();
+    ON_CALL(*all_geometry_mesh, pick).WillByDefault(Return(PickResult{ .hit = true, .distance = 1.0f }));
+    uint32_t meshes_made = 0;
+
+    auto room = register_test_module()
+        .with_room(level_room)
+        .with_sector_source([&](auto&&...) { return sector; })
+        .with_mesh_source([&](auto&&...) { return meshes_made++ ? all_geometry_mesh : room_mesh; })
+        .build();
+    room->set_sector_triangle_rooms({ 0 });
+
+    auto results = room->pick(Vector3(0.5f, 0, -2), Vector3(0, 0, 1), PickFilter::Geometry);
+    ASSERT_TRUE(results.empty());
+    ASSERT_EQ(meshes_made, 1u);
+
+    results = room->pick(Vector3(0.5f, 0, -2), Vector3(0, 0, 1), PickFilter::Geometry | PickFilter::AllGeometry);
+    ASSERT_EQ(meshes_made, 2u);
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results[0].type, PickResult::Type::Room);
+}
+
 /// <summary>
 /// Tests that the 'quicksand' flag is correctly detected when the version is >= TR3.
 /// </summary>
@@ -652,7 +761,8 @@ TEST(Room, MissingStaticMeshesIgnored)
     EXPECT_CALL(*level, get_static_mesh(0)).Times(1).WillOnce(Return(std::nullopt));
     EXPECT_CALL(*level, get_static_mesh(1)).Times(1).WillOnce(Return(trlevel::tr_staticmesh{}));
     auto log = mock_shared<MockLog>();
-    EXPECT_CALL(*log, log(Message::Status::Information, "Level", std::vector<std::string>{ "Room 0" }, testing::A<const std::string&>())).Times(2);
+    EXPECT_CALL(*log, trace(testing::Field(&TraceEvent::kind, TraceEvent::Kind::ActivityStarted))).Times(1);
+    EXPECT_CALL(*log, trace(testing::Field(&TraceEvent::kind, TraceEvent::Kind::ActivityEnded))).Times(1);
     EXPECT_CALL(*log, log(Message::Status::Error, "Level", std::vector<std::string>{ "Room 0" }, testing::A<const std::string&>())).Times(1);
     auto mesh = mock_shared<MockStaticMesh>();
     EXPECT_CALL(*mesh, render_bounding_box).Times(1);
@@ -705,6 +815,7 @@ TEST(Room, PickTestsStaticMesh)
     trlevel::tr3_room level_room{ .static_meshes = { {} } };
 
     auto static_mesh = mock_shared<MockStaticMesh>();
+    pick_through_target(static_mesh);
     ON_CALL(*static_mesh, number).WillByDefault(Return(10));
     ON_CALL(*static_mesh, visible).WillByDefault(Return(true));
     EXPECT_CALL(*static_mesh, pick).Times(1).WillOnce(Return(PickResult{ .hit = true, .distance = 0, .position = {}, .centroid = {}, .type = PickResult::Type::StaticMesh, .static_mesh = static_mesh }));
@@ -740,3 +851,85 @@ TEST(Room, VisibilityRaisesOnChanged)
     ASSERT_EQ(raised, true);
 }
 
+
+namespace
+{
+    /// Build a room with a grid of flat rectangles, one per sector.
+    trlevel::tr3_room create_room_with_floor(uint16_t size)
+    {
+        trlevel::tr3_room room{ .alternate_group = 0 };
+        room.num_x_sectors = size;
+        room.num_z_sectors = size;
+        for (uint16_t x = 0; x <= size; ++x)
+        {
+            for (uint16_t z = 0; z <= size; ++z)
+            {
+                room.data.vertices.push_back({ .vertex = { static_cast<int16_t>(x * 1024), 0, static_cast<int16_t>(z * 1024) } });
+            }
+        }
+
+        for (uint16_t x = 0; x < size; ++x)
+        {
+            for (uint16_t z = 0; z < size; ++z)
+            {
+                const uint16_t v = x * (size + 1) + z;
+                room.data.rectangles.push_back({ .vertices = { v, static_cast<uint16_t>(v + 1), static_cast<uint16_t>(v + size + 2), static_cast<uint16_t>(v + size + 1) } });
+            }
+        }
+        return room;
+    }
+
+    std::shared_ptr<MockLevelTextureStorage> create_texture_storage()
+    {
+        auto texture_storage = mock_shared<MockLevelTextureStorage>();
+        ON_CALL(*texture_storage, num_tiles).WillByDefault(Return(1));
+        ON_CALL(*texture_storage, num_object_textures).WillByDefault(Return(1));
+        return texture_storage;
+    }
+}
+
+TEST(Room, BuildDoesNotCreateDeviceResources)
+{
+    auto device = mock_shared<graphics::mocks::MockDevice>();
+    auto texture_storage = create_texture_storage();
+    const auto level_room = create_room_with_floor(2);
+    const IMesh::Source mesh_source = [&](auto&&... args) { return std::make_shared<Mesh>(device, args..., texture_storage); };
+
+    auto room = std::make_shared<Room>(level_room, mesh_source, texture_storage, 0, mock_shared<MockLevel>());
+
+    EXPECT_CALL(*device, create_buffer).Times(0);
+    auto tr_level = mock_shared<trlevel::mocks::MockLevel>();
+    room->build(*tr_level, LevelFloordata{}, level_room, [](auto&&...) { return mock_shared<MockStaticMesh>(); }, [](auto&&...) { return mock_shared<MockStaticMesh>(); }, [](auto&&...) { return mock_shared<MockSector>(); }, 0, std::nullopt);
+    testing::Mock::VerifyAndClearExpectations(device.get());
+
+    const auto& geometry = room->pending_geometry();
+    ASSERT_EQ(geometry.vertices.size(), 16u);
+    ASSERT_EQ(geometry.indices.size(), 1u);
+    ASSERT_EQ(geometry.indices[0].size(), 24u);
+    ASSERT_EQ(room->sectors().size(), 0u);
+
+    EXPECT_CALL(*device, create_buffer).Times(testing::AtLeast(1));
+    room->upload(*tr_level, NiceMock<MockMeshStorage>(), Activity(mock_shared<MockLog>(), "Level", "Room 0"));
+    ASSERT_TRUE(room->pending_geometry().vertices.empty());
+}
+
+TEST(Room, BuildUsesGivenGeometry)
+{
+    auto texture_storage = create_texture_storage();
+    const auto level_room = create_room_with_floor(2);
+    auto room = std::make_shared<Room>(level_room, [](auto&&...) { return mock_shared<MockMesh>(); }, texture_storage, 0, mock_shared<MockLevel>());
+
+    RoomGeometry geometry;
+    geometry.vertices.resize(3);
+    geometry.indices = { { 0, 1, 2 } };
+    geometry.collision_triangles.push_back(Triangle(DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::UnitX, DirectX::SimpleMath::Vector3::UnitZ));
+
+    EXPECT_CALL(*texture_storage, num_tiles).Times(0);
+    auto tr_level = mock_shared<trlevel::mocks::MockLevel>();
+    room->build(*tr_level, LevelFloordata{}, level_room, [](auto&&...) { return mock_shared<MockStaticMesh>(); }, [](auto&&...) { return mock_shared<MockStaticMesh>(); }, [](auto&&...) { return mock_shared<MockSector>(); }, 0, geometry);
+
+    const auto& pending = room->pending_geometry();
+    ASSERT_EQ(pending.vertices.size(), 3u);
+    ASSERT_EQ(pending.indices, geometry.indices);
+    ASSERT_EQ(pending.collision_triangles.size(), 1u);
+}
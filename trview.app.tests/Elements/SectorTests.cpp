@@ -9,6 +9,7 @@ using namespace trlevel;
 using namespace trlevel::mocks;
 using testing::NiceMock;
 using testing::Return;
+using testing::ReturnRef;
 
 TEST(Sector, HighNumberedPortal)
 {
@@ -21,9 +22,13 @@ TEST(Sector, HighNumberedPortal)
     tr_room.num_x_sectors = 1;
     tr_room.num_z_sectors = 1;
     tr_room_sector sector { 1, 0xffff, 255, 0, 255, 0 };
+    tr_room.sector_list.push_back(sector);
+    ON_CALL(level, num_rooms).WillByDefault(Return(1));
+    ON_CALL(level, get_room).WillByDefault(ReturnRef(tr_room));
     auto room = trview::tests::mock_shared<MockRoom>();
 
-    Sector s(level, tr_room, sector, 0, room, 0);
+    const LevelFloordata floordata(level);
+    Sector s(level, floordata, tr_room, sector, 0, room, 0);
 
     ASSERT_EQ(s.portal(), 378);
 }
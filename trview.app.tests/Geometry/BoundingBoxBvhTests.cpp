@@ -0,0 +1,105 @@
+#include <trview.app/Geometry/BoundingBoxBvh.h>
+#include <trview.app/Geometry/RayBox.h>
+#include <random>
+#include <set>
+
+using namespace trview;
+using namespace DirectX;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    std::vector<BoundingBox> random_boxes(std::mt19937& random, uint32_t count)
+    {
+        std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+        std::uniform_real_distribution<float> size(0.1f, 2.0f);
+        std::vector<BoundingBox> boxes;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            boxes.push_back(BoundingBox(
+                Vector3(position(random), position(random), position(random)),
+                Vector3(size(random), size(random), size(random))));
+        }
+        return boxes;
+    }
+}
+
+TEST(BoundingBoxBvh, VisitsEveryBoxTheRayEnters)
+{
+    std::mt19937 random(4);
+    const auto boxes = random_boxes(random, 500);
+    const BoundingBoxBvh bvh(boxes);
+    ASSERT_EQ(bvh.size(), 500u);
+
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    for (int ray = 0; ray < 200; ++ray)
+    {
+        const Vector3 position(value(random) * 30, value(random) * 30, value(random) * 30);
+        Vector3 direction(value(random), value(random), value(random));
+        direction.Normalize();
+
+        std::set<uint32_t> expected;
+        const auto inverse = inverse_direction(direction);
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            const Vector3 centre(boxes[i].Center);
+            const Vector3 extents(boxes[i].Extents);
+            if (ray_box_entry(centre - extents, centre + extents, position, inverse, FLT_MAX))
+            {
+                expected.insert(i);
+            }
+        }
+
+        std::set<uint32_t> visited;
+        bvh.pick(position, direction, [&](uint32_t index, float limit)
+            {
+                EXPECT_TRUE(visited.insert(index).second);
+                return limit;
+            });
+        ASSERT_EQ(visited, expected);
+    }
+}
+
+TEST(BoundingBoxBvh, LimitSkipsFartherBoxes)
+{
+    std::vector<BoundingBox> boxes;
+    for (int i = 0; i < 10; ++i)
+    {
+        boxes.push_back(BoundingBox(Vector3(0, 0, i * 4.0f), Vector3(1, 1, 1)));
+    }
+    const BoundingBoxBvh bvh(boxes);
+
+    std::vector<uint32_t> visited;
+    bvh.pick(Vector3(0, 0, -5), Vector3(0, 0, 1), [&](uint32_t index, float)
+        {
+            visited.push_back(index);
+            return 4.5f;
+        });
+    ASSERT_EQ(visited, (std::vector<uint32_t>{ 0 }));
+}
+
+TEST(BoundingBoxBvh, InitialLimitSkipsFartherBoxes)
+{
+    const BoundingBoxBvh bvh({ BoundingBox(Vector3(0, 0, 0), Vector3(1, 1, 1)), BoundingBox(Vector3(0, 0, 10), Vector3(1, 1, 1)) });
+
+    std::vector<uint32_t> visited;
+    bvh.pick(Vector3(0, 0, -5), Vector3(0, 0, 1), [&](uint32_t index, float limit)
+        {
+            visited.push_back(index);
+            return limit;
+        }, 8.0f);
+    ASSERT_EQ(visited, (std::vector<uint32_t>{ 0 }));
+}
+
+TEST(BoundingBoxBvh, EmptyVisitsNothing)
+{
+    const BoundingBoxBvh bvh;
+    bool visited = false;
+    bvh.pick(Vector3::Zero, Vector3(0, 0, 1), [&](uint32_t, float limit)
+        {
+            visited = true;
+            return limit;
+        });
+    ASSERT_FALSE(visited);
+    ASSERT_EQ(bvh.size(), 0u);
+}
@@ -0,0 +1,98 @@
+#include <trview.app/Geometry/PickScene.h>
+
+using namespace trview;
+using namespace DirectX;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    PickTarget target(PickResult::Type type, float z, uint32_t* calls = nullptr)
+    {
+        return
+        {
+            .bounds = BoundingBox(Vector3(0, 0, z), Vector3(1, 1, 1)),
+            .test = [=](const Vector3& position, const Vector3&)
+                {
+                    if (calls)
+                    {
+                        ++*calls;
+                    }
+
+                    PickResult result;
+                    result.hit = true;
+                    result.type = type;
+                    result.distance = z - 1 - position.z;
+                    result.position = Vector3(0, 0, z);
+                    return result;
+                }
+        };
+    }
+
+    const Vector3 Position(0, 0, -5);
+    const Vector3 Direction(0, 0, 1);
+}
+
+TEST(PickScene, EmptyTestsDropped)
+{
+    const PickScene scene({ target(PickResult::Type::Room, 0), PickTarget{ .bounds = BoundingBox() } });
+    ASSERT_EQ(scene.size(), 1u);
+}
+
+TEST(PickScene, NearestHitChosen)
+{
+    const PickScene scene({ target(PickResult::Type::Light, 10), target(PickResult::Type::Trigger, 5) });
+    const auto result = scene.pick(Position, Direction);
+    ASSERT_TRUE(result.hit);
+    ASSERT_EQ(result.type, PickResult::Type::Trigger);
+}
+
+TEST(PickScene, LastEntityBeforeRoomChosen)
+{
+    const PickScene scene(
+        {
+            target(PickResult::Type::Trigger, 2),
+            target(PickResult::Type::Entity, 4),
+            target(PickResult::Type::Entity, 6),
+            target(PickResult::Type::Room, 8),
+            target(PickResult::Type::Entity, 10)
+        });
+    const auto result = scene.pick(Position, Direction);
+    ASSERT_TRUE(result.hit);
+    ASSERT_EQ(result.type, PickResult::Type::Entity);
+    ASSERT_EQ(result.position.z, 6.0f);
+}
+
+TEST(PickScene, TargetsBehindRoomNotTested)
+{
+    uint32_t behind_calls = 0;
+    const PickScene scene({ target(PickResult::Type::Room, 0), target(PickResult::Type::Entity, 20, &behind_calls) });
+    const auto result = scene.pick(Position, Direction);
+    ASSERT_EQ(result.type, PickResult::Type::Room);
+    ASSERT_EQ(behind_calls, 0u);
+}
+
+TEST(PickScene, StoppedPickHasNoHit)
+{
+    uint32_t calls = 0;
+    const PickScene scene({ target(PickResult::Type::Entity, 0, &calls), target(PickResult::Type::Entity, 5, &calls) });
+
+    std::stop_source stop;
+    stop.request_stop();
+    ASSERT_FALSE(scene.pick(Position, Direction, stop.get_token()).hit);
+    ASSERT_EQ(calls, 0u);
+}
+
+TEST(PickScene, TargetsOutsideFrustumSkipped)
+{
+    uint32_t near_calls = 0;
+    uint32_t far_calls = 0;
+    const PickScene scene({ target(PickResult::Type::Entity, 2, &near_calls), target(PickResult::Type::Room, 50, &far_calls) });
+
+    // Looking down the ray with the far plane between the two targets.
+    const BoundingFrustum frustum(Position, Quaternion::Identity, 1.0f, -1.0f, 1.0f, -1.0f, 0.1f, 20.0f);
+    const auto result = scene.pick(Position, Direction, frustum);
+    ASSERT_TRUE(result.hit);
+    ASSERT_EQ(result.type, PickResult::Type::Entity);
+    ASSERT_EQ(near_calls, 1u);
+    ASSERT_EQ(far_calls, 0u);
+}
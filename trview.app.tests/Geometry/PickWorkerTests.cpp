@@ -0,0 +1,110 @@
+#include <trview.app/Geometry/PickWorker.h>
+#include <chrono>
+#include <future>
+
+using namespace trview;
+using namespace std::chrono_literals;
+
+namespace
+{
+    PickResult hit(float distance)
+    {
+        PickResult result;
+        result.hit = true;
+        result.distance = distance;
+        return result;
+    }
+
+    std::optional<PickWorker::Completed> wait_for(PickWorker& worker)
+    {
+        for (int i = 0; i < 500; ++i)
+        {
+            if (auto completed = worker.take())
+            {
+                return completed;
+            }
+            std::this_thread::sleep_for(10ms);
+        }
+        return std::nullopt;
+    }
+}
+
+TEST(PickWorker, CompletedPickTaken)
+{
+    PickWorker worker;
+    worker.submit({ .sequence = 1 }, {}, { [](auto&&...) { return hit(5); } });
+
+    const auto completed = wait_for(worker);
+    ASSERT_TRUE(completed.has_value());
+    ASSERT_EQ(completed->info.sequence, 1u);
+    ASSERT_TRUE(completed->result.hit);
+    ASSERT_EQ(completed->result.distance, 5.0f);
+    ASSERT_FALSE(worker.take().has_value());
+}
+
+TEST(PickWorker, NearestOfResultAndQueriesUsed)
+{
+    PickWorker worker;
+    worker.submit({ .sequence = 1 }, hit(3), { [](auto&&...) { return hit(5); }, [](auto&&...) { return hit(4); } });
+
+    const auto completed = wait_for(worker);
+    ASSERT_TRUE(completed.has_value());
+    ASSERT_EQ(completed->result.distance, 3.0f);
+}
+
+TEST(PickWorker, SubmitCancelsRunningPick)
+{
+    PickWorker worker;
+
+    std::promise<void> started;
+    bool stopped = false;
+    worker.submit({ .sequence = 1 }, {},
+        {
+            [&](const PickInfo&, std::stop_token stop)
+            {
+                started.set_value();
+                while (!stop.stop_requested())
+                {
+                    std::this_thread::sleep_for(1ms);
+                }
+                stopped = true;
+                return hit(1);
+            }
+        });
+    started.get_future().wait();
+
+    worker.submit({ .sequence = 2 }, {}, { [](auto&&...) { return hit(5); } });
+
+    const auto completed = wait_for(worker);
+    ASSERT_TRUE(completed.has_value());
+    ASSERT_TRUE(stopped);
+    ASSERT_EQ(completed->info.sequence, 2u);
+    ASSERT_EQ(completed->result.distance, 5.0f);
+}
+
+TEST(PickWorker, CancelDiscardsPick)
+{
+    PickWorker worker;
+
+    std::promise<void> started;
+    std::promise<void> finished;
+    worker.submit({ .sequence = 1 }, {},
+        {
+            [&](const PickInfo&, std::stop_token stop)
+            {
+                started.set_value();
+                while (!stop.stop_requested())
+                {
+                    std::this_thread::sleep_for(1ms);
+                }
+                finished.set_value();
+                return hit(1);
+            }
+        });
+    started.get_future().wait();
+    worker.cancel();
+    finished.get_future().wait();
+
+    std::this_thread::sleep_for(20ms);
+    ASSERT_FALSE(worker.take().has_value());
+}
@@ -0,0 +1,99 @@
+#include <trview.app/Geometry/TransparencySort.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace trview;
+
+namespace
+{
+    std::vector<uint32_t> reference(const std::vector<float>& distances)
+    {
+        std::vector<uint32_t> order(distances.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&](auto l, auto r) { return distances[l] > distances[r]; });
+        return order;
+    }
+
+    std::vector<float> random_distances(std::mt19937& random, uint32_t count)
+    {
+        std::uniform_real_distribution<float> distance(0.0f, 1000.0f);
+        std::vector<float> distances(count);
+        std::ranges::generate(distances, [&]() { return distance(random); });
+        return distances;
+    }
+}
+
+TEST(TransparencySort, Empty)
+{
+    TransparencySort sort;
+    ASSERT_TRUE(sort.sort({}).empty());
+}
+
+TEST(TransparencySort, FarthestFirst)
+{
+    TransparencySort sort;
+    const std::vector<float> distances{ 1.0f, 5.0f, 0.0f, 3.0f };
+    ASSERT_EQ(sort.sort(distances), (std::vector<uint32_t>{ 1, 3, 0, 2 }));
+}
+
+TEST(TransparencySort, EqualDistancesKeepOrder)
+{
+    TransparencySort sort;
+    const std::vector<float> distances{ 2.0f, 1.0f, 2.0f, 1.0f, 2.0f };
+    ASSERT_EQ(sort.sort(distances), (std::vector<uint32_t>{ 0, 2, 4, 1, 3 }));
+}
+
+TEST(TransparencySort, MatchesStableSort)
+{
+    std::mt19937 random(1234);
+    for (const uint32_t count : { 1u, 7u, 1000u, 50000u })
+    {
+        TransparencySort sort;
+        const auto distances = random_distances(random, count);
+        ASSERT_EQ(sort.sort(distances), reference(distances));
+        ASSERT_FALSE(sort.refined());
+    }
+}
+
+TEST(TransparencySort, SmallChangesRefinePreviousOrder)
+{
+    std::mt19937 random(5678);
+    auto distances = random_distances(random, 10000);
+
+    TransparencySort sort;
+    sort.sort(distances);
+
+    std::uniform_real_distribution<float> nudge(-0.01f, 0.01f);
+    for (uint32_t frame = 0; frame < 10; ++frame)
+    {
+        for (auto& distance : distances)
+        {
+            distance += nudge(random);
+        }
+        ASSERT_EQ(sort.sort(distances), reference(distances));
+        ASSERT_TRUE(sort.refined());
+    }
+}
+
+TEST(TransparencySort, LargeChangesSortAgain)
+{
+    std::mt19937 random(91011);
+    TransparencySort sort;
+    sort.sort(random_distances(random, 10000));
+
+    const auto distances = random_distances(random, 10000);
+    ASSERT_EQ(sort.sort(distances), reference(distances));
+    ASSERT_FALSE(sort.refined());
+}
+
+TEST(TransparencySort, ChangedCountSortsAgain)
+{
+    std::mt19937 random(1213);
+    TransparencySort sort;
+    sort.sort(random_distances(random, 100));
+
+    const auto distances = random_distances(random, 101);
+    ASSERT_EQ(sort.sort(distances), reference(distances));
+    ASSERT_FALSE(sort.refined());
+}
@@ -0,0 +1,77 @@
+#include <trview.app/Geometry/TransparentTriangleCache.h>
+#include <trview.app/Geometry/Model/Model.h>
+#include <trview.app/Mocks/Geometry/IMesh.h>
+#include <trview.app/Mocks/Geometry/ITransparencyBuffer.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace DirectX::SimpleMath;
+using testing::An;
+using testing::NiceMock;
+using testing::Return;
+using testing::ReturnRef;
+
+namespace
+{
+    std::vector<TransparentTriangle> triangles()
+    {
+        return { TransparentTriangle(Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 1, 0), Color(1, 1, 1), Color(1, 1, 1), Color(1, 1, 1)) };
+    }
+}
+
+TEST(TransparentTriangleCache, TrianglesTransformedOnce)
+{
+    auto mesh = mock_shared<MockMesh>();
+    EXPECT_CALL(*mesh, transparent_triangles).Times(1).WillOnce(Return(triangles()));
+
+    NiceMock<MockTransparencyBuffer> transparency;
+    std::vector<Vector3> positions;
+    EXPECT_CALL(transparency, add(An<std::span<const TransparentTriangle>>())).Times(2).WillRepeatedly([&](auto added) { positions.push_back(added[0].position); });
+
+    TransparentTriangleCache cache;
+    const auto world = Matrix::CreateTranslation(10, 0, 0);
+    cache.add(transparency, mesh, world, Color(1, 0, 0), true);
+    cache.add(transparency, mesh, world, Color(1, 0, 0), true);
+
+    ASSERT_EQ(positions.size(), 2u);
+    ASSERT_EQ(positions[0], Vector3(10.5f, 0.5f, 0));
+    ASSERT_EQ(positions[1], positions[0]);
+}
+
+TEST(TransparentTriangleCache, TrianglesTransformedAgainWhenChanged)
+{
+    auto mesh = mock_shared<MockMesh>();
+    EXPECT_CALL(*mesh, transparent_triangles).Times(4).WillRepeatedly(Return(triangles()));
+    auto other_mesh = mock_shared<MockMesh>();
+    EXPECT_CALL(*other_mesh, transparent_triangles).Times(1).WillOnce(Return(triangles()));
+
+    NiceMock<MockTransparencyBuffer> transparency;
+    TransparentTriangleCache cache;
+    cache.add(transparency, mesh, Matrix::Identity, Color(1, 0, 0), true);
+    cache.add(transparency, mesh, Matrix::CreateTranslation(1, 0, 0), Color(1, 0, 0), true);
+    cache.add(transparency, mesh, Matrix::CreateTranslation(1, 0, 0), Color(0, 1, 0), true);
+    cache.add(transparency, mesh, Matrix::CreateTranslation(1, 0, 0), Color(0, 1, 0), false);
+    cache.add(transparency, other_mesh, Matrix::CreateTranslation(1, 0, 0), Color(0, 1, 0), false);
+}
+
+TEST(TransparentTriangleCache, SharedModelTransformedOncePerItem)
+{
+    const DirectX::BoundingBox box;
+    auto mesh = mock_shared<MockMesh>();
+    ON_CALL(*mesh, bounding_box).WillByDefault(ReturnRef(box));
+    EXPECT_CALL(*mesh, transparent_triangles).Times(2).WillRepeatedly(Return(triangles()));
+    Model model(trlevel::tr_model{}, { mesh }, { Matrix::Identity });
+
+    NiceMock<MockTransparencyBuffer> transparency;
+    std::vector<TransparentTriangleCache> first;
+    std::vector<TransparentTriangleCache> second;
+    for (int i = 0; i < 3; ++i)
+    {
+        model.render_transparency(Matrix::CreateTranslation(1, 0, 0), transparency, Color(1, 0, 0), first);
+        model.render_transparency(Matrix::CreateTranslation(2, 0, 0), transparency, Color(1, 0, 0), second);
+    }
+    ASSERT_EQ(first.size(), 1u);
+    ASSERT_EQ(second.size(), 1u);
+}
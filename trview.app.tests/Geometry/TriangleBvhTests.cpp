@@ -0,0 +1,124 @@
+#include <trview.app/Geometry/TriangleBvh.h>
+#include <random>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    std::optional<TriangleBvh::Hit> brute_force(const std::vector<Triangle>& triangles, const Vector3& position, const Vector3& direction)
+    {
+        std::optional<TriangleBvh::Hit> result;
+        for (uint32_t i = 0; i < triangles.size(); ++i)
+        {
+            const auto& triangle = triangles[i];
+            float distance = 0;
+            if (direction.Dot(triangle.normal) < 0 &&
+                DirectX::TriangleTests::Intersects(position, direction, triangle.v0, triangle.v1, triangle.v2, distance) &&
+                (!result || distance < result->distance))
+            {
+                result = { .distance = distance, .triangle = i };
+            }
+        }
+        return result;
+    }
+
+    std::vector<Triangle> random_triangles(std::mt19937& random, uint32_t count)
+    {
+        std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+        std::vector<Triangle> triangles;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Vector3 centre(position(random), position(random), position(random));
+            triangles.push_back(Triangle(
+                centre + Vector3(offset(random), offset(random), offset(random)),
+                centre + Vector3(offset(random), offset(random), offset(random)),
+                centre + Vector3(offset(random), offset(random), offset(random))));
+        }
+        return triangles;
+    }
+}
+
+TEST(TriangleBvh, EmptyMisses)
+{
+    TriangleBvh bvh;
+    ASSERT_FALSE(bvh.pick(Vector3(0, 0, 0), Vector3(0, 0, 1)).has_value());
+    ASSERT_EQ(bvh.node_count(), 0u);
+}
+
+TEST(TriangleBvh, BackFacesIgnored)
+{
+    // Facing -Z, so it is only hit by rays travelling along +Z.
+    const std::vector<Triangle> triangles{ Triangle(Vector3(-1, -1, 5), Vector3(1, -1, 5), Vector3(0, 1, 5)) };
+    ASSERT_LT(triangles[0].normal.z, 0);
+
+    TriangleBvh bvh(triangles);
+    const auto hit = bvh.pick(Vector3(0, 0, 0), Vector3(0, 0, 1));
+    ASSERT_TRUE(hit.has_value());
+    ASSERT_FLOAT_EQ(hit->distance, 5.0f);
+    ASSERT_FALSE(bvh.pick(Vector3(0, 0, 10), Vector3(0, 0, -1)).has_value());
+}
+
+TEST(TriangleBvh, MatchesBruteForce)
+{
+    std::mt19937 random(1234);
+    const auto triangles = random_triangles(random, 2000);
+    TriangleBvh bvh(triangles);
+    ASSERT_GT(bvh.node_count(), 1u);
+    ASSERT_EQ(bvh.triangles().size(), triangles.size());
+
+    std::uniform_real_distribution<float> value(-15.0f, 15.0f);
+    uint32_t hits = 0;
+    for (int i = 0; i < 2000; ++i)
+    {
+        const Vector3 position(value(random), value(random), value(random));
+        Vector3 direction = Vector3(value(random), value(random), value(random)) - position;
+        direction.Normalize();
+
+        const auto expected = brute_force(triangles, position, direction);
+        const auto actual = bvh.pick(position, direction);
+        ASSERT_EQ(actual.has_value(), expected.has_value());
+        if (expected)
+        {
+            ++hits;
+            ASSERT_EQ(actual->distance, expected->distance);
+            const auto& triangle = bvh.triangles()[actual->triangle];
+            ASSERT_EQ(triangle.v0, triangles[expected->triangle].v0);
+            ASSERT_EQ(triangle.v1, triangles[expected->triangle].v1);
+            ASSERT_EQ(triangle.v2, triangles[expected->triangle].v2);
+        }
+    }
+    ASSERT_GT(hits, 0u);
+}
+
+TEST(TriangleBvh, AxisAlignedRays)
+{
+    // A floor of quads, as found in rooms, picked with rays that have zero direction components.
+    std::vector<Triangle> triangles;
+    for (int x = 0; x < 16; ++x)
+    {
+        for (int z = 0; z < 16; ++z)
+        {
+            const float fx = static_cast<float>(x);
+            const float fz = static_cast<float>(z);
+            triangles.push_back(Triangle(Vector3(fx, 0, fz), Vector3(fx + 1, 0, fz), Vector3(fx + 1, 0, fz + 1)));
+            triangles.push_back(Triangle(Vector3(fx, 0, fz), Vector3(fx + 1, 0, fz + 1), Vector3(fx, 0, fz + 1)));
+        }
+    }
+
+    TriangleBvh bvh(triangles);
+    for (float x = 0.25f; x < 16; x += 0.5f)
+    {
+        const Vector3 position(x, 10, x * 0.5f);
+        const Vector3 direction(0, -1, 0);
+        const auto expected = brute_force(triangles, position, direction);
+        const auto actual = bvh.pick(position, direction);
+        ASSERT_EQ(actual.has_value(), expected.has_value());
+        if (expected)
+        {
+            ASSERT_EQ(actual->distance, expected->distance);
+            ASSERT_EQ(bvh.triangles()[actual->triangle].v2, triangles[expected->triangle].v2);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include <trview.app/Geometry/TrianglePacket.h>
+#include <random>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    std::vector<Triangle> random_triangles(std::mt19937& random, uint32_t count)
+    {
+        std::uniform_real_distribution<float> position(-2.0f, 2.0f);
+        std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+        std::vector<Triangle> triangles;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Vector3 centre(position(random), position(random), position(random));
+            triangles.push_back(Triangle(
+                centre + Vector3(offset(random), offset(random), offset(random)),
+                centre + Vector3(offset(random), offset(random), offset(random)),
+                centre + Vector3(offset(random), offset(random), offset(random))));
+        }
+        return triangles;
+    }
+}
+
+TEST(TrianglePacket, LastPacketPadded)
+{
+    std::mt19937 random(1);
+    std::vector<TrianglePacket> packets;
+    pack_triangles(random_triangles(random, 11), packets);
+    ASSERT_EQ(packets.size(), 2u);
+
+    // Every direction should miss the empty lanes.
+    TrianglePacket::Lanes distances;
+    for (const auto& direction : { Vector3(0, 0, 1), Vector3(0, 0, -1), Vector3(1, 0, 0), Vector3(0, -1, 0) })
+    {
+        ASSERT_EQ(intersect_packet(packets[1], Vector3::Zero, direction, FLT_MAX, distances) & ~0x7u, 0u);
+    }
+}
+
+TEST(TrianglePacket, FrontFacesHit)
+{
+    // Facing -Z, so it is only hit by rays travelling along +Z.
+    const std::vector<Triangle> triangles{ Triangle(Vector3(-1, -1, 5), Vector3(1, -1, 5), Vector3(0, 1, 5)) };
+    std::vector<TrianglePacket> packets;
+    pack_triangles(triangles, packets);
+
+    TrianglePacket::Lanes distances;
+    ASSERT_EQ(intersect_packet(packets[0], Vector3(0, 0, 0), Vector3(0, 0, 1), FLT_MAX, distances), 1u);
+    ASSERT_FLOAT_EQ(distances[0], 5.0f);
+    ASSERT_EQ(intersect_packet(packets[0], Vector3(0, 0, 10), Vector3(0, 0, -1), FLT_MAX, distances), 0u);
+}
+
+TEST(TrianglePacket, HitsBeyondLimitIgnored)
+{
+    const std::vector<Triangle> triangles{ Triangle(Vector3(-1, -1, 5), Vector3(1, -1, 5), Vector3(0, 1, 5)) };
+    std::vector<TrianglePacket> packets;
+    pack_triangles(triangles, packets);
+
+    TrianglePacket::Lanes distances;
+    ASSERT_EQ(intersect_packet(packets[0], Vector3(0, 0, 0), Vector3(0, 0, 1), 5.0f, distances), 1u);
+    ASSERT_EQ(intersect_packet(packets[0], Vector3(0, 0, 0), Vector3(0, 0, 1), 4.9f, distances), 0u);
+}
+
+TEST(TrianglePacket, MatchesScalar)
+{
+    std::mt19937 random(1234);
+    std::vector<TrianglePacket> packets;
+    pack_triangles(random_triangles(random, 203), packets);
+
+    std::uniform_real_distribution<float> position(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> limit(0.0f, 10.0f);
+    for (uint32_t r = 0; r < 500; ++r)
+    {
+        const Vector3 start(position(random), position(random), position(random));
+        Vector3 direction(position(random), position(random), position(random));
+        direction.Normalize();
+        const float max_distance = r % 2 ? FLT_MAX : limit(random);
+
+        for (const auto& packet : packets)
+        {
+            TrianglePacket::Lanes expected_distances;
+            TrianglePacket::Lanes distances;
+            const uint32_t expected = scalar::intersect_packet(packet, start, direction, max_distance, expected_distances);
+            const uint32_t actual = intersect_packet(packet, start, direction, max_distance, distances);
+            ASSERT_EQ(actual, expected);
+            for (uint32_t lane = 0; lane < TrianglePacket::Width; ++lane)
+            {
+                if (expected & (1u << lane))
+                {
+                    ASSERT_EQ(distances[lane], expected_distances[lane]);
+                }
+            }
+        }
+    }
+}
+
+TEST(TrianglePacket, MatchesTriangleTests)
+{
+    std::mt19937 random(5678);
+    const auto triangles = random_triangles(random, 64);
+    std::vector<TrianglePacket> packets;
+    pack_triangles(triangles, packets);
+
+    std::uniform_real_distribution<float> position(-5.0f, 5.0f);
+    for (uint32_t r = 0; r < 500; ++r)
+    {
+        const Vector3 start(position(random), position(random), position(random));
+        Vector3 direction(position(random), position(random), position(random));
+        direction.Normalize();
+
+        for (uint32_t i = 0; i < triangles.size(); ++i)
+        {
+            const auto& triangle = triangles[i];
+            float expected_distance = 0;
+            const bool expected = direction.Dot(triangle.normal) < 0 &&
+                DirectX::TriangleTests::Intersects(start, direction, triangle.v0, triangle.v1, triangle.v2, expected_distance);
+
+            TrianglePacket::Lanes distances;
+            const uint32_t lane = i % TrianglePacket::Width;
+            const bool actual = (intersect_packet(packets[i / TrianglePacket::Width], start, direction, FLT_MAX, distances) >> lane) & 1;
+            ASSERT_EQ(actual, expected);
+            if (expected)
+            {
+                ASSERT_FLOAT_EQ(distances[lane], expected_distance);
+            }
+        }
+    }
+}
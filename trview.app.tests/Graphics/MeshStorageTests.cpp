@@ -2,6 +2,7 @@
 #include <trview.app/Mocks/Graphics/ILevelTextureStorage.h>
 #include <trview.app/Mocks/Geometry/IMesh.h>
 #include <trlevel/Mocks/ILevel.h>
+#include <trview.common/Mocks/Logs/ILog.h>
 
 using namespace trview;
 using namespace trview::mocks;
@@ -18,10 +19,17 @@ namespace
             IMesh::Source mesh_source{ [](auto&&...) { return mock_shared<MockMesh>(); } };
             std::shared_ptr<trlevel::ILevel> level{ mock_shared<trlevel::mocks::MockLevel>() };
             std::shared_ptr<ILevelTextureStorage> texture_storage{ mock_shared<MockLevelTextureStorage>() };
+            std::shared_ptr<ILog> log{ mock_shared<MockLog>() };
 
             std::unique_ptr<MeshStorage> build()
             {
-                return std::make_unique<MeshStorage>(mesh_source, *level, *texture_storage);
+                return std::make_unique<MeshStorage>(mesh_source, level, texture_storage, log);
+            }
+
+            test_module& with_mesh_source(const IMesh::Source& mesh_source)
+            {
+                this->mesh_source = mesh_source;
+                return *this;
             }
 
             test_module& with_level(const std::shared_ptr<trlevel::ILevel>& level)
@@ -34,13 +42,16 @@ namespace
     }
 }
 
-TEST(MeshStorage, MeshesLoadedFromLevel)
+TEST(MeshStorage, MeshesNotLoadedUntilRequested)
 {
     auto level = mock_shared<trlevel::mocks::MockLevel>();
     ON_CALL(*level, num_mesh_pointers).WillByDefault(testing::Return(2));
-    EXPECT_CALL(*level, get_mesh_by_pointer(0)).Times(1);
+    ON_CALL(*level, get_mesh_pointer(1)).WillByDefault(testing::Return(100));
+    EXPECT_CALL(*level, get_mesh_by_pointer(0)).Times(0);
     EXPECT_CALL(*level, get_mesh_by_pointer(1)).Times(1);
     auto storage = register_test_module().with_level(level).build();
+    storage->mesh(1);
+    storage->mesh(1);
 }
 
 TEST(MeshStorage, MeshCanBeRetrieved)
@@ -57,8 +68,30 @@ TEST(MeshStorage, MissingMeshNotFound)
 {
     auto level = mock_shared<trlevel::mocks::MockLevel>();
     ON_CALL(*level, num_mesh_pointers).WillByDefault(testing::Return(1));
-    EXPECT_CALL(*level, get_mesh_by_pointer(0)).Times(1);
+    EXPECT_CALL(*level, get_mesh_by_pointer).Times(0);
     auto storage = register_test_module().with_level(level).build();
     auto mesh = storage->mesh(1);
     ASSERT_EQ(mesh, nullptr);
 }
+
+TEST(MeshStorage, PointersToSameMeshShareMesh)
+{
+    auto level = mock_shared<trlevel::mocks::MockLevel>();
+    ON_CALL(*level, num_mesh_pointers).WillByDefault(testing::Return(3));
+    ON_CALL(*level, get_mesh_pointer(0)).WillByDefault(testing::Return(10));
+    ON_CALL(*level, get_mesh_pointer(1)).WillByDefault(testing::Return(20));
+    ON_CALL(*level, get_mesh_pointer(2)).WillByDefault(testing::Return(10));
+
+    uint32_t meshes_created = 0;
+    auto storage = register_test_module()
+        .with_level(level)
+        .with_mesh_source([&](auto&&...) { ++meshes_created; return mock_shared<MockMesh>(); })
+        .build();
+
+    auto first = storage->mesh(0);
+    auto second = storage->mesh(1);
+    auto third = storage->mesh(2);
+    ASSERT_EQ(first, third);
+    ASSERT_NE(first, second);
+    ASSERT_EQ(meshes_created, 2u);
+}
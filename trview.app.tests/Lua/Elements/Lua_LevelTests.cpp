@@ -84,7 +84,7 @@ TEST(Lua_Level, Floordata)
 {
     std::vector<uint16_t> data { 0, 0x8004, 0x3e00, 0x0005, 0x0001, 0x0002, 0x8003 };
     auto level = mock_shared<MockLevel>();
-    EXPECT_CALL(*level, floor_data).WillRepeatedly(Return(data));
+    EXPECT_CALL(*level, floor_data).WillRepeatedly(Return(std::make_shared<LevelFloordata>(data, std::set<uint32_t>{ 0, 1 }, false)));
 
     LuaState L;
     lua::create_level(L, level);
@@ -142,7 +142,7 @@ TEST(Lua_Sector, Floordata)
 {
     std::vector<uint16_t> data { 0, 0x8004, 0x3e00, 0x0005, 0x0001, 0x0002, 0x8003 };
     auto level = mock_shared<MockLevel>();
-    EXPECT_CALL(*level, floor_data).WillRepeatedly(Return(data));
+    EXPECT_CALL(*level, floor_data).WillRepeatedly(Return(std::make_shared<LevelFloordata>(data, std::set<uint32_t>{ 1 }, false)));
     auto room = mock_shared<MockRoom>()->with_level(level);
     auto sector = mock_shared<MockSector>()->with_room(room);
     EXPECT_CALL(*sector, floordata_index).WillRepeatedly(Return(1));
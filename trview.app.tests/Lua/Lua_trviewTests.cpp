@@ -54,6 +54,7 @@ TEST(Lua_trview, Level)
         mock_shared<MockDialogs>(),
         mock_shared<MockFiles>());
 
+    EXPECT_CALL(*level, finish_load).Times(2);
     ASSERT_EQ(0, luaL_dostring(L, "return trview.level"));
     ASSERT_EQ(LUA_TUSERDATA, lua_type(L, -1));
     ASSERT_EQ(0, luaL_dostring(L, "return trview.level.filename"));
@@ -802,3 +802,56 @@ TEST(SettingsLoader, PluginsSaved)
     loader->save_user_settings(settings);
     EXPECT_THAT(output, HasSubstr("\"plugins\":{\"Default\":{\"enabled\":true}}"));
 }
+
+TEST(SettingsLoader, LevelCacheLoaded)
+{
+    auto loader = setup_setting("{\"level_cache\":false,\"level_cache_size\":256}");
+    auto settings = loader->load_user_settings();
+    ASSERT_EQ(settings.level_cache, false);
+    ASSERT_EQ(settings.level_cache_size, 256u);
+
+    auto loader_true = setup_setting("{\"level_cache\":true}");
+    auto settings_true = loader_true->load_user_settings();
+    ASSERT_EQ(settings_true.level_cache, true);
+}
+
+TEST(SettingsLoader, ParallelRoomsLoaded)
+{
+    auto loader = setup_setting("{\"parallel_rooms\":false}");
+    auto settings = loader->load_user_settings();
+    ASSERT_EQ(settings.parallel_rooms, false);
+
+    auto loader_true = setup_setting("{\"parallel_rooms\":true}");
+    auto settings_true = loader_true->load_user_settings();
+    ASSERT_EQ(settings_true.parallel_rooms, true);
+}
+
+TEST(SettingsLoader, ParallelRoomsSaved)
+{
+    std::string output;
+    auto loader = setup_save_setting(output);
+    UserSettings settings;
+    settings.parallel_rooms = false;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"parallel_rooms\":false"));
+
+    settings.parallel_rooms = true;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"parallel_rooms\":true"));
+}
+
+TEST(SettingsLoader, LevelCacheSaved)
+{
+    std::string output;
+    auto loader = setup_save_setting(output);
+    UserSettings settings;
+    settings.level_cache = false;
+    settings.level_cache_size = 256;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"level_cache\":false"));
+    EXPECT_THAT(output, HasSubstr("\"level_cache_size\":256"));
+
+    settings.level_cache = true;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"level_cache\":true"));
+}
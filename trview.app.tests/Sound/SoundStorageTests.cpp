@@ -5,20 +5,23 @@
 using namespace trview;
 using namespace trview::mocks;
 using namespace trview::tests;
+using namespace testing;
 
 TEST(SoundStorage, AddAndGetSound)
 {
     auto sound = mock_shared<MockSound>();
+    EXPECT_CALL(*sound, play).Times(1);
     auto source = [&](auto&&...) { return sound; };
     SoundStorage storage(source);
 
     auto found = storage.get(100).lock();
     ASSERT_EQ(found, nullptr);
 
-    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, {});
+    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, {}, {}, {});
 
     found = storage.get(100).lock();
-    ASSERT_EQ(found, sound);
+    ASSERT_NE(found, nullptr);
+    found->play();
 }
 
 TEST(SoundStorage, AddAndGetSounds)
@@ -30,10 +33,131 @@ TEST(SoundStorage, AddAndGetSounds)
     auto sounds = storage.sounds();
     ASSERT_EQ(sounds.empty(), true);
 
-    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, {});
+    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, {}, {}, {});
 
     sounds = storage.sounds();
     ASSERT_EQ(sounds.size(), 1);
     ASSERT_EQ(sounds[0].index.sample_index, 100);
-    ASSERT_EQ(sounds[0].sound.lock(), sound);
+    ASSERT_EQ(sounds[0].sound.lock(), storage.get(100).lock());
+}
+
+TEST(SoundStorage, SharedSampleStoredOnce)
+{
+    SoundStorage storage([](auto&&...) { return mock_shared<MockSound>(); });
+    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, {}, {}, {});
+    storage.add({ .sound_map = 1, .sound_details = 1, .sample_index = 100 }, {}, {}, {});
+
+    const auto sounds = storage.sounds();
+    ASSERT_EQ(sounds.size(), 2);
+    ASSERT_EQ(sounds[0].index.sound_map, 0);
+    ASSERT_EQ(sounds[1].index.sound_map, 1);
+    ASSERT_EQ(sounds[0].sound.lock(), sounds[1].sound.lock());
+}
+
+TEST(SoundStorage, DecodedOnFirstPlay)
+{
+    const std::vector<uint8_t> data{ 1, 2, 3 };
+    std::vector<uint8_t> played;
+    uint32_t decodes = 0;
+    auto source = [&](auto&& bytes)
+        {
+            played = bytes;
+            return mock_shared<MockSound>();
+        };
+    SoundStorage storage(source);
+    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, data, {}, [&](auto&& bytes)
+        {
+            ++decodes;
+            std::vector<uint8_t> result(bytes.begin(), bytes.end());
+            result.push_back(4);
+            return result;
+        });
+
+    ASSERT_EQ(decodes, 0u);
+    ASSERT_EQ(storage.decoded_size(), 0u);
+
+    const auto sound = storage.get(100).lock();
+    sound->play();
+    sound->play();
+
+    ASSERT_EQ(decodes, 1u);
+    ASSERT_EQ(played, (std::vector<uint8_t>{ 1, 2, 3, 4 }));
+    ASSERT_EQ(storage.decoded_size(), 4u);
+}
+
+TEST(SoundStorage, LeastRecentlyPlayedReleased)
+{
+    std::vector<uint16_t> decoded;
+    const auto decoder = [&](uint16_t index)
+        {
+            return [&, index](auto&&) { decoded.push_back(index); return std::vector<uint8_t>(8); };
+        };
+
+    SoundStorage storage([](auto&&...) { return mock_shared<MockSound>(); }, 20);
+    for (uint16_t i = 0; i < 3; ++i)
+    {
+        storage.add({ .sound_map = i, .sound_details = i, .sample_index = i }, {}, {}, decoder(i));
+    }
+
+    storage.get(0).lock()->play();
+    storage.get(1).lock()->play();
+    storage.get(0).lock()->play();
+    storage.get(2).lock()->play();
+    ASSERT_EQ(storage.decoded_size(), 16u);
+
+    storage.get(0).lock()->play();
+    storage.get(1).lock()->play();
+    ASSERT_EQ(decoded, (std::vector<uint16_t>{ 0, 1, 2, 1 }));
+}
+
+TEST(SoundStorage, DataViewedWhileStored)
+{
+    auto data = std::make_shared<std::vector<uint8_t>>(std::vector<uint8_t>{ 1, 2, 3 });
+    const std::weak_ptr<std::vector<uint8_t>> weak = data;
+    const uint8_t* decoded_from = nullptr;
+
+    {
+        SoundStorage storage([](auto&&...) { return mock_shared<MockSound>(); });
+        storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, *data, data, [&](auto&& bytes)
+            {
+                decoded_from = bytes.data();
+                return std::vector<uint8_t>(bytes.begin(), bytes.end());
+            });
+        const auto expected = data->data();
+        data.reset();
+        ASSERT_FALSE(weak.expired());
+
+        storage.get(100).lock()->play();
+        ASSERT_EQ(decoded_from, expected);
+    }
+
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(SoundStorage, PlayingSoundNotReleased)
+{
+    std::vector<uint16_t> decoded;
+    std::vector<std::shared_ptr<MockSound>> created;
+    const auto decoder = [&](uint16_t index)
+        {
+            return [&, index](auto&&) { decoded.push_back(index); return std::vector<uint8_t>(8); };
+        };
+
+    SoundStorage storage([&](auto&&...) { return created.emplace_back(mock_shared<MockSound>()); }, 20);
+    for (uint16_t i = 0; i < 3; ++i)
+    {
+        storage.add({ .sound_map = i, .sound_details = i, .sample_index = i }, {}, {}, decoder(i));
+    }
+
+    storage.get(0).lock()->play();
+    EXPECT_CALL(*created[0], is_playing).WillRepeatedly(Return(true));
+    storage.get(1).lock()->play();
+    storage.get(2).lock()->play();
+
+    ASSERT_EQ(storage.decoded_size(), 16u);
+    ASSERT_TRUE(storage.get(0).lock()->is_playing());
+
+    storage.get(0).lock()->play();
+    storage.get(1).lock()->play();
+    ASSERT_EQ(decoded, (std::vector<uint16_t>{ 0, 1, 2, 1 }));
 }
@@ -493,6 +493,64 @@ TEST(ViewerUI, SetStaticsStartupUpdatesSettingsWindow)
     ui->set_settings(settings);
 }
 
+TEST(ViewerUI, OnLevelCacheEventRaised)
+{
+    auto [settings_window_ptr, settings_window] = create_mock<MockSettingsWindow>();
+    auto ui = register_test_module().with_settings_window(std::move(settings_window_ptr)).build();
+
+    std::optional<UserSettings> settings;
+    auto token = ui->on_settings += [&](auto raised)
+        {
+            settings = raised;
+        };
+
+    settings_window.on_level_cache(true);
+
+    ASSERT_TRUE(settings);
+    ASSERT_TRUE(settings.value().level_cache);
+}
+
+TEST(ViewerUI, SetLevelCacheUpdatesSettingsWindow)
+{
+    auto [settings_window_ptr, settings_window] = create_mock<MockSettingsWindow>();
+    EXPECT_CALL(settings_window, set_level_cache(true)).Times(1);
+
+    auto ui = register_test_module().with_settings_window(std::move(settings_window_ptr)).build();
+
+    UserSettings settings{};
+    settings.level_cache = true;
+    ui->set_settings(settings);
+}
+
+TEST(ViewerUI, OnParallelRoomsEventRaised)
+{
+    auto [settings_window_ptr, settings_window] = create_mock<MockSettingsWindow>();
+    auto ui = register_test_module().with_settings_window(std::move(settings_window_ptr)).build();
+
+    std::optional<UserSettings> settings;
+    auto token = ui->on_settings += [&](auto raised)
+        {
+            settings = raised;
+        };
+
+    settings_window.on_parallel_rooms(false);
+
+    ASSERT_TRUE(settings);
+    ASSERT_FALSE(settings.value().parallel_rooms);
+}
+
+TEST(ViewerUI, SetParallelRoomsUpdatesSettingsWindow)
+{
+    auto [settings_window_ptr, settings_window] = create_mock<MockSettingsWindow>();
+    EXPECT_CALL(settings_window, set_parallel_rooms(false)).Times(1);
+
+    auto ui = register_test_module().with_settings_window(std::move(settings_window_ptr)).build();
+
+    UserSettings settings{};
+    settings.parallel_rooms = false;
+    ui->set_settings(settings);
+}
+
 TEST(ViewerUI, NgPlusEnabled)
 {
     auto [view_options_ptr, view_options] = create_mock<MockViewOptions>();
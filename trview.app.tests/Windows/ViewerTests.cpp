@@ -25,6 +25,7 @@
 #include <trview.app/Mocks/Elements/ISoundSource.h>
 
 #include <trview.tests.common/Event.h>
+#include <trview.app/Geometry/PickScene.h>
 
 using testing::A;
 using testing::Return;
@@ -1258,3 +1259,36 @@ TEST(Viewer, SetShowSoundSources)
     viewer->open(level, ILevel::OpenMode::Full);
     ui.on_toggle_changed(IViewer::Options::sound_sources, true);
 }
+
+TEST(Viewer, LevelPickedThroughPickScene)
+{
+    auto item = mock_shared<MockItem>();
+    PickTarget target
+    {
+        .bounds = DirectX::BoundingBox(Vector3::Zero, Vector3(1, 1, 1)),
+        .test = [=](auto&&...)
+            {
+                PickResult result;
+                result.hit = true;
+                result.type = PickResult::Type::Entity;
+                result.distance = 4;
+                result.item = item;
+                return result;
+            }
+    };
+
+    auto level = mock_shared<MockLevel>();
+    ON_CALL(*level, pick_scene).WillByDefault(Return(std::make_shared<const PickScene>(std::vector<PickTarget>{ target })));
+    auto [picking_ptr, picking] = create_mock<MockPicking>();
+    auto viewer = register_test_module().with_picking(std::move(picking_ptr)).build();
+    viewer->open(level, ILevel::OpenMode::Full);
+
+    const PickInfo info{ .position = Vector3(0, 0, -5), .direction = Vector3(0, 0, 1) };
+    std::vector<IPicking::Query> queries;
+    picking.query_sources(info, queries);
+    ASSERT_EQ(queries.size(), 1u);
+
+    const auto result = queries[0](info, {});
+    ASSERT_TRUE(result.hit);
+    ASSERT_EQ(result.item.lock(), item);
+}
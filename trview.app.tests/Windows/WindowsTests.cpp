@@ -619,6 +619,28 @@ TEST(Windows, SetLevel)
     windows->set_level(mock_shared<MockLevel>());
 }
 
+TEST(Windows, SetLevelContentsRefreshedWhenLoadComplete)
+{
+    auto [items_ptr, items] = create_mock<MockItemsWindowManager>();
+    EXPECT_CALL(items, set_items).Times(2);
+    EXPECT_CALL(items, set_level_version).Times(1);
+    auto [rooms_ptr, rooms] = create_mock<MockRoomsWindowManager>();
+    EXPECT_CALL(rooms, set_rooms).Times(2);
+    EXPECT_CALL(rooms, set_level_version).Times(1);
+    auto [pack_ptr, pack] = create_mock<MockPackWindowManager>();
+    EXPECT_CALL(pack, set_level).Times(1);
+    auto windows = register_test_module()
+        .with_items(std::move(items_ptr))
+        .with_packs(std::move(pack_ptr))
+        .with_rooms(std::move(rooms_ptr))
+        .build();
+
+    auto level = mock_shared<MockLevel>();
+    windows->set_level(level);
+    level->on_load_stage(ILevel::LoadStage::Items);
+    level->on_load_stage(ILevel::LoadStage::Complete);
+}
+
 TEST(Windows, SetRoom)
 {
     auto [cameras_ptr, cameras] = create_mock<MockCameraSinkWindowManager>();
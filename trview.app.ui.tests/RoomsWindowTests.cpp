@@ -117,7 +117,7 @@ void register_rooms_window_tests(ImGuiTestEngine* engine)
         {
             auto& context = ctx->GetVars<RoomsWindowContext>();
             context.ptr = register_test_module().build();
-            context.ptr->set_floordata({ 0x000, 0x8005 });
+            context.ptr->set_floordata(std::make_shared<LevelFloordata>(std::vector<uint16_t>{ 0x000, 0x8005 }, std::set<uint32_t>{ 0, 1 }, false));
 
             auto normal_room = mock_shared<MockRoom>()->with_number(0);
             auto death_room = mock_shared<MockRoom>()->with_number(1);
@@ -500,6 +500,52 @@ void register_settings_window_tests(ImGuiTestEngine* engine)
             IM_CHECK_EQ(received_value.value(), true);
         });
 
+    test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Clicking Cache Processed Levels Raises Event",
+        [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
+        [](ImGuiTestContext* ctx)
+        {
+            auto& controls = ctx->GetVars<MockWrapper<SettingsWindow>>();
+            controls.ptr = register_test_module().build();
+            controls.ptr->toggle_visibility();
+
+            std::optional<bool> received_value;
+            auto token = controls.ptr->on_level_cache += [&](bool value)
+                {
+                    received_value = value;
+                };
+
+            ctx->SetRef("Settings");
+            ctx->ItemClick("TabBar/General");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Cache processed levels"), false);
+            ctx->ItemCheck("TabBar/General/Cache processed levels");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Cache processed levels"), true);
+            IM_CHECK_EQ(received_value.has_value(), true);
+            IM_CHECK_EQ(received_value.value(), true);
+        });
+
+    test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Clicking Load Rooms in Parallel Raises Event",
+        [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
+        [](ImGuiTestContext* ctx)
+        {
+            auto& controls = ctx->GetVars<MockWrapper<SettingsWindow>>();
+            controls.ptr = register_test_module().build();
+            controls.ptr->toggle_visibility();
+
+            std::optional<bool> received_value;
+            auto token = controls.ptr->on_parallel_rooms += [&](bool value)
+                {
+                    received_value = value;
+                };
+
+            ctx->SetRef("Settings");
+            ctx->ItemClick("TabBar/General");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Load rooms in parallel"), true);
+            ctx->ItemUncheck("TabBar/General/Load rooms in parallel");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Load rooms in parallel"), false);
+            IM_CHECK_EQ(received_value.has_value(), true);
+            IM_CHECK_EQ(received_value.value(), false);
+        });
+
     test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Clicking Triggers Window on Startup Raises Event",
         [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
         [](ImGuiTestContext* ctx)
@@ -926,6 +972,38 @@ void register_settings_window_tests(ImGuiTestEngine* engine)
             IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Open Statics Window at startup"), true);
         });
 
+    test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Set Cache Processed Levels Updates Checkbox",
+        [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
+        [](ImGuiTestContext* ctx)
+        {
+            auto& controls = ctx->GetVars<MockWrapper<SettingsWindow>>();
+            controls.ptr = register_test_module().build();
+            controls.ptr->toggle_visibility();
+
+            ctx->SetRef("Settings");
+            ctx->ItemClick("TabBar/General");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Cache processed levels"), false);
+            controls.ptr->set_level_cache(true);
+            ctx->Yield();
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Cache processed levels"), true);
+        });
+
+    test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Set Load Rooms in Parallel Updates Checkbox",
+        [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
+        [](ImGuiTestContext* ctx)
+        {
+            auto& controls = ctx->GetVars<MockWrapper<SettingsWindow>>();
+            controls.ptr = register_test_module().build();
+            controls.ptr->toggle_visibility();
+
+            ctx->SetRef("Settings");
+            ctx->ItemClick("TabBar/General");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Load rooms in parallel"), true);
+            controls.ptr->set_parallel_rooms(false);
+            ctx->Yield();
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Load rooms in parallel"), false);
+        });
+
     test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Set Triggers Window on Startup Updates Checkbox",
         [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
         [](ImGuiTestContext* ctx)
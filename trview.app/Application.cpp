@@ -52,18 +52,20 @@ namespace trview
         const IRandomizerRoute::Source& randomizer_route_source,
         std::shared_ptr<IFonts> fonts,
         std::unique_ptr<IWindows> windows,
+        std::shared_ptr<ILevelCache> level_cache,
         LoadMode load_mode)
         : MessageHandler(application_window), _instance(GetModuleHandle(nullptr)),
         _file_menu(std::move(file_menu)), _update_checker(std::move(update_checker)), _view_menu(window()), _settings_loader(settings_loader), _viewer(viewer),
         _route_source(route_source), _shortcuts(shortcuts), _level_source(level_source), _dialogs(dialogs), _files(files), _timer(default_time_source()),
         _imgui_backend(std::move(imgui_backend)), _plugins(plugins), _randomizer_route_source(randomizer_route_source), _fonts(fonts), _load_mode(load_mode),
-        _windows(std::move(windows))
+        _windows(std::move(windows)), _level_cache(level_cache)
     {
         SetWindowLongPtr(window(), GWLP_USERDATA, reinterpret_cast<LONG_PTR>(_imgui_backend.get()));
 
         _update_checker->check_for_updates();
         _settings = _settings_loader->load_user_settings();
         lua::set_settings(_settings);
+        _level_cache->set_settings(_settings);
 
         set_route(_settings.randomizer_tools ? randomizer_route_source(std::nullopt) : route_source(std::nullopt));
 
@@ -112,6 +114,7 @@ namespace trview
                 _plugins->set_settings(_settings);
                 _viewer->set_settings(_settings);
                 _windows->set_settings(settings);
+                _level_cache->set_settings(settings);
                 lua::set_settings(settings);
                 if (_level)
                 {
@@ -155,7 +158,7 @@ namespace trview
 
                 try
                 {
-                    operation.level = load(filename);
+                    operation.level = load(filename, open_mode == ILevel::OpenMode::Full);
                 }
                 catch (trlevel::LevelEncryptedException&)
                 {
@@ -315,6 +318,7 @@ namespace trview
             _plugins->set_settings(_settings);
             _viewer->set_settings(_settings);
             _windows->set_settings(settings);
+            _level_cache->set_settings(settings);
             lua::set_settings(settings);
             if (_level)
             {
@@ -508,6 +512,10 @@ namespace trview
         }
 
         check_load();
+        if (_level)
+        {
+            _level->continue_load();
+        }
 
         _timer.update();
         const auto elapsed = _timer.elapsed();
@@ -737,6 +745,11 @@ namespace trview
     }
 
     std::shared_ptr<ILevel> Application::load(const std::string& filename)
+    {
+        return load(filename, false);
+    }
+
+    std::shared_ptr<ILevel> Application::load(const std::string& filename, bool progressive)
     {
         _progress = std::format("Loading {}", filename);
 
@@ -757,7 +770,7 @@ namespace trview
             }
         }
 
-        auto level = _level_source(filename, current_pack, { .on_progress_callback = [&](auto&& p) { _progress = p; } });
+        auto level = _level_source(filename, current_pack, { .on_progress_callback = [&](auto&& p) { _progress = p; }, .parallel_rooms = _settings.parallel_rooms, .progressive = progressive });
         level->set_filename(filename);
         return level;
     }
@@ -794,6 +807,16 @@ namespace trview
         set_route(_route);
         _viewer->open(level, open_mode);
 
+        // A progressive load adds the items and triggers after the route has been bound to the level.
+        _level_token_store.clear();
+        _level_token_store += _level->on_load_stage += [this](ILevel::LoadStage stage)
+            {
+                if (stage == ILevel::LoadStage::Complete)
+                {
+                    _route->set_level(_level);
+                }
+            };
+
         if (old_level && open_mode == ILevel::OpenMode::Reload)
         {
             const Vector3 old_target = _viewer->target();
@@ -6,6 +6,7 @@
 #include <trview.common/Timer.h>
 #include <trview.common/TokenStore.h>
 
+#include "Elements/ILevelCache.h"
 #include "Elements/ITypeInfoLookup.h"
 #include <trview.app/Menus/IFileMenu.h>
 #include <trview.app/Menus/IUpdateChecker.h>
@@ -68,6 +69,7 @@ namespace trview
             const IRandomizerRoute::Source& randomizer_route_source,
             std::shared_ptr<IFonts> fonts,
             std::unique_ptr<IWindows> windows,
+            std::shared_ptr<ILevelCache> level_cache,
             LoadMode load_mode);
         virtual ~Application();
         /// Attempt to open the specified level file.
@@ -119,10 +121,17 @@ namespace trview
         void select_static_mesh(const std::weak_ptr<IStaticMesh>& static_mesh);
         void select_sound_source(const std::weak_ptr<ISoundSource>& sound_source);
         void check_load();
+        /// <summary>
+        /// Load a level.
+        /// </summary>
+        /// <param name="filename">The level filename.</param>
+        /// <param name="progressive">Whether to return once the rooms around Lara are ready and finish the rest of the level each frame.</param>
+        std::shared_ptr<ILevel> load(const std::string& filename, bool progressive);
         void end_diff(const std::weak_ptr<ILevel>& level);
         void select_flyby_node(const std::weak_ptr<IFlybyNode>& node);
 
         TokenStore _token_store;
+        TokenStore _level_token_store;
 
         // Window message related components.
         std::shared_ptr<ISettingsLoader> _settings_loader;
@@ -139,6 +148,7 @@ namespace trview
         std::unique_ptr<ITypeInfoLookup> _type_info_lookup;
         std::shared_ptr<ILevel> _level;
         ILevel::Source _level_source;
+        std::shared_ptr<ILevelCache> _level_cache;
 
         // Routing and tools.
         IRoute::Source _route_source;
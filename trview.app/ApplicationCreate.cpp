@@ -26,6 +26,8 @@
 #include "Elements/Flyby/Flyby.h"
 #include "Elements/Flyby/FlybyNode.h"
 #include "Elements/Item.h"
+#include "Elements/LevelCache.h"
+#include "Elements/LevelCacheWriter.h"
 #include "Elements/Light.h"
 #include "Elements/Trigger.h"
 #include "Elements/Remastered/NgPlusSwitcher.h"
@@ -268,9 +270,11 @@ namespace trview
             };
         auto trlevel_source = [=](auto&&... args) { return std::make_shared<trlevel::Level>(args..., files, decrypter, log, pack_source); };
 
+        auto level_cache = std::make_shared<LevelCache>(files, current_version());
         auto level_source = [=](auto&& filename, auto&& pack, auto&& callbacks)
             {
                 auto level = trlevel_source(filename, pack);
+                const auto cache_key = level_cache->key(filename);
 
                 auto level_texture_storage = std::make_shared<LevelTextureStorage>(device, std::make_unique<TextureStorage>(device));
                 int count = 0;
@@ -281,15 +285,31 @@ namespace trview
                     };
 
                 auto sound_storage = std::make_shared<SoundStorage>(sound_source);
-                callbacks.on_sound_callback = [&](auto&& sound_map, auto&& sound_details, auto&& sample_index, auto&& data)
+                callbacks.on_sound_callback = [&](auto&& sound_map, auto&& sound_details, auto&& sample_index, auto&& data, auto&& owner, auto&& decoder)
                     {
-                        callbacks.on_progress(std::format("Loading sound {}:{}:{}", sound_map, sound_details, sample_index));
-                        sound_storage->add({ .sound_map = sound_map, .sound_details = sound_details, .sample_index = sample_index }, data);
+                        sound_storage->add({ .sound_map = sound_map, .sound_details = sound_details, .sample_index = sample_index }, data, owner, decoder);
                     };
 
                 level->load(callbacks);
                 level_texture_storage->load(level);
 
+                // Room geometry from the cache is used when it matches the level, otherwise the generated
+                // geometry is collected and stored once every room has been built.
+                auto cached_rooms = std::make_shared<std::vector<RoomGeometry>>();
+                std::shared_ptr<LevelCacheWriter> cache_writer;
+                if (cache_key)
+                {
+                    auto loaded = level_cache->load(cache_key.value(), filename);
+                    if (loaded && loaded->size() == level->num_rooms())
+                    {
+                        *cached_rooms = std::move(loaded.value());
+                    }
+                    else
+                    {
+                        cache_writer = std::make_shared<LevelCacheWriter>(level_cache, cache_key.value(), filename, level->num_rooms());
+                    }
+                }
+
                 auto mesh_source = [=](auto&&... args) { return std::make_shared<Mesh>(device, args..., level_texture_storage); };
                 auto mesh_transparent_source = [=](auto&&... args) { return std::make_shared<Mesh>(args...); };
 
@@ -308,16 +328,25 @@ namespace trview
 
                 auto ngplus = std::make_shared<NgPlusSwitcher>(entity_source);
 
-                auto room_source = [=](const trlevel::ILevel& level, const trlevel::tr3_room& room,
-                    const std::shared_ptr<ILevelTextureStorage>& texture_storage, const IMeshStorage& mesh_storage, uint32_t index, const std::weak_ptr<ILevel>& parent_level, uint32_t sector_base_index, const Activity& activity)
+                auto room_source = [=](const trlevel::ILevel& level, const LevelFloordata& floordata, const trlevel::tr3_room& room,
+                    const std::shared_ptr<ILevelTextureStorage>& texture_storage, uint32_t index, const std::weak_ptr<ILevel>& parent_level, uint32_t sector_base_index)
                     {
                         auto new_room = std::make_shared<Room>(room, mesh_source, texture_storage, index, parent_level);
-                        new_room->initialise(level, room, mesh_storage, static_mesh_source, static_mesh_position_source, sector_source, sector_base_index, activity);
+                        std::optional<RoomGeometry> geometry;
+                        if (index < cached_rooms->size())
+                        {
+                            geometry = std::move((*cached_rooms)[index]);
+                        }
+                        new_room->build(level, floordata, room, static_mesh_source, static_mesh_position_source, sector_source, sector_base_index, std::move(geometry));
+                        if (cache_writer)
+                        {
+                            cache_writer->add(index, new_room->pending_geometry());
+                        }
                         return new_room;
                     };
                 auto trigger_source = [=](auto&&... args) { return std::make_shared<Trigger>(args..., mesh_transparent_source); };
 
-                auto mesh_storage = std::make_shared<MeshStorage>(mesh_source, *level, *level_texture_storage);
+                auto mesh_storage = std::make_shared<MeshStorage>(mesh_source, level, level_texture_storage, log);
 
                 auto model_source = [=](auto&&... args) { return std::make_shared<Model>(args...); };
                 auto model_storage = std::make_shared<ModelStorage>(mesh_storage, model_source, *level);
@@ -343,7 +372,6 @@ namespace trview
                     sound_source_source,
                     flyby_source,
                     callbacks);
-
                 return new_level;
             };
 
@@ -444,6 +472,7 @@ namespace trview
                 std::make_unique<StaticsWindowManager>(window, shortcuts, statics_window_source),
                 std::make_unique<TexturesWindowManager>(window, textures_window_source),
                 std::make_unique<TriggersWindowManager>(window, shortcuts, triggers_window_source)),
+            level_cache,
             Application::LoadMode::Async);
     }
 }
@@ -65,20 +65,30 @@ namespace trview
 
     PickResult CameraSink::pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
-        PickResult result{};
-        BoundingBox cube(_position, Vector3(0.125f, 0.125f, 0.125f));
+        return pick_target().test(position, direction);
+    }
 
-        float distance = 0;
-        if (cube.Intersects(position, direction, distance))
+    PickTarget CameraSink::pick_target() const
+    {
+        const BoundingBox cube(_position, Vector3(0.125f, 0.125f, 0.125f));
+        return
         {
-            result.distance = distance;
-            result.hit = true;
-            result.camera_sink = std::const_pointer_cast<ICameraSink>(shared_from_this());
-            result.position = position + direction * distance;
-            result.type = PickResult::Type::CameraSink;
-        }
-
-        return result;
+            .bounds = cube,
+            .test = [cube, camera_sink = std::weak_ptr<ICameraSink>(std::const_pointer_cast<ICameraSink>(shared_from_this()))](const Vector3& position, const Vector3& direction)
+                {
+                    PickResult result{};
+                    float distance = 0;
+                    if (cube.Intersects(position, direction, distance))
+                    {
+                        result.distance = distance;
+                        result.hit = true;
+                        result.camera_sink = camera_sink;
+                        result.position = position + direction * distance;
+                        result.type = PickResult::Type::CameraSink;
+                    }
+                    return result;
+                }
+        };
     }
 
     Vector3 CameraSink::position() const
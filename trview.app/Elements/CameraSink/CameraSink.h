@@ -23,6 +23,7 @@ namespace trview
         virtual uint32_t number() const override;
         virtual bool persistent() const override;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        virtual PickTarget pick_target() const override;
         virtual DirectX::SimpleMath::Vector3 position() const override;
         void render(const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
         virtual std::weak_ptr<IRoom> room() const override;
@@ -3,6 +3,7 @@
 #include <trlevel/trtypes.h>
 #include "../../Geometry/IRenderable.h"
 #include "../../Geometry/PickResult.h"
+#include "../../Geometry/PickTarget.h"
 #include "../../Geometry/IMesh.h"
 #include "../ITrigger.h"
 
@@ -29,6 +30,7 @@ namespace trview
         virtual uint32_t number() const = 0;
         virtual bool persistent() const = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        virtual PickTarget pick_target() const = 0;
         virtual DirectX::SimpleMath::Vector3 position() const = 0;
         virtual std::weak_ptr<IRoom> room() const = 0;
         virtual uint16_t strength() const = 0;
@@ -187,13 +187,13 @@ namespace trview
         return sum;
     }
 
-    Floordata parse_floordata(const std::vector<uint16_t>& floordata, uint32_t index, FloordataMeanings meanings, bool trng, std::optional<trlevel::PlatformAndVersion> version)
+    Floordata parse_floordata(std::span<const uint16_t> floordata, uint32_t index, FloordataMeanings meanings, bool trng, std::optional<trlevel::PlatformAndVersion> version)
     {
         return parse_floordata(floordata, index, meanings, {}, trng, version);
     }
 
 
-    Floordata parse_floordata(const std::vector<uint16_t>& floordata, uint32_t index, FloordataMeanings meanings, const std::vector<std::weak_ptr<IItem>>& items, bool trng, std::optional<trlevel::PlatformAndVersion> version)
+    Floordata parse_floordata(std::span<const uint16_t> floordata, uint32_t index, FloordataMeanings meanings, const std::vector<std::weak_ptr<IItem>>& items, bool trng, std::optional<trlevel::PlatformAndVersion> version)
     {
         Floordata result;
 
@@ -301,6 +301,62 @@ namespace trview
         return result;
     }
 
+    LevelFloordata::LevelFloordata(const trlevel::ILevel& level)
+        : LevelFloordata(level.get_floor_data_all(), sector_indices(level), level.trng(), level.platform_and_version())
+    {
+    }
+
+    LevelFloordata::LevelFloordata(std::span<const uint16_t> floordata, const std::set<uint32_t>& indices, bool trng, std::optional<trlevel::PlatformAndVersion> version)
+        : _data(floordata.begin(), floordata.end())
+    {
+        _offsets.reserve(indices.size());
+        _commands.reserve(indices.size());
+        for (const auto index : indices)
+        {
+            if (index >= _data.size())
+            {
+                continue;
+            }
+            _offsets.push_back(index);
+            _commands.push_back(parse_floordata(_data, index, FloordataMeanings::None, trng, version));
+        }
+    }
+
+    std::set<uint32_t> LevelFloordata::sector_indices(const trlevel::ILevel& level)
+    {
+        std::set<uint32_t> indices;
+        const auto num_rooms = level.num_rooms();
+        for (uint32_t i = 0u; i < num_rooms; ++i)
+        {
+            for (const auto& sector : level.get_room(i).sector_list)
+            {
+                indices.insert(sector.floordata_index);
+            }
+        }
+        return indices;
+    }
+
+    const Floordata& LevelFloordata::at(uint32_t index) const
+    {
+        static const Floordata empty;
+        const auto found = std::ranges::lower_bound(_offsets, index);
+        if (found == _offsets.end() || *found != index)
+        {
+            return empty;
+        }
+        return _commands[std::distance(_offsets.begin(), found)];
+    }
+
+    std::span<const uint16_t> LevelFloordata::data() const
+    {
+        return _data;
+    }
+
+    std::size_t LevelFloordata::size() const
+    {
+        return _data.size();
+    }
+
     std::string to_string(Floordata::Command::Function function)
     {
         switch (function)
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <set>
+#include <span>
+
 #include "Types.h"
 #include "IItem.h"
+#include <trlevel/ILevel.h>
 
 namespace trview
 {
@@ -61,9 +65,47 @@ namespace trview
     /// <param name="floordata">The raw floor data.</param>
     /// <param name="index">The index to start at.</param>
     /// <returns>The parsed floor data.</returns>
-    Floordata parse_floordata(const std::vector<uint16_t>& floordata, uint32_t index, FloordataMeanings meanings, bool trng, std::optional<trlevel::PlatformAndVersion> version = std::nullopt);
+    Floordata parse_floordata(std::span<const uint16_t> floordata, uint32_t index, FloordataMeanings meanings, bool trng, std::optional<trlevel::PlatformAndVersion> version = std::nullopt);
+
+    Floordata parse_floordata(std::span<const uint16_t> floordata, uint32_t index, FloordataMeanings meanings, const std::vector<std::weak_ptr<IItem>>& items, bool trng, std::optional<trlevel::PlatformAndVersion> version = std::nullopt);
 
-    Floordata parse_floordata(const std::vector<uint16_t>& floordata, uint32_t index, FloordataMeanings meanings, const std::vector<std::weak_ptr<IItem>>& items, bool trng, std::optional<trlevel::PlatformAndVersion> version = std::nullopt);
+    /// <summary>
+    /// Floordata for a whole level. Every command list that is referenced is decoded once and the
+    /// result is shared between sectors, windows and scripts.
+    /// </summary>
+    class LevelFloordata final
+    {
+    public:
+        LevelFloordata() = default;
+        /// <summary>
+        /// Decode the floordata referenced by every sector in the level.
+        /// </summary>
+        /// <param name="level">The level to read floordata from.</param>
+        explicit LevelFloordata(const trlevel::ILevel& level);
+        /// <summary>
+        /// Decode the floordata command lists that start at the specified indices.
+        /// </summary>
+        /// <param name="floordata">The raw floor data.</param>
+        /// <param name="indices">The start of each command list to decode.</param>
+        explicit LevelFloordata(std::span<const uint16_t> floordata, const std::set<uint32_t>& indices, bool trng, std::optional<trlevel::PlatformAndVersion> version = std::nullopt);
+        /// <summary>
+        /// Get the decoded commands for the list that starts at the specified index.
+        /// </summary>
+        /// <param name="index">The floordata index.</param>
+        /// <returns>The decoded floordata or an empty result if the index was not decoded.</returns>
+        const Floordata& at(uint32_t index) const;
+        /// <summary>
+        /// Get the raw floordata values.
+        /// </summary>
+        std::span<const uint16_t> data() const;
+        std::size_t size() const;
+    private:
+        static std::set<uint32_t> sector_indices(const trlevel::ILevel& level);
+
+        std::vector<uint16_t> _data;
+        std::vector<uint32_t> _offsets;
+        std::vector<Floordata> _commands;
+    };
 
     enum class TriangulationDirection
     {
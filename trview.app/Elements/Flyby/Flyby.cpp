@@ -257,23 +257,49 @@ namespace trview
 
     PickResult Flyby::pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
-        PickResult result{};
+        return pick_target().test(position, direction);
+    }
 
+    PickTarget Flyby::pick_target() const
+    {
+        std::vector<std::pair<BoundingSphere, std::weak_ptr<IFlybyNode>>> nodes;
+        BoundingBox bounds(Vector3::Zero, Vector3::Zero);
         for (const auto& node : _camera_nodes)
         {
-            BoundingSphere sphere(node->position(), 0.125f);
-
-            float distance = 0;
-            if (sphere.Intersects(position, direction, distance))
+            const BoundingSphere sphere(node->position(), 0.125f);
+            BoundingBox node_bounds;
+            BoundingBox::CreateFromSphere(node_bounds, sphere);
+            if (nodes.empty())
+            {
+                bounds = node_bounds;
+            }
+            else
             {
-                result.distance = distance;
-                result.hit = true;
-                result.position = position + direction * distance;
-                result.type = PickResult::Type::FlybyNode;
-                result.flyby_node = std::const_pointer_cast<IFlybyNode>(node);
+                BoundingBox::CreateMerged(bounds, bounds, node_bounds);
             }
+            nodes.push_back({ sphere, node });
         }
 
-        return result;
+        return
+        {
+            .bounds = bounds,
+            .test = [nodes](const Vector3& position, const Vector3& direction)
+                {
+                    PickResult result{};
+                    for (const auto& [sphere, node] : nodes)
+                    {
+                        float distance = 0;
+                        if (sphere.Intersects(position, direction, distance))
+                        {
+                            result.distance = distance;
+                            result.hit = true;
+                            result.position = position + direction * distance;
+                            result.type = PickResult::Type::FlybyNode;
+                            result.flyby_node = node;
+                        }
+                    }
+                    return result;
+                }
+        };
     }
 }
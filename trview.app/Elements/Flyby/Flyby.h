@@ -21,6 +21,7 @@ namespace trview
         void set_visible(bool value) override;
         [[nodiscard]] CameraState update_state(const CameraState& state, float delta) const override;
         PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        PickTarget pick_target() const override;
     private:
         void generate_path(const IMesh::Source& mesh_source);
         void state_at(CameraState& state) const;
@@ -13,6 +13,7 @@
 
 #include "../../Geometry/IRenderable.h"
 #include "../../Geometry/PickResult.h"
+#include "../../Geometry/PickTarget.h"
 
 namespace trview
 {
@@ -71,6 +72,7 @@ namespace trview
         virtual std::vector<std::weak_ptr<IFlybyNode>> nodes() const = 0;
         virtual uint32_t number() const = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        virtual PickTarget pick_target() const = 0;
         virtual [[nodiscard]] CameraState update_state(const CameraState& state, float delta) const = 0;
 
         Event<> on_changed;
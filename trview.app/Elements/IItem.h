@@ -8,6 +8,7 @@
 #include <trlevel/trtypes.h>
 #include "../Geometry/IRenderable.h"
 #include "../Geometry/PickResult.h"
+#include "../Geometry/PickTarget.h"
 
 namespace trview
 {
@@ -28,6 +29,10 @@ namespace trview
         virtual uint32_t number() const = 0;
         virtual std::weak_ptr<IRoom> room() const = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        /// <summary>
+        /// Copy what is needed to pick the entity, so it can be picked on another thread.
+        /// </summary>
+        virtual PickTarget pick_target() const = 0;
         virtual DirectX::BoundingBox bounding_box() const = 0;
         /// <summary>
         /// Adjust the y position of the entity by the specified amount.
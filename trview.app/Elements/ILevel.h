@@ -15,6 +15,7 @@
 
 namespace trview
 {
+    class PickScene;
     struct ISoundStorage;
     struct ISoundSource;
 
@@ -35,6 +36,23 @@ namespace trview
             Neighbours
         };
 
+        /// <summary>
+        /// Stages of a progressive load, in the order that they complete.
+        /// </summary>
+        enum class LoadStage
+        {
+            /// The start room and its neighbours can be rendered.
+            StartRooms,
+            /// All rooms can be rendered.
+            Rooms,
+            /// Triggers have been generated.
+            Triggers,
+            /// Items, lights, camera/sinks, flybys, sound sources and static meshes have been generated.
+            Items,
+            /// The all geometry data has been generated and the level is fully loaded.
+            Complete
+        };
+
         virtual ~ILevel() = 0;
         virtual void add_scriptable(const std::weak_ptr<IScriptable>& scriptable) = 0;
         /// Gets whether the specified alternate group is active.
@@ -53,13 +71,25 @@ namespace trview
         virtual std::vector<std::weak_ptr<ICameraSink>> camera_sinks() const = 0;
         virtual std::string filename() const = 0;
         virtual bool has_model(uint32_t type_id) const = 0;
-        virtual std::vector<uint16_t> floor_data() const = 0;
+        virtual std::shared_ptr<const LevelFloordata> floor_data() const = 0;
         virtual bool highlight_mode_enabled(RoomHighlightMode mode) const = 0;
         virtual std::weak_ptr<IItem> item(uint32_t index) const = 0;
         /// Get the items in this level.
         /// @returns All items in the level.
         virtual std::vector<std::weak_ptr<IItem>> items() const = 0;
         virtual std::vector<graphics::Texture> level_textures() const = 0;
+        /// <summary>
+        /// Get the last stage of loading that has completed.
+        /// </summary>
+        virtual LoadStage load_stage() const = 0;
+        /// <summary>
+        /// Perform the next step of a progressive load. Does nothing once the level is complete.
+        /// </summary>
+        virtual void continue_load() = 0;
+        /// <summary>
+        /// Perform the rest of a progressive load now, for users that need the whole level.
+        /// </summary>
+        virtual void finish_load() = 0;
         virtual std::weak_ptr<ILight> light(uint32_t index) const = 0;
         virtual std::vector<std::weak_ptr<ILight>> lights() const = 0;
         virtual MapColours map_colours() const = 0;
@@ -76,6 +106,11 @@ namespace trview
         // how far along the ray the hit was and the position in world space. The room that was hit
         // is also specified.
         virtual PickResult pick(const ICamera& camera, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        /// <summary>
+        /// Get a snapshot of everything that can currently be picked. The snapshot never changes, so it can be picked on
+        /// another thread while the level carries on.
+        /// </summary>
+        virtual std::shared_ptr<const PickScene> pick_scene() const = 0;
         virtual trlevel::Platform platform() const = 0;
         /// Render the current scene.
         /// @param camera The current camera.
@@ -134,6 +169,10 @@ namespace trview
         virtual std::shared_ptr<ILevelTextureStorage> texture_storage() const = 0;
         virtual std::weak_ptr<IStaticMesh> static_mesh(uint32_t index) const = 0;
         /// <summary>
+        /// Get the room that Lara starts in, or the first room if there is no Lara.
+        /// </summary>
+        virtual std::weak_ptr<IRoom> start_room() const = 0;
+        /// <summary>
         /// Get the trigger at the specific index.
         /// </summary>
         /// <param name="index">Trigger index.</param>
@@ -144,6 +183,12 @@ namespace trview
         /// </summary>
         /// <returns>All triggers in the level.</returns>
         virtual std::vector<std::weak_ptr<ITrigger>> triggers() const = 0;
+        /// <summary>
+        /// Get the triggers that reference an item, in trigger order.
+        /// </summary>
+        /// <param name="index">Item index.</param>
+        /// <returns>The triggers that trigger or look at the item.</returns>
+        virtual std::vector<std::weak_ptr<ITrigger>> triggers_for_item(uint32_t index) const = 0;
         virtual trlevel::LevelVersion version() const = 0;
         virtual std::weak_ptr<ISoundStorage> sound_storage() const = 0;
         virtual bool trng() const = 0;
@@ -164,5 +209,7 @@ namespace trview
         mutable Event<> on_geometry_colours_changed;
         Event<std::weak_ptr<ITrigger>> on_trigger_selected;
         Event<bool> on_ng_plus;
+        /// Event raised when a stage of a progressive load has completed.
+        Event<LoadStage> on_load_stage;
     };
 }
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Room.h"
+#include "../Settings/UserSettings.h"
+
+namespace trview
+{
+    /// <summary>
+    /// Stores the device independent results of processing a level so that they can be reused when the same
+    /// level is opened again.
+    /// </summary>
+    struct ILevelCache
+    {
+        virtual ~ILevelCache() = 0;
+        /// <summary>
+        /// Get the cache key for a level file. The key comes from the file details, the contents are not read.
+        /// </summary>
+        /// <param name="filename">The level filename.</param>
+        /// <returns>The key, or empty if the cache is disabled or the file doesn't exist.</returns>
+        virtual std::optional<std::string> key(const std::string& filename) const = 0;
+        /// <summary>
+        /// Load the room geometry stored for a key if it was made from the current contents of the level file.
+        /// </summary>
+        /// <param name="key">The key for the level.</param>
+        /// <param name="filename">The level filename.</param>
+        /// <returns>The geometry for each room, or empty if there is no valid entry.</returns>
+        virtual std::optional<std::vector<RoomGeometry>> load(const std::string& key, const std::string& filename) const = 0;
+        /// <summary>
+        /// Store the room geometry for a key. The least recently used entries are removed if the cache is larger than the size limit.
+        /// </summary>
+        /// <param name="key">The key for the level.</param>
+        /// <param name="filename">The level filename.</param>
+        /// <param name="rooms">The geometry for each room.</param>
+        virtual void save(const std::string& key, const std::string& filename, const std::vector<RoomGeometry>& rooms) = 0;
+        virtual void set_settings(const UserSettings& settings) = 0;
+    };
+}
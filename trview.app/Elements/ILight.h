@@ -4,6 +4,7 @@
 #include <external/DirectXTK/Inc/SimpleMath.h>
 #include <trview.app/Geometry/IRenderable.h>
 #include <trview.app/Geometry/PickResult.h>
+#include <trview.app/Geometry/PickTarget.h>
 #include <trlevel/tr_lights.h>
 
 namespace trview
@@ -26,6 +27,7 @@ namespace trview
         virtual DirectX::SimpleMath::Vector3 direction() const = 0;
         virtual std::weak_ptr<ILevel> level() const = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        virtual PickTarget pick_target() const = 0;
         virtual float in() const = 0;
         virtual float out() const = 0;
         virtual float rad_in() const = 0;
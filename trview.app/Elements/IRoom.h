@@ -14,6 +14,7 @@
 #include <trview.app/Elements/ILight.h>
 #include <trview.app/Geometry/ITransparencyBuffer.h>
 #include <trview.app/Geometry/PickInfo.h>
+#include <trview.app/Geometry/PickTarget.h>
 #include <trview.app/Graphics/ILevelTextureStorage.h>
 #include <trview.app/Graphics/IMeshStorage.h>
 #include <trview.common/Logs/Activity.h>
@@ -90,10 +91,11 @@ namespace trview
         Event<> on_changed;
 
         /// <summary>
-        /// Create a new implementation of <see cref="IRoom"/>.
+        /// Create a new implementation of <see cref="IRoom"/> with its sectors and geometry built. Device resources are not created
+        /// until <see cref="upload"/> is called, so this may be called from worker threads.
         /// </summary>
-        using Source = std::function<std::shared_ptr<IRoom>(const trlevel::ILevel&, const trlevel::tr3_room&,
-            const std::shared_ptr<ILevelTextureStorage>&, const IMeshStorage&, uint32_t, const std::weak_ptr<ILevel>&, uint32_t, const Activity& activity)>;
+        using Source = std::function<std::shared_ptr<IRoom>(const trlevel::ILevel&, const LevelFloordata&, const trlevel::tr3_room&,
+            const std::shared_ptr<ILevelTextureStorage>&, uint32_t, const std::weak_ptr<ILevel>&, uint32_t)>;
         /// <summary>
         /// Destructor for <see cref="IRoom"/>.
         /// </summary>
@@ -225,6 +227,12 @@ namespace trview
         /// <returns>The <see cref="PickResult"/>.</returns>
         virtual std::vector<PickResult> pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, PickFilter filters = PickFilter::Default) const = 0;
         /// <summary>
+        /// Copy the geometry and contents of the room that pass the filters so that they can be picked on another thread.
+        /// </summary>
+        /// <param name="filters">The types of objects to include.</param>
+        /// <returns>A target for the room geometry and one for each included object.</returns>
+        virtual std::vector<PickTarget> pick_targets(PickFilter filters) const = 0;
+        /// <summary>
         /// Gets whether the room is a quicksand room based on the room flags. This can only be true if the game is TR3 or later.
         /// </summary>
         /// <returns>Whether the room is a quicksand room.</returns>
@@ -280,6 +288,14 @@ namespace trview
         /// </summary>
         virtual void update_bounding_box() = 0;
         /// <summary>
+        /// Create the meshes for the geometry built when the room was created, along with the static meshes and sprites.
+        /// Must be called on the loading thread.
+        /// </summary>
+        /// <param name="level">The level the room was read from.</param>
+        /// <param name="mesh_storage">Storage for static meshes.</param>
+        /// <param name="activity">Activity to log to.</param>
+        virtual void upload(const trlevel::ILevel& level, const IMeshStorage& mesh_storage, const Activity& activity) = 0;
+        /// <summary>
         /// Gets whether the room is a water room based on the room flags.
         /// </summary>
         /// <returns>Whether the room is a water room.</returns>
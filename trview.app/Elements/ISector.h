@@ -17,7 +17,7 @@ namespace trview
 
     struct ISector
     {
-        using Source = std::function<std::shared_ptr<ISector>(const trlevel::ILevel&, const trlevel::tr3_room&,
+        using Source = std::function<std::shared_ptr<ISector>(const trlevel::ILevel&, const LevelFloordata&, const trlevel::tr3_room&,
             const trlevel::tr_room_sector&, int, const std::weak_ptr<IRoom>&, uint32_t)>;
 
         enum class Corner
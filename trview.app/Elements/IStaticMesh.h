@@ -5,6 +5,7 @@
 #include <trlevel/trtypes.h>
 #include <trview.app/Camera/ICamera.h>
 #include <trview.app/Geometry/IMesh.h>
+#include <trview.app/Geometry/PickTarget.h>
 #include <trview.common/Event.h>
 
 namespace trview
@@ -29,12 +30,17 @@ namespace trview
         virtual void render_bounding_box(const ICamera& camera, const DirectX::SimpleMath::Color& colour) = 0;
         virtual void get_transparent_triangles(ITransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour) = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        virtual PickTarget pick_target() const = 0;
 
         virtual DirectX::SimpleMath::Vector3 position() const = 0;
         virtual std::weak_ptr<IRoom> room() const = 0;
         virtual float rotation() const = 0;
         virtual DirectX::BoundingBox visibility() const = 0;
         virtual DirectX::BoundingBox collision() const = 0;
+        /// <summary>
+        /// Get world space bounds that contain everything pick can hit. Sprites face the camera so their bounds cover any rotation.
+        /// </summary>
+        virtual DirectX::BoundingBox bounding_box() const = 0;
         virtual Type type() const = 0;
         virtual uint16_t id() const = 0;
         virtual void set_number(uint32_t number) = 0;
@@ -8,6 +8,7 @@
 #include <trview.app/Geometry/IRenderable.h>
 #include <trview.app/Geometry/TransparentTriangle.h>
 #include <trview.app/Geometry/PickResult.h>
+#include <trview.app/Geometry/PickTarget.h>
 #include <trview.app/Elements/Types.h>
 #include <trview.common/Event.h>
 
@@ -41,6 +42,11 @@ namespace trview
         virtual void set_colour(const std::optional<Colour>& colour) = 0;
         virtual void set_triangles(const std::vector<TransparentTriangle>& transparent_triangles) = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        virtual PickTarget pick_target() const = 0;
+        /// <summary>
+        /// Get the world space bounds of the trigger geometry.
+        /// </summary>
+        virtual DirectX::BoundingBox bounding_box() const = 0;
         virtual void set_position(const DirectX::SimpleMath::Vector3& position) = 0;
         virtual DirectX::SimpleMath::Vector3 position() const = 0;
         virtual std::weak_ptr<ILevel> level() const = 0;
@@ -141,51 +141,59 @@ namespace trview
 
         if (auto model = _model.lock())
         {
-            model->render_transparency(_world, transparency, colour);
+            model->render_transparency(_world, transparency, colour, _model_transparent_triangles);
         }
 
         if (_sprite_mesh)
         {
-            auto world = create_billboard(_position, _offset, _scale, camera);
-            for (const auto& triangle : _sprite_mesh->transparent_triangles())
-            {
-                transparency.add(triangle.transform(world, colour, true));
-            }
+            _sprite_transparent_triangles.add(transparency, _sprite_mesh, create_billboard(_position, _offset, _scale, camera), colour, true);
         }
     }
 
     PickResult Item::pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
-        // Check against some sort of bounding box (based on the mesh?)
-        // Test against bounding box for the room first, to avoid more expensive mesh-ray intersection
-        float box_distance = 0;
-        if (!bounding_box().Intersects(position, direction, box_distance))
-        {
-            return PickResult();
-        }
-
-        if (_sprite_mesh)
-        {
-            PickResult result;
-            result.hit = true;
-            result.type = PickResult::Type::Entity;
-            result.item = std::const_pointer_cast<IItem>(shared_from_this());
-            result.distance = box_distance;
-            result.position = position + direction * box_distance;
-            result.item = std::const_pointer_cast<IItem>(shared_from_this());
-            return result;
-        }
+        return pick_target().test(position, direction);
+    }
 
-        if (auto model = _model.lock())
+    PickTarget Item::pick_target() const
+    {
+        const auto box = bounding_box();
+        const std::weak_ptr<IItem> self = std::const_pointer_cast<IItem>(shared_from_this());
+        return
         {
-            auto result = model->pick(_world, position, direction);
-            if (result.hit)
-            {
-                result.item = std::const_pointer_cast<IItem>(shared_from_this());
-                return result;
-            }
-        }
-        return {};
+            .bounds = box,
+            .test = [=, sprite = _sprite_mesh != nullptr, model = _model.lock(), world = _world](const Vector3& position, const Vector3& direction)
+                {
+                    // Test against bounding box first, to avoid more expensive mesh-ray intersection
+                    float box_distance = 0;
+                    if (!box.Intersects(position, direction, box_distance))
+                    {
+                        return PickResult();
+                    }
+
+                    if (sprite)
+                    {
+                        PickResult result;
+                        result.hit = true;
+                        result.type = PickResult::Type::Entity;
+                        result.distance = box_distance;
+                        result.position = position + direction * box_distance;
+                        result.item = self;
+                        return result;
+                    }
+
+                    if (model)
+                    {
+                        auto result = model->pick(world, position, direction);
+                        if (result.hit)
+                        {
+                            result.item = self;
+                            return result;
+                        }
+                    }
+                    return PickResult();
+                }
+        };
     }
 
     void Item::generate_bounding_box()
@@ -251,6 +259,7 @@ namespace trview
         auto offset = Matrix::CreateTranslation(0, amount, 0);
         _world *= offset;
         _bounding_box.Transform(_bounding_box, offset);
+        on_changed();
     }
 
     bool Item::needs_ocb_adjustment() const
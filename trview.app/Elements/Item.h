@@ -9,6 +9,7 @@
 #include <trview.app/Geometry/PickResult.h>
 #include <trview.app/Geometry/IRenderable.h>
 #include <trview.app/Geometry/IMesh.h>
+#include <trview.app/Geometry/TransparentTriangleCache.h>
 #include "IItem.h"
 #include "TypeInfo.h"
 
@@ -38,6 +39,7 @@ namespace trview
         virtual void get_transparent_triangles(ITransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
 
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        virtual PickTarget pick_target() const override;
         virtual DirectX::BoundingBox bounding_box() const override;
 
         virtual bool visible() const override;
@@ -68,6 +70,9 @@ namespace trview
         DirectX::SimpleMath::Matrix               _world;
         std::shared_ptr<IMesh>                    _sprite_mesh;
         std::weak_ptr<IModel>                     _model;
+        /// The model is shared with other items, so the triangles transformed for this item are kept here.
+        std::vector<TransparentTriangleCache>     _model_transparent_triangles;
+        TransparentTriangleCache                  _sprite_transparent_triangles;
 
         std::weak_ptr<IRoom>                      _room;
         uint32_t                                  _number;
@@ -6,9 +6,13 @@
 #include "../Graphics/LevelTextureStorage.h"
 #include "../Camera/ICamera.h"
 #include "Remastered/INgPlusSwitcher.h"
+#include "../Geometry/PickScene.h"
 #include <trview.graphics/RasterizerStateStore.h>
+#include <execution>
 #include <format>
+#include <iterator>
 #include <ranges>
+#include <unordered_map>
 
 using namespace DirectX;
 using namespace DirectX::SimpleMath;
@@ -56,6 +60,49 @@ namespace trview
 
             return id == 52;
         }
+
+        /// <summary>
+        /// Hash key for a sector triangle. Vertices are quantised and sorted so that the key does not depend on winding
+        /// or starting vertex - equal triangles always share a key, and candidates are then confirmed with operator==.
+        /// </summary>
+        struct TriangleKey
+        {
+            std::array<std::array<int32_t, 3>, 3> vertices;
+
+            explicit TriangleKey(const ISector::Triangle& triangle)
+            {
+                constexpr float Quantise = 1024.0f;
+                const auto quantise = [](const Vector3& v) -> std::array<int32_t, 3>
+                    {
+                        return
+                        {
+                            static_cast<int32_t>(std::lround(v.x * Quantise)),
+                            static_cast<int32_t>(std::lround(v.y * Quantise)),
+                            static_cast<int32_t>(std::lround(v.z * Quantise))
+                        };
+                    };
+                vertices = { quantise(triangle.v0), quantise(triangle.v1), quantise(triangle.v2) };
+                std::ranges::sort(vertices);
+            }
+
+            bool operator==(const TriangleKey& other) const = default;
+        };
+
+        struct TriangleKeyHash
+        {
+            std::size_t operator()(const TriangleKey& key) const noexcept
+            {
+                std::size_t hash = 0;
+                for (const auto& vertex : key.vertices)
+                {
+                    for (const auto value : vertex)
+                    {
+                        hash ^= std::hash<int32_t>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                    }
+                }
+                return hash;
+            }
+        };
     }
 
     ILevel::~ILevel()
@@ -189,6 +236,14 @@ namespace trview
         return triggers;
     }
 
+    std::vector<std::weak_ptr<ITrigger>> Level::triggers_for_item(uint32_t index) const
+    {
+        const auto [begin, end] = _item_triggers.equal_range(index);
+        std::vector<std::weak_ptr<ITrigger>> triggers;
+        std::transform(begin, end, std::back_inserter(triggers), [](const auto& entry) { return entry.second; });
+        return triggers;
+    }
+
     void Level::set_highlight_mode(RoomHighlightMode mode, bool enabled)
     {
         if (enabled)
@@ -449,28 +504,7 @@ namespace trview
     {
         std::vector<RoomToRender> rooms;
 
-        const auto frustum = camera.frustum();
-        const auto view_projection = camera.view_projection();
-        BoundingBox screen_box;
-        DirectX::BoundingBox::CreateFromPoints(screen_box, Vector3(-1, -1, 0), Vector3(1, 1, 1));
-
-        auto visible_perspective = [&](const IRoom& room)
-        {
-            return frustum.Contains(room.bounding_box()) != DISJOINT;
-        };
-
-        auto visible_orthographic = [&](const IRoom& room)
-        {
-            DirectX::BoundingBox room_box = room.bounding_box();
-            room_box.Transform(room_box, view_projection);
-            return room_box.Intersects(screen_box);
-        };
-
-        auto in_view = [&](const IRoom& room)
-        {
-            return camera.projection_mode() == ProjectionMode::Orthographic ? visible_orthographic(room) : visible_perspective(room);
-        };
-
+        const auto in_view = room_in_view(camera);
         bool highlight = highlight_mode_enabled(RoomHighlightMode::Highlight);
         const auto selected = _selected_room.lock();
         if (highlight_mode_enabled(RoomHighlightMode::Neighbours))
@@ -478,7 +512,7 @@ namespace trview
             for (uint16_t i : _neighbours)
             {
                 const auto& room = _rooms[i];
-                if (!room->visible() || is_alternate_mismatch(*room) || !in_view(*room))
+                if (!_room_uploaded[i] || !room->visible() || is_alternate_mismatch(*room) || !in_view(*room))
                 {
                     continue;
                 }
@@ -490,7 +524,7 @@ namespace trview
             for (std::size_t i = 0; i < _rooms.size(); ++i)
             {
                 const auto& room = _rooms[i];
-                if (!room->visible() || is_alternate_mismatch(*room) || !in_view(*room))
+                if (!_room_uploaded[i] || !room->visible() || is_alternate_mismatch(*room) || !in_view(*room))
                 {
                     continue;
                 }
@@ -501,21 +535,142 @@ namespace trview
         return rooms;
     }
 
-    void Level::generate_rooms(const trlevel::ILevel& level, const IRoom::Source& room_source, const IMeshStorage& mesh_storage)
+    std::function<bool(const IRoom&)> Level::room_in_view(const ICamera& camera) const
+    {
+        if (camera.projection_mode() == ProjectionMode::Orthographic)
+        {
+            BoundingBox screen_box;
+            DirectX::BoundingBox::CreateFromPoints(screen_box, Vector3(-1, -1, 0), Vector3(1, 1, 1));
+            return [view_projection = camera.view_projection(), screen_box](const IRoom& room)
+            {
+                DirectX::BoundingBox room_box = room.bounding_box();
+                room_box.Transform(room_box, view_projection);
+                return room_box.Intersects(screen_box);
+            };
+        }
+
+        return [frustum = camera.frustum()](const IRoom& room)
+        {
+            return frustum.Contains(room.bounding_box()) != DISJOINT;
+        };
+    }
+
+    void Level::order_rooms(const trlevel::ILevel& level, bool progressive)
     {
-        Activity generate_rooms_activity(_log, "Level", level.name());
         const auto num_rooms = level.num_rooms();
+
+        // Sector numbering runs through the rooms in order, so work out where each room starts before any are built.
+        // The portals and the rooms above and below each sector give the graph used to choose the order until the
+        // rooms have been built and can say who their neighbours are.
+        _pending_load->sector_base_indices.resize(num_rooms);
+        std::vector<std::set<uint16_t>> neighbours(num_rooms);
         uint32_t sector_base_index = 0;
         for (uint32_t i = 0u; i < num_rooms; ++i)
         {
-            Activity room_activity(generate_rooms_activity, std::format("Room {}", i));
-            auto room = room_source(level, level.get_room(i), _texture_storage, mesh_storage, i, shared_from_this(), sector_base_index, room_activity);
-            _token_store += room->on_changed += [this]() { content_changed(); };
-            _rooms.push_back(room);
-            sector_base_index += static_cast<uint32_t>(room->sectors().size());
+            const auto& room = level.get_room(i);
+            _pending_load->sector_base_indices[i] = sector_base_index;
+            sector_base_index += static_cast<uint32_t>(room.sector_list.size());
+
+            const auto add_neighbour = [&](uint32_t neighbour)
+                {
+                    if (neighbour < num_rooms && neighbour != i)
+                    {
+                        neighbours[i].insert(static_cast<uint16_t>(neighbour));
+                    }
+                };
+            for (const auto& portal : room.portals)
+            {
+                add_neighbour(portal.adjoining_room);
+            }
+            for (const auto& sector : room.sector_list)
+            {
+                add_neighbour(sector.room_below);
+                add_neighbour(sector.room_above);
+            }
         }
+        _room_graph = RoomGraph(neighbours);
+        _rooms.resize(num_rooms);
 
-        std::set<uint32_t> alternate_groups;
+        const uint32_t num_entities = level.num_entities();
+        for (uint32_t i = 0; i < num_entities; ++i)
+        {
+            const auto entity = level.get_entity(i);
+            if (entity.TypeID == 0 && entity.Room >= 0 && static_cast<uint32_t>(entity.Room) < num_rooms)
+            {
+                _start_room = static_cast<uint16_t>(entity.Room);
+            }
+        }
+
+        // A progressive load builds and uploads the rooms nearest the start room first, any rooms that can't be
+        // reached from there follow in room order.
+        _room_uploaded.assign(num_rooms, false);
+        _upload_order.clear();
+        if (progressive)
+        {
+            std::ranges::copy(_room_graph.rooms_within(_start_room, RoomGraph::Unreachable), std::back_inserter(_upload_order));
+            for (uint16_t i = 0u; i < num_rooms; ++i)
+            {
+                if (_room_graph.distance(_start_room, i) == RoomGraph::Unreachable)
+                {
+                    _upload_order.push_back(i);
+                }
+            }
+        }
+        else
+        {
+            _upload_order.resize(num_rooms);
+            std::iota(_upload_order.begin(), _upload_order.end(), static_cast<uint16_t>(0u));
+        }
+    }
+
+    void Level::build_rooms(std::span<const uint16_t> indices)
+    {
+        const auto& level = *_pending_load->level;
+        const auto build_room = [&](uint16_t i)
+            {
+                if (!_rooms[i])
+                {
+                    _rooms[i] = _pending_load->room_source(level, *_floor_data, level.get_room(i), _texture_storage, i, shared_from_this(), _pending_load->sector_base_indices[i]);
+                }
+            };
+
+        // Building the sectors and geometry doesn't touch the device, so rooms can be built at the same time.
+        if (_pending_load->callbacks.parallel_rooms)
+        {
+            std::vector<std::size_t> positions(indices.size());
+            std::iota(positions.begin(), positions.end(), std::size_t(0));
+            std::vector<std::exception_ptr> errors(indices.size());
+            std::for_each(std::execution::par, positions.begin(), positions.end(), [&](std::size_t position)
+                {
+                    try
+                    {
+                        build_room(indices[position]);
+                    }
+                    catch (...)
+                    {
+                        errors[position] = std::current_exception();
+                    }
+                });
+
+            for (const auto& error : errors)
+            {
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+        else
+        {
+            std::ranges::for_each(indices, build_room);
+        }
+    }
+
+    void Level::link_rooms()
+    {
+        std::vector<std::set<uint16_t>> neighbours;
+        std::ranges::transform(_rooms, std::back_inserter(neighbours), [](const auto& room) { return room->neighbours(); });
+        _room_graph = RoomGraph(neighbours);
 
         // Fix up the IsAlternate status of the rooms that are referenced by HasAlternate rooms.
         // This can only be done once all the rooms are loaded.
@@ -524,8 +679,6 @@ namespace trview
             const auto& room = _rooms[i];
             if (room->alternate_mode() == IRoom::AlternateMode::HasAlternate)
             {
-                alternate_groups.insert(room->alternate_group());
-
                 int16_t alternate = room->alternate_room();
                 if (alternate != -1)
                 {
@@ -533,6 +686,12 @@ namespace trview
                 }
             }
         }
+
+        if (const auto selected_room = _selected_room.lock())
+        {
+            const auto neighbours = _room_graph.rooms_within(static_cast<uint16_t>(selected_room->number()), _neighbour_depth);
+            _neighbours.assign(neighbours.begin(), neighbours.end());
+        }
     }
 
     void Level::generate_triggers(const ITrigger::Source& trigger_source)
@@ -551,6 +710,24 @@ namespace trview
             }
         }
 
+        // Index the items referenced by each trigger so that items don't have to search every trigger.
+        for (const auto& trigger : _triggers)
+        {
+            std::set<uint32_t> items;
+            for (const auto& command : trigger->commands())
+            {
+                if (command_is_item(command.type()))
+                {
+                    items.insert(command.index());
+                }
+            }
+
+            for (const auto& item : items)
+            {
+                _item_triggers.emplace(item, trigger);
+            }
+        }
+
         for (auto& room : _rooms)
         {
             room->generate_trigger_geometry();
@@ -599,6 +776,10 @@ namespace trview
             }
         }
 
+    }
+
+    void Level::generate_sector_triangles()
+    {
         for (auto& room : _rooms)
         {
             room->generate_sector_triangles();
@@ -614,18 +795,9 @@ namespace trview
         const uint32_t num_entities = level.num_entities();
         for (uint32_t i = 0; i < num_entities; ++i)
         {
-            std::vector<std::weak_ptr<ITrigger>> relevant_triggers;
-            for (const auto& trigger : _triggers)
-            {
-                if (trigger->triggers_item(i))
-                {
-                    relevant_triggers.push_back(trigger);
-                }
-            }
-
             auto level_entity = level.get_entity(i);
             auto containing_room = room(level_entity.Room);
-            auto entity = entity_source(level, level_entity, i, relevant_triggers, model_storage, shared_from_this(), containing_room);
+            auto entity = entity_source(level, level_entity, i, triggers_for_item(i), model_storage, shared_from_this(), containing_room);
             if (auto room = containing_room.lock())
             {
                 room->add_entity(entity);
@@ -679,47 +851,12 @@ namespace trview
         _neighbours.clear();
         if (auto selected_room = _selected_room.lock())
         {
-            generate_neighbours(_neighbours, static_cast<uint16_t>(selected_room->number()), _neighbour_depth);
+            const auto neighbours = _room_graph.rooms_within(static_cast<uint16_t>(selected_room->number()), _neighbour_depth);
+            _neighbours.assign(neighbours.begin(), neighbours.end());
             _regenerate_transparency = true;
         }
     }
 
-    void Level::generate_neighbours(std::set<uint16_t>& results, uint16_t selected_room, int32_t max_depth)
-    {
-        results.insert(selected_room);
-
-        std::set<uint16_t> current_batch{ selected_room };
-        std::set<uint16_t> next_batch;
-
-        for (int32_t depth = 0; depth <= max_depth && !current_batch.empty(); ++depth)
-        {
-            for (uint16_t room : current_batch)
-            {
-                // Add the room to the final list of rooms.
-                results.insert(room);
-
-                // Get the neighbours of the room and add them to the next batch to be processed.
-                const auto neighbours = _rooms[room]->neighbours();
-                next_batch.insert(neighbours.begin(), neighbours.end());
-            }
-
-            // Remove all entries from the current batch as they have been processed.
-            current_batch.clear();
-
-            // Add any entries that aren't already in the results to the list to be processed.
-            for (uint16_t room : next_batch)
-            {
-                if (results.find(room) == results.end())
-                {
-                    current_batch.insert(room);
-                }
-            }
-
-            // Clear the next batch.
-            next_batch.clear();
-        }
-    }
-
     // Determine whether the specified ray hits any of the triangles in any of the room geometry.
     // position: The world space position of the source of the ray.
     // direction: The direction of the ray.
@@ -728,45 +865,60 @@ namespace trview
     // is also specified.
     PickResult Level::pick(const ICamera& camera, const Vector3& position, const Vector3& direction) const
     {
-        std::vector<PickResult> results;
-        for (auto& room : get_rooms_to_render(camera))
+        return pick_scene()->pick(position, direction, camera.frustum());
+    }
+
+    std::shared_ptr<const PickScene> Level::pick_scene() const
+    {
+        auto key = pick_scene_key();
+        if (_pick_scene && _pick_scene_key == key)
+        {
+            return _pick_scene;
+        }
+
+        const auto room_filters =
+            filter_flag(PickFilter::Geometry, has_flag(_render_filters, RenderFilter::Rooms)) |
+            filter_flag(PickFilter::Entities, has_flag(_render_filters, RenderFilter::Entities)) |
+            filter_flag(PickFilter::StaticMeshes, has_flag(_render_filters, RenderFilter::Rooms)) |
+            filter_flag(PickFilter::AllGeometry, has_flag(_render_filters, RenderFilter::AllGeometry)) |
+            filter_flag(PickFilter::Triggers, has_flag(_render_filters, RenderFilter::Triggers)) |
+            filter_flag(PickFilter::Lights, has_flag(_render_filters, RenderFilter::Lights)) |
+            filter_flag(PickFilter::CameraSinks, has_flag(_render_filters, RenderFilter::CameraSinks)) |
+            filter_flag(PickFilter::NgPlus, has_flag(_render_filters, RenderFilter::NgPlus));
+
+        std::vector<PickTarget> targets;
+        _room_pick_targets.resize(_rooms.size());
+        for (std::size_t i = 0; i < _rooms.size(); ++i)
         {
-            for (const auto& result : room.room.pick(position, direction,
-                filter_flag(PickFilter::Geometry, has_flag(_render_filters, RenderFilter::Rooms)) |
-                filter_flag(PickFilter::Entities, has_flag(_render_filters, RenderFilter::Entities)) |
-                filter_flag(PickFilter::StaticMeshes, has_flag(_render_filters, RenderFilter::Rooms)) |
-                filter_flag(PickFilter::AllGeometry, has_flag(_render_filters, RenderFilter::AllGeometry)) |
-                filter_flag(PickFilter::Triggers, has_flag(_render_filters, RenderFilter::Triggers)) |
-                filter_flag(PickFilter::Lights, has_flag(_render_filters, RenderFilter::Lights)) |
-                filter_flag(PickFilter::CameraSinks, has_flag(_render_filters, RenderFilter::CameraSinks)) |
-                filter_flag(PickFilter::NgPlus, has_flag(_render_filters, RenderFilter::NgPlus))))
+            const auto& room = _rooms[i];
+            if (!_room_uploaded[i] || !room->visible() || is_alternate_mismatch(*room) ||
+                (key.neighbours_only && std::ranges::find(key.neighbours, static_cast<uint16_t>(i)) == key.neighbours.end()))
             {
-                results.push_back(result);
+                continue;
             }
 
-            if (!is_alternate_mismatch(room.room) && room.room.alternate_mode() == IRoom::AlternateMode::IsAlternate)
+            // Rooms keep their targets until their contents change, so a room being uploaded doesn't mean
+            // every other room has to make its targets again.
+            auto& cached = _room_pick_targets[i];
+            if (!cached || cached->version != _pick_content_version || cached->filters != room_filters)
             {
-                const auto& original_room = _rooms[room.room.alternate_room()];
-                for (const auto& result : original_room->pick(position, direction, PickFilter::Entities))
+                cached = RoomPickTargets{ .version = _pick_content_version, .filters = room_filters, .targets = room->pick_targets(room_filters) };
+                if (room->alternate_mode() == IRoom::AlternateMode::IsAlternate && _room_uploaded[room->alternate_room()])
                 {
-                    results.push_back(result);
+                    const auto& original_room = _rooms[room->alternate_room()];
+                    std::ranges::move(original_room->pick_targets(PickFilter::Entities), std::back_inserter(cached->targets));
                 }
             }
+            targets.insert(targets.end(), cached->targets.begin(), cached->targets.end());
         }
 
         if (has_flag(_render_filters, RenderFilter::SoundSources))
         {
             for (const auto& sound_source : _sound_sources)
             {
-                if (!sound_source->visible())
-                {
-                    continue;
-                }
-
-                auto sound_source_result = sound_source->pick(position, direction);
-                if (sound_source_result.hit)
+                if (sound_source->visible())
                 {
-                    results.push_back(sound_source_result);
+                    targets.push_back(sound_source->pick_target());
                 }
             }
         }
@@ -775,65 +927,56 @@ namespace trview
         {
             for (const auto& flyby : _flybys)
             {
-                if (!flyby->visible())
-                {
-                    continue;
-                }
-
-                auto flyby_result = flyby->pick(position, direction);
-                if (flyby_result.hit)
+                if (flyby->visible())
                 {
-                    results.push_back(flyby_result);
+                    targets.push_back(flyby->pick_target());
                 }
             }
         }
 
-
-        uint32_t index = 0;
         for (const auto& scriptable : _scriptables)
         {
             if (const auto scriptable_ptr = scriptable.lock())
             {
-                PickResult result{};
-                BoundingBox cube(scriptable_ptr->position(), Vector3(0.125f, 0.125f, 0.125f));
-
-                float distance = 0;
-                if (cube.Intersects(position, direction, distance))
-                {
-                    result.distance = distance;
-                    result.hit = true;
-                    result.position = position + direction * distance;
-                    result.type = PickResult::Type::Scriptable;
-                    result.scriptable = scriptable;
-                    results.push_back(result);
-                }
+                const BoundingBox cube(scriptable_ptr->position(), Vector3(0.125f, 0.125f, 0.125f));
+                targets.push_back(
+                    {
+                        .bounds = cube,
+                        .test = [cube, scriptable](const Vector3& position, const Vector3& direction)
+                            {
+                                PickResult result{};
+                                float distance = 0;
+                                if (cube.Intersects(position, direction, distance))
+                                {
+                                    result.distance = distance;
+                                    result.hit = true;
+                                    result.position = position + direction * distance;
+                                    result.type = PickResult::Type::Scriptable;
+                                    result.scriptable = scriptable;
+                                }
+                                return result;
+                            }
+                    });
             }
-
-            ++index;
         }
 
-        std::sort(results.begin(), results.end(), [](const auto& l, const auto& r) { return l.distance < r.distance; });
-
-        std::optional<PickResult> actual_result;
-        if (!results.empty())
-        {
-            actual_result = results.front();
-        }
+        _pick_scene = std::make_shared<const PickScene>(std::move(targets));
+        _pick_scene_key = std::move(key);
+        return _pick_scene;
+    }
 
-        for (const auto& result : results)
+    Level::PickSceneKey Level::pick_scene_key() const
+    {
+        const bool neighbours_only = highlight_mode_enabled(RoomHighlightMode::Neighbours);
+        return
         {
-            if (result.type == PickResult::Type::Room)
-            {
-                return actual_result.value_or(result);
-            }
-
-            if (result.type == PickResult::Type::Entity)
-            {
-                actual_result = result;
-            }
-        }
-
-        return actual_result.value_or(PickResult {});
+            .version = _pick_version,
+            .filters = _render_filters,
+            .alternate_mode = _alternate_mode,
+            .alternate_groups = _alternate_groups,
+            .neighbours_only = neighbours_only,
+            .neighbours = neighbours_only ? _neighbours : std::vector<uint16_t>{}
+        };
     }
 
     // Determines whether the room is currently being rendered.
@@ -845,7 +988,8 @@ namespace trview
         {
             return true;
         }
-        return _neighbours.find(static_cast<uint16_t>(room)) != _neighbours.end();
+        const auto selected_room = _selected_room.lock();
+        return selected_room && _room_graph.distance(static_cast<uint16_t>(selected_room->number()), static_cast<uint16_t>(room)) <= _neighbour_depth;
     }
 
     void Level::on_camera_moved()
@@ -935,7 +1079,7 @@ namespace trview
     {
         return std::any_of(_rooms.begin(), _rooms.end(), [](const std::shared_ptr<IRoom>& room)
         {
-            return room->alternate_mode() != IRoom::AlternateMode::None;
+            return room && room->alternate_mode() != IRoom::AlternateMode::None;
         });
     }
 
@@ -1067,7 +1211,7 @@ namespace trview
         for (auto i = 0u; i < _rooms.size(); ++i)
         {
             const auto& room = _rooms[i];
-            if (room->alternate_mode() != IRoom::AlternateMode::None)
+            if (room && room->alternate_mode() != IRoom::AlternateMode::None)
             {
                 groups.insert(room->alternate_group());
             }
@@ -1130,7 +1274,7 @@ namespace trview
         }
     }
 
-    std::vector<uint16_t> Level::floor_data() const
+    std::shared_ptr<const LevelFloordata> Level::floor_data() const
     {
         return _floor_data;
     }
@@ -1140,7 +1284,7 @@ namespace trview
         const auto num_rooms = level.num_rooms();
         for (uint32_t i = 0u; i < num_rooms; ++i)
         {
-            auto room = level.get_room(i);
+            const auto& room = level.get_room(i);
             for (const auto& light : room.lights)
             {
                 _lights.push_back(light_source(static_cast<uint32_t>(_lights.size()), _rooms[i], light, shared_from_this()));
@@ -1196,18 +1340,51 @@ namespace trview
             all_data.push_back(data);
         }
 
+        // Index every triangle in the level once so that each room only has to look up its own triangles rather than
+        // compare against every triangle in each neighbour.
+        struct TriangleRef
+        {
+            uint32_t room;
+            uint32_t index;
+        };
+
+        std::unordered_map<TriangleKey, std::vector<TriangleRef>, TriangleKeyHash> index;
+        for (auto r = 0u; r < all_data.size(); ++r)
+        {
+            const auto& triangles = all_data[r].room_triangles;
+            for (auto t = 0u; t < triangles.size(); ++t)
+            {
+                index[TriangleKey(triangles[t])].push_back({ r, t });
+            }
+        }
+
+        // Visit rooms and neighbours in the same order as a pairwise comparison would so that a triangle shared by
+        // more than two rooms resolves to the same room.
+        std::vector<std::vector<TriangleRef>*> buckets;
         for (auto r = 0u; r < _rooms.size(); ++r)
         {
+            auto& data = all_data[r];
+            buckets.resize(data.room_triangles.size());
+            for (auto t = 0u; t < data.room_triangles.size(); ++t)
+            {
+                buckets[t] = &index.find(TriangleKey(data.room_triangles[t]))->second;
+            }
+
             for (const auto& neighbour : _rooms[r]->neighbours())
             {
-                for (auto t = 0u; t < all_data[r].room_triangles.size(); ++t)
+                if (neighbour >= all_data.size())
+                {
+                    continue;
+                }
+
+                for (auto t = 0u; t < data.room_triangles.size(); ++t)
                 {
-                    for (auto t2 = 0u; t2 < all_data[neighbour].room_triangles.size(); ++t2)
+                    for (const auto& candidate : *buckets[t])
                     {
-                        if (all_data[r].room_triangles[t] == all_data[neighbour].room_triangles[t2])
+                        if (candidate.room == neighbour && data.room_triangles[t] == all_data[neighbour].room_triangles[candidate.index])
                         {
-                            all_data[r].triangle_rooms[t] = neighbour;
-                            all_data[neighbour].triangle_rooms[t2] = r;
+                            data.triangle_rooms[t] = neighbour;
+                            all_data[neighbour].triangle_rooms[candidate.index] = r;
                         }
                     }
                 }
@@ -1361,6 +1538,7 @@ namespace trview
             _token_store += new_flyby->on_changed += [this]() { content_changed(); };
             _flybys.push_back(new_flyby);
         }
+        ++_pick_version;
     }
 
     void Level::set_show_camera_sinks(bool show)
@@ -1398,27 +1576,155 @@ namespace trview
         const trlevel::ILevel::LoadCallbacks callbacks)
     {
         _platform_and_version = level->platform_and_version();
-        _floor_data = level->get_floor_data_all();
+        _floor_data = std::make_shared<const LevelFloordata>(*level);
         _name = level->name();
         _ng = level->trng();
         _pack = level->pack().lock();
         _model_storage = model_storage;
 
         record_models(*level);
+
+        _pending_load = std::make_unique<PendingLoad>(PendingLoad
+            {
+                .level = level,
+                .mesh_storage = mesh_storage,
+                .entity_source = entity_source,
+                .ai_source = ai_source,
+                .trigger_source = trigger_source,
+                .light_source = light_source,
+                .camera_sink_source = camera_sink_source,
+                .sound_source_source = sound_source_source,
+                .flyby_source = flyby_source,
+                .room_source = room_source,
+                .callbacks = callbacks
+            });
+
         callbacks.on_progress("Generating rooms");
-        generate_rooms(*level, room_source, *mesh_storage);
-        callbacks.on_progress("Generating triggers");
-        generate_triggers(trigger_source);
+        order_rooms(*level, callbacks.progressive);
+
+        if (callbacks.progressive)
+        {
+            // Only the rooms around Lara are built before returning, the rest of the level is finished by calls to continue_load.
+            upload_rooms(_room_graph.rooms_within(_start_room, 1).size());
+            complete_stage(LoadStage::StartRooms);
+            return;
+        }
+
+        upload_rooms(_upload_order.size());
+        finish_load();
+        callbacks.on_progress("Done");
+    }
+
+    ILevel::LoadStage Level::load_stage() const
+    {
+        return _load_stage;
+    }
+
+    void Level::continue_load()
+    {
+        if (!_pending_load)
+        {
+            return;
+        }
+
+        const auto& callbacks = _pending_load->callbacks;
+        switch (_load_stage)
+        {
+            case LoadStage::StartRooms:
+            {
+                // Rooms are built and uploaded a few at a time so that a progressive load can keep rendering in between.
+                const std::size_t rooms_per_step = 8;
+                upload_rooms(rooms_per_step);
+                if (_pending_load->next_upload >= _upload_order.size())
+                {
+                    complete_stage(LoadStage::Rooms);
+                }
+                break;
+            }
+            case LoadStage::Rooms:
+            {
+                callbacks.on_progress("Generating triggers");
+                generate_triggers(_pending_load->trigger_source);
+                complete_stage(LoadStage::Triggers);
+                break;
+            }
+            case LoadStage::Triggers:
+            {
+                generate_items();
+                complete_stage(LoadStage::Items);
+                break;
+            }
+            case LoadStage::Items:
+            {
+                callbacks.on_progress("Generating sector triangles");
+                generate_sector_triangles();
+                // Rooms may have built their all geometry meshes before the sector triangles existed.
+                on_geometry_colours_changed();
+                _pending_load.reset();
+                complete_stage(LoadStage::Complete);
+                break;
+            }
+        }
+    }
+
+    void Level::finish_load()
+    {
+        while (_pending_load)
+        {
+            continue_load();
+        }
+    }
+
+    void Level::complete_stage(LoadStage stage)
+    {
+        _load_stage = stage;
+        content_changed();
+        on_load_stage(stage);
+    }
+
+    void Level::upload_rooms(std::size_t count)
+    {
+        const auto& level = *_pending_load->level;
+        Activity upload_activity(_log, "Level", _name);
+        const auto end = std::min(_pending_load->next_upload + count, _upload_order.size());
+        const bool last_rooms = _pending_load->next_upload < end && end == _upload_order.size();
+        build_rooms(std::span(_upload_order).subspan(_pending_load->next_upload, end - _pending_load->next_upload));
+        for (; _pending_load->next_upload < end; ++_pending_load->next_upload)
+        {
+            const auto i = _upload_order[_pending_load->next_upload];
+            Activity room_activity(upload_activity, std::format("Room {}", i));
+            const auto& room = _rooms[i];
+            room->upload(level, *_pending_load->mesh_storage, room_activity);
+            _token_store += room->on_changed += [this]() { content_changed(); };
+            _room_uploaded[i] = true;
+        }
+
+        // Alternate rooms are only known once every room has been built. Finishing the rooms stage changes the
+        // content, so the pick targets of the alternate rooms are made again after this.
+        if (last_rooms)
+        {
+            link_rooms();
+        }
+
+        // The whole batch is picked from one new scene rather than one scene per room.
+        ++_pick_version;
+    }
+
+    void Level::generate_items()
+    {
+        const auto& level = *_pending_load->level;
+        const auto& callbacks = _pending_load->callbacks;
+
         callbacks.on_progress("Generating entities");
-        generate_entities(*level, entity_source, ai_source, *model_storage);
+        generate_entities(level, _pending_load->entity_source, _pending_load->ai_source, *_model_storage);
         callbacks.on_progress("Generating lights");
-        generate_lights(*level, light_source);
+        generate_lights(level, _pending_load->light_source);
         callbacks.on_progress("Generating camera/sinks");
-        generate_camera_sinks(*level, camera_sink_source);
+        generate_camera_sinks(level, _pending_load->camera_sink_source);
         callbacks.on_progress("Generating flyby cameras");
-        generate_flybys(*level, flyby_source);
+        generate_flybys(level, _pending_load->flyby_source);
         callbacks.on_progress("Generating sound sources");
-        generate_sound_sources(*level, sound_source_source);
+        generate_sound_sources(level, _pending_load->sound_source_source);
 
         callbacks.on_progress("Generating room bounding boxes");
         for (auto& room : _rooms)
@@ -1432,7 +1738,7 @@ namespace trview
         record_static_meshes();
 
         callbacks.on_progress("Generating NG+ items");
-        const auto swapset = _ngplus_switcher->create_for_level(shared_from_this(), *level, *model_storage);
+        const auto swapset = _ngplus_switcher->create_for_level(shared_from_this(), level, *_model_storage);
         for (const auto& [key, value] : swapset)
         {
             if (key > _entities.size())
@@ -1451,8 +1757,6 @@ namespace trview
                 _entities.push_back(value);
             }
         }
-
-        callbacks.on_progress("Done");
     }
 
     void Level::record_static_meshes()
@@ -1484,6 +1788,8 @@ namespace trview
     void Level::content_changed()
     {
         _regenerate_transparency = true;
+        ++_pick_version;
+        ++_pick_content_version;
         on_level_changed();
     }
 
@@ -1496,9 +1802,15 @@ namespace trview
         return _static_meshes[index];
     }
 
+    std::weak_ptr<IRoom> Level::start_room() const
+    {
+        return room(_start_room);
+    }
+
     void Level::add_scriptable(const std::weak_ptr<IScriptable>& scriptable)
     {
         _scriptables.push_back(scriptable);
+        ++_pick_version;
         if (auto scriptable_ptr = scriptable.lock())
         {
             _token_store += scriptable_ptr->on_changed += [this]() { content_changed(); };
@@ -1535,6 +1847,7 @@ namespace trview
             _token_store += sound_source->on_changed += [this]() { content_changed(); };
             _sound_sources.push_back(sound_source);
         }
+        ++_pick_version;
     }
 
     void Level::set_show_sound_sources(bool show)
@@ -4,10 +4,15 @@
 #include <wrl/client.h>
 #include <d3d11.h>
 #include <vector>
+#include <map>
 #include <set>
+#include <functional>
+#include <optional>
+#include <span>
 
 #include <trlevel/ILevel.h>
 #include "ILevel.h"
+#include "RoomGraph.h"
 #include "../Geometry/ITransparencyBuffer.h"
 #include "../Graphics/ISelectionRenderer.h"
 #include "../Graphics/IMeshStorage.h"
@@ -45,6 +50,9 @@ namespace trview
             std::shared_ptr<INgPlusSwitcher> ngplus_switcher);
         virtual ~Level() = default;
         virtual std::vector<graphics::Texture> level_textures() const override;
+        LoadStage load_stage() const override;
+        void continue_load() override;
+        void finish_load() override;
         virtual std::optional<uint32_t> selected_item() const override;
         std::weak_ptr<IRoom> selected_room() const override;
         virtual std::weak_ptr<IItem> item(uint32_t index) const override;
@@ -55,7 +63,9 @@ namespace trview
         virtual std::vector<std::weak_ptr<IRoom>> rooms() const override;
         virtual std::weak_ptr<ITrigger> trigger(uint32_t index) const override;
         virtual std::vector<std::weak_ptr<ITrigger>> triggers() const override;
+        std::vector<std::weak_ptr<ITrigger>> triggers_for_item(uint32_t index) const override;
         virtual PickResult pick(const ICamera& camera, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        virtual std::shared_ptr<const PickScene> pick_scene() const override;
         virtual trlevel::Platform platform() const override;
         virtual void render(const ICamera& camera, bool render_selection) override;
         virtual void render_transparency(const ICamera& camera) override;
@@ -95,7 +105,7 @@ namespace trview
         virtual trlevel::LevelVersion version() const override;
         virtual std::string filename() const override;
         virtual void set_filename(const std::string& filename) override;
-        virtual std::vector<uint16_t> floor_data() const override;
+        virtual std::shared_ptr<const LevelFloordata> floor_data() const override;
         virtual std::weak_ptr<ILight> light(uint32_t index) const override;
         virtual std::vector<std::weak_ptr<ILight>> lights() const override;
         virtual MapColours map_colours() const override;
@@ -123,6 +133,7 @@ namespace trview
             const trlevel::ILevel::LoadCallbacks callbacks);
         std::vector<std::weak_ptr<IStaticMesh>> static_meshes() const override;
         std::weak_ptr<IStaticMesh> static_mesh(uint32_t index) const override;
+        std::weak_ptr<IRoom> start_room() const override;
         void add_scriptable(const std::weak_ptr<IScriptable>& scriptable) override;
         std::weak_ptr<ISoundStorage> sound_storage() const override;
         std::vector<std::weak_ptr<ISoundSource>> sound_sources() const override;
@@ -135,11 +146,28 @@ namespace trview
         trlevel::PlatformAndVersion platform_and_version() const override;
         std::vector<std::weak_ptr<IFlyby>> flybys() const override;
     private:
-        void generate_rooms(const trlevel::ILevel& level, const IRoom::Source& room_source, const IMeshStorage& mesh_storage);
+        /// <summary>
+        /// Work out where Lara starts and the order to build and upload the rooms in, without building any rooms.
+        /// </summary>
+        void order_rooms(const trlevel::ILevel& level, bool progressive);
+        /// <summary>
+        /// Build the rooms that haven't been built yet.
+        /// </summary>
+        /// <param name="indices">The rooms to build.</param>
+        void build_rooms(std::span<const uint16_t> indices);
+        /// <summary>
+        /// Build and upload the next rooms in the upload order. The room graph and alternate rooms are set up once every
+        /// room has been uploaded.
+        /// </summary>
+        /// <param name="count">The maximum number of rooms to upload.</param>
+        void upload_rooms(std::size_t count);
+        void link_rooms();
         void generate_triggers(const ITrigger::Source& trigger_source);
+        void generate_items();
+        void generate_sector_triangles();
+        void complete_stage(LoadStage stage);
         void generate_entities(const trlevel::ILevel& level, const IItem::EntitySource& entity_source, const IItem::AiSource& ai_source, const IModelStorage& model_storage);
         void regenerate_neighbours();
-        void generate_neighbours(std::set<uint16_t>& results, uint16_t selected_room, int32_t max_depth);
         void generate_lights(const trlevel::ILevel& level, const ILight::Source& light_source);
         void generate_camera_sinks(const trlevel::ILevel& level, const ICameraSink::Source& camera_sink_source);
         void generate_sound_sources(const trlevel::ILevel& level, const ISoundSource::Source& sound_source_source);
@@ -168,6 +196,36 @@ namespace trview
         // Returns: The rooms to render and their selection mode.
         std::vector<RoomToRender> get_rooms_to_render(const ICamera& camera) const;
 
+        // Create a test for whether a room is inside the view of the camera.
+        std::function<bool(const IRoom&)> room_in_view(const ICamera& camera) const;
+
+        /// <summary>
+        /// What the cached pick scene was built from. The scene is built again when any of this changes.
+        /// </summary>
+        struct PickSceneKey
+        {
+            uint64_t version{ 0 };
+            RenderFilter filters{ RenderFilter::None };
+            bool alternate_mode{ false };
+            std::set<uint32_t> alternate_groups;
+            bool neighbours_only{ false };
+            std::vector<uint16_t> neighbours;
+
+            bool operator==(const PickSceneKey&) const = default;
+        };
+
+        PickSceneKey pick_scene_key() const;
+
+        /// <summary>
+        /// The pick targets made for one room, kept until the level content changes.
+        /// </summary>
+        struct RoomPickTargets
+        {
+            uint64_t version{ 0 };
+            PickFilter filters{ PickFilter::None };
+            std::vector<PickTarget> targets;
+        };
+
         // Determines whether the room is currently being rendered.
         // room: The room index.
         // Returns: True if the room is visible.
@@ -187,6 +245,7 @@ namespace trview
         std::shared_ptr<graphics::IDevice> _device;
         std::vector<std::shared_ptr<IRoom>>   _rooms;
         std::vector<std::shared_ptr<ITrigger>> _triggers;
+        std::multimap<uint32_t, std::weak_ptr<ITrigger>> _item_triggers;
         std::vector<std::shared_ptr<IItem>> _entities;
         std::vector<std::shared_ptr<ILight>> _lights;
         std::vector<std::shared_ptr<ICameraSink>> _camera_sinks;
@@ -208,7 +267,9 @@ namespace trview
         std::weak_ptr<ICameraSink> _selected_camera_sink;
         std::weak_ptr<IFlybyNode> _selected_flyby_node;
         uint32_t           _neighbour_depth{ 1 };
-        std::set<uint16_t> _neighbours;
+        RoomGraph _room_graph;
+        /// Copied out of the room graph, which is replaced when the rooms are linked.
+        std::vector<uint16_t> _neighbours;
 
         std::shared_ptr<ILevelTextureStorage> _texture_storage;
         std::unique_ptr<ITransparencyBuffer> _transparency;
@@ -224,7 +285,7 @@ namespace trview
         std::set<uint32_t> _alternate_groups;
         std::string _filename;
         std::shared_ptr<ILog> _log;
-        std::vector<uint16_t> _floor_data;
+        std::shared_ptr<const LevelFloordata> _floor_data;
         std::set<uint32_t> _models;
         TokenStore _token_store;
         std::string _name;
@@ -239,6 +300,41 @@ namespace trview
         std::shared_ptr<trlevel::IPack> _pack;
         trlevel::PlatformAndVersion _platform_and_version;
         std::shared_ptr<IModelStorage> _model_storage;
+
+        /// <summary>
+        /// Everything needed to finish a load after initialise has returned.
+        /// </summary>
+        struct PendingLoad
+        {
+            std::shared_ptr<trlevel::ILevel> level;
+            std::shared_ptr<IMeshStorage> mesh_storage;
+            IItem::EntitySource entity_source;
+            IItem::AiSource ai_source;
+            ITrigger::Source trigger_source;
+            ILight::Source light_source;
+            ICameraSink::Source camera_sink_source;
+            ISoundSource::Source sound_source_source;
+            IFlyby::Source flyby_source;
+            IRoom::Source room_source;
+            trlevel::ILevel::LoadCallbacks callbacks;
+            std::size_t next_upload{ 0 };
+            /// <summary>
+            /// Where the sector numbers of each room start, as sectors are numbered through the rooms in order.
+            /// </summary>
+            std::vector<uint32_t> sector_base_indices;
+        };
+
+        std::unique_ptr<PendingLoad> _pending_load;
+        LoadStage _load_stage{ LoadStage::StartRooms };
+        uint16_t _start_room{ 0 };
+        std::vector<uint16_t> _upload_order;
+        std::vector<bool> _room_uploaded;
+
+        uint64_t _pick_version{ 0 };
+        uint64_t _pick_content_version{ 0 };
+        mutable std::vector<std::optional<RoomPickTargets>> _room_pick_targets;
+        mutable std::optional<PickSceneKey> _pick_scene_key;
+        mutable std::shared_ptr<const PickScene> _pick_scene;
     };
 
     /// Find the first item with the type id specified.
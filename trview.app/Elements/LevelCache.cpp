@@ -0,0 +1,285 @@
+#include "LevelCache.h"
+
+#include <cstring>
+#include <ranges>
+#include <span>
+
+namespace trview
+{
+    namespace
+    {
+        // 'TRVC'
+        constexpr uint32_t Magic = 0x43565254;
+        constexpr uint64_t FnvOffsetBasis = 14695981039346656037ull;
+        constexpr uint64_t FnvPrime = 1099511628211ull;
+
+        uint64_t hash(std::span<const uint8_t> bytes, uint64_t value)
+        {
+            for (const auto byte : bytes)
+            {
+                value ^= byte;
+                value *= FnvPrime;
+            }
+            return value;
+        }
+
+        // Everything in the file is a multiple of four bytes, so arrays in the mapped data stay aligned and can be
+        // copied out of it in one go.
+        template <typename T>
+        concept CacheValue = std::is_trivially_copyable_v<T> && sizeof(T) % 4 == 0;
+
+        template <CacheValue T>
+        void write(std::vector<uint8_t>& output, const T& value)
+        {
+            const auto bytes = reinterpret_cast<const uint8_t*>(&value);
+            output.insert(output.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <CacheValue T>
+        void write(std::vector<uint8_t>& output, const std::vector<T>& values)
+        {
+            write(output, static_cast<uint32_t>(values.size()));
+            const auto bytes = reinterpret_cast<const uint8_t*>(values.data());
+            output.insert(output.end(), bytes, bytes + values.size() * sizeof(T));
+        }
+
+        class Reader final
+        {
+        public:
+            explicit Reader(std::span<const uint8_t> data)
+                : _data(data)
+            {
+            }
+
+            template <CacheValue T>
+            std::optional<T> read()
+            {
+                if (_data.size() - _offset < sizeof(T))
+                {
+                    return std::nullopt;
+                }
+
+                T value;
+                std::memcpy(&value, _data.data() + _offset, sizeof(T));
+                _offset += sizeof(T);
+                return value;
+            }
+
+            template <CacheValue T>
+            bool read(std::vector<T>& values)
+            {
+                const auto count = read<uint32_t>();
+                if (!count || count.value() > (_data.size() - _offset) / sizeof(T))
+                {
+                    return false;
+                }
+
+                const auto begin = reinterpret_cast<const T*>(_data.data() + _offset);
+                values.assign(begin, begin + count.value());
+                _offset += count.value() * sizeof(T);
+                return true;
+            }
+
+            bool at_end() const
+            {
+                return _offset == _data.size();
+            }
+        private:
+            std::span<const uint8_t> _data;
+            std::size_t _offset{ 0 };
+        };
+
+        struct Entry
+        {
+            uint64_t content_hash;
+            std::vector<RoomGeometry> rooms;
+        };
+
+        std::optional<Entry> read_entry(std::span<const uint8_t> data)
+        {
+            Reader reader(data);
+            const auto magic = reader.read<uint32_t>();
+            const auto format_version = reader.read<uint32_t>();
+            const auto content_hash = reader.read<uint64_t>();
+            const auto num_rooms = reader.read<uint32_t>();
+            if (magic != Magic || format_version != LevelCache::FormatVersion || !content_hash || !num_rooms)
+            {
+                return std::nullopt;
+            }
+
+            Entry entry{ .content_hash = content_hash.value(), .rooms = std::vector<RoomGeometry>(num_rooms.value()) };
+            for (auto& room : entry.rooms)
+            {
+                if (!reader.read(room.vertices))
+                {
+                    return std::nullopt;
+                }
+
+                const auto num_groups = reader.read<uint32_t>();
+                if (!num_groups)
+                {
+                    return std::nullopt;
+                }
+
+                room.indices.resize(num_groups.value());
+                for (auto& group : room.indices)
+                {
+                    if (!reader.read(group))
+                    {
+                        return std::nullopt;
+                    }
+                }
+
+                if (!reader.read(room.transparent_triangles) || !reader.read(room.collision_triangles))
+                {
+                    return std::nullopt;
+                }
+            }
+
+            if (!reader.at_end())
+            {
+                return std::nullopt;
+            }
+            return entry;
+        }
+    }
+
+    ILevelCache::~ILevelCache()
+    {
+    }
+
+    LevelCache::LevelCache(const std::shared_ptr<IFiles>& files, const std::string& version)
+        : _files(files), _directory(files->appdata_directory() + "\\trview\\cache"), _version(version)
+    {
+    }
+
+    std::optional<std::string> LevelCache::key(const std::string& filename) const
+    {
+        if (!_enabled)
+        {
+            return std::nullopt;
+        }
+
+        // Only the file details are used so that a level that has never been cached isn't read just to make the key.
+        // The content hash stored in the entry confirms that the level hasn't changed.
+        const auto info = _files->file_info(filename);
+        if (!info)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t value = hash({ reinterpret_cast<const uint8_t*>(_version.data()), _version.size() }, FnvOffsetBasis);
+        value = hash({ reinterpret_cast<const uint8_t*>(filename.data()), filename.size() }, value);
+        value = hash({ reinterpret_cast<const uint8_t*>(&info->size), sizeof(info->size) }, value);
+        value = hash({ reinterpret_cast<const uint8_t*>(&info->last_write_time), sizeof(info->last_write_time) }, value);
+        return std::format("{:016x}", value);
+    }
+
+    std::optional<std::vector<RoomGeometry>> LevelCache::load(const std::string& key, const std::string& filename) const
+    {
+        if (!_enabled)
+        {
+            return std::nullopt;
+        }
+
+        const auto entry_filename = path(key);
+        std::optional<Entry> entry;
+        {
+            const auto file = _files->map_file(entry_filename);
+            if (!file)
+            {
+                return std::nullopt;
+            }
+            entry = read_entry(file->data());
+        }
+
+        // The file has to be unmapped before an unreadable or outdated entry can be removed. Entries that are used are
+        // marked as written now so that trimming removes the least recently used entries first.
+        if (!entry || entry->content_hash != content_hash(filename))
+        {
+            _files->delete_file(entry_filename);
+            return std::nullopt;
+        }
+
+        _files->touch_file(entry_filename);
+        return std::move(entry->rooms);
+    }
+
+    void LevelCache::save(const std::string& key, const std::string& filename, const std::vector<RoomGeometry>& rooms)
+    {
+        if (!_enabled)
+        {
+            return;
+        }
+
+        const auto level_hash = content_hash(filename);
+        if (!level_hash)
+        {
+            return;
+        }
+
+        std::vector<uint8_t> output;
+        write(output, Magic);
+        write(output, FormatVersion);
+        write(output, level_hash.value());
+        write(output, static_cast<uint32_t>(rooms.size()));
+        for (const auto& room : rooms)
+        {
+            write(output, room.vertices);
+            write(output, static_cast<uint32_t>(room.indices.size()));
+            for (const auto& group : room.indices)
+            {
+                write(output, group);
+            }
+            write(output, room.transparent_triangles);
+            write(output, room.collision_triangles);
+        }
+
+        _files->create_directory(_files->appdata_directory() + "\\trview");
+        _files->create_directory(_directory);
+        _files->save_file(path(key), output);
+        trim();
+    }
+
+    void LevelCache::set_settings(const UserSettings& settings)
+    {
+        _enabled = settings.level_cache;
+        _max_size = settings.level_cache_size;
+    }
+
+    std::string LevelCache::path(const std::string& key) const
+    {
+        return std::format("{}\\{}.trcache", _directory, key);
+    }
+
+    std::optional<uint64_t> LevelCache::content_hash(const std::string& filename) const
+    {
+        const auto file = _files->map_file(filename);
+        if (!file)
+        {
+            return std::nullopt;
+        }
+        return hash(file->data(), FnvOffsetBasis);
+    }
+
+    void LevelCache::trim() const
+    {
+        // Keep the most recently used entries that fit in the size limit.
+        auto files = _files->get_files(_directory, "\\*.trcache");
+        std::ranges::sort(files, std::greater{}, &IFiles::File::last_write_time);
+
+        const uint64_t max_size = static_cast<uint64_t>(_max_size) * 1024 * 1024;
+        uint64_t total_size = 0;
+        for (const auto& file : files)
+        {
+            if (total_size + file.size > max_size)
+            {
+                _files->delete_file(file.path);
+            }
+            else
+            {
+                total_size += file.size;
+            }
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <trview.common/IFiles.h>
+#include "ILevelCache.h"
+
+namespace trview
+{
+    /// <summary>
+    /// Level cache that keeps one file per level in the trview appdata directory.
+    ///
+    /// Entries are keyed by the path, size and last write time of the level file and the trview version, so that
+    /// finding an entry doesn't read the level. Each entry also stores a hash of the level contents, which is checked
+    /// before the entry is used, so a changed level or a different version of trview never reads an old entry.
+    /// Entries with a different format version, a different content hash or that can't be read are deleted when they
+    /// are found. Loading an entry marks it as recently used, so the entries that are removed when the cache is too
+    /// large are the ones that haven't been opened for longest.
+    ///
+    /// This is a room geometry cache only. The trlevel parse, texture conversion, sector triangles and the room graph
+    /// all still run on every open.
+    /// </summary>
+    class LevelCache final : public ILevelCache
+    {
+    public:
+        /// <summary>
+        /// Version of the cache file layout. Increase this when the layout or the contents of RoomGeometry change.
+        /// </summary>
+        static constexpr uint32_t FormatVersion = 2;
+
+        explicit LevelCache(const std::shared_ptr<IFiles>& files, const std::string& version);
+        virtual ~LevelCache() = default;
+        std::optional<std::string> key(const std::string& filename) const override;
+        std::optional<std::vector<RoomGeometry>> load(const std::string& key, const std::string& filename) const override;
+        void save(const std::string& key, const std::string& filename, const std::vector<RoomGeometry>& rooms) override;
+        void set_settings(const UserSettings& settings) override;
+    private:
+        std::string path(const std::string& key) const;
+        std::optional<uint64_t> content_hash(const std::string& filename) const;
+        void trim() const;
+
+        std::shared_ptr<IFiles> _files;
+        std::string _directory;
+        std::string _version;
+        // Settings are changed on the main thread while levels load on another thread.
+        std::atomic<bool> _enabled{ false };
+        std::atomic<uint32_t> _max_size{ 0 };
+    };
+}
@@ -0,0 +1,26 @@
+#include "LevelCacheWriter.h"
+
+namespace trview
+{
+    LevelCacheWriter::LevelCacheWriter(const std::shared_ptr<ILevelCache>& cache, const std::string& key, const std::string& filename, std::size_t num_rooms)
+        : _cache(cache), _key(key), _filename(filename), _rooms(num_rooms), _built(num_rooms, false), _remaining(num_rooms)
+    {
+    }
+
+    void LevelCacheWriter::add(uint32_t index, RoomGeometry geometry)
+    {
+        std::lock_guard lock(_mutex);
+        if (index >= _rooms.size() || _built[index])
+        {
+            return;
+        }
+
+        _rooms[index] = std::move(geometry);
+        _built[index] = true;
+        if (--_remaining == 0)
+        {
+            _cache->save(_key, _filename, _rooms);
+            _rooms = {};
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ILevelCache.h"
+
+namespace trview
+{
+    /// <summary>
+    /// Collects the geometry of each room as it is built and stores it in the level cache once every room has been built.
+    /// A progressive load builds most rooms after the level has been returned, so nothing is stored until the last room
+    /// is done and a partly built level never leaves an entry behind.
+    /// </summary>
+    class LevelCacheWriter final
+    {
+    public:
+        explicit LevelCacheWriter(const std::shared_ptr<ILevelCache>& cache, const std::string& key, const std::string& filename, std::size_t num_rooms);
+        /// <summary>
+        /// Record the geometry built for a room. Rooms can be added from more than one thread.
+        /// </summary>
+        /// <param name="index">The room number.</param>
+        /// <param name="geometry">The geometry generated for the room.</param>
+        void add(uint32_t index, RoomGeometry geometry);
+    private:
+        std::shared_ptr<ILevelCache> _cache;
+        std::string _key;
+        std::string _filename;
+        std::mutex _mutex;
+        std::vector<RoomGeometry> _rooms;
+        std::vector<bool> _built;
+        std::size_t _remaining;
+    };
+}
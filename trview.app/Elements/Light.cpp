@@ -122,20 +122,32 @@ namespace trview
 
     PickResult Light::pick(const Vector3& position, const Vector3& direction) const
     {
-        PickResult result;
-        BoundingSphere sphere(_position, 0.125f);
+        return pick_target().test(position, direction);
+    }
 
-        float distance = 0;
-        if (sphere.Intersects(position, direction, distance))
+    PickTarget Light::pick_target() const
+    {
+        const BoundingSphere sphere(_position, 0.125f);
+        BoundingBox bounds;
+        BoundingBox::CreateFromSphere(bounds, sphere);
+        return
         {
-            result.distance = distance;
-            result.hit = true;
-            result.light = std::const_pointer_cast<ILight>(shared_from_this());
-            result.position = position + direction * distance;
-            result.type = PickResult::Type::Light;
-        }
-
-        return result;
+            .bounds = bounds,
+            .test = [sphere, light = std::weak_ptr<ILight>(std::const_pointer_cast<ILight>(shared_from_this()))](const Vector3& position, const Vector3& direction)
+                {
+                    PickResult result;
+                    float distance = 0;
+                    if (sphere.Intersects(position, direction, distance))
+                    {
+                        result.distance = distance;
+                        result.hit = true;
+                        result.light = light;
+                        result.position = position + direction * distance;
+                        result.type = PickResult::Type::Light;
+                    }
+                    return result;
+                }
+        };
     }
 
     float Light::in() const
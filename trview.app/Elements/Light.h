@@ -22,6 +22,7 @@ namespace trview
         virtual DirectX::SimpleMath::Vector3 direction() const override;
         std::weak_ptr<ILevel> level() const override;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        virtual PickTarget pick_target() const override;
         void render(const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
         void render_direction(const ICamera& camera) override;
         virtual void get_transparent_triangles(ITransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
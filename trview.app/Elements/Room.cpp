@@ -32,6 +32,31 @@ namespace trview
             uint32_t z = info.z / 1024 + sector.z();
             return (x + z) % 2 ? Unmatched_Colour : Unmatched_Colour + Color(0, 0.05f, 0.05f);
         }
+
+        void add_centroid_to_pick(const IMesh& mesh, PickResult& geometry_result, const std::weak_ptr<IRoom>& room, const Matrix& room_offset, const Matrix& inverted_room_offset)
+        {
+            // Transform the position back in to world space. Also mark it as a room pick result.
+            geometry_result.type = PickResult::Type::Room;
+            geometry_result.room = room;
+            geometry_result.position = Vector3::Transform(geometry_result.position, room_offset);
+
+            const auto& tri = geometry_result.triangle;
+            if (tri.normal.y < 0)
+            {
+                Vector3 centroid = { std::floor(geometry_result.position.x) + 0.5f, geometry_result.position.y, std::floor(geometry_result.position.z) + 0.5f };
+                Vector3 ray_direction = { 0, -tri.normal.y, 0 };
+
+                centroid = Vector3::Transform(centroid, inverted_room_offset);
+                ray_direction.Normalize();
+                PickResult centroid_hit = mesh.pick(centroid - ray_direction * 0.5f, ray_direction);
+                geometry_result.centroid = centroid_hit.hit ? Vector3::Transform(centroid_hit.position, room_offset) : geometry_result.position;
+                geometry_result.triangle = centroid_hit.hit ? centroid_hit.triangle : geometry_result.triangle;
+            }
+            else
+            {
+                geometry_result.centroid = geometry_result.position;
+            }
+        }
     }
 
     IRoom::~IRoom()
@@ -67,21 +92,59 @@ namespace trview
 
         _room_offset = Matrix::CreateTranslation(room.info.x / trlevel::Scale_X, 0, room.info.z / trlevel::Scale_Z);
         _inverted_room_offset = _room_offset.Invert();
+    }
+
+    void Room::initialise(const trlevel::ILevel& level, const LevelFloordata& floordata, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage,
+        const IStaticMesh::MeshSource& static_mesh_mesh_source, const IStaticMesh::PositionSource& static_mesh_position_source,
+        const ISector::Source& sector_source, uint32_t sector_base_index, const Activity& activity)
+    {
+        build(level, floordata, room, static_mesh_mesh_source, static_mesh_position_source, sector_source, sector_base_index, std::nullopt);
+        upload(level, room, mesh_storage, activity);
+    }
 
+    void Room::build(const trlevel::ILevel& level, const LevelFloordata& floordata, const trlevel::tr3_room& room,
+        const IStaticMesh::MeshSource& static_mesh_mesh_source, const IStaticMesh::PositionSource& static_mesh_position_source,
+        const ISector::Source& sector_source, uint32_t sector_base_index, std::optional<RoomGeometry> geometry)
+    {
+        _static_mesh_mesh_source = static_mesh_mesh_source;
+        _static_mesh_position_source = static_mesh_position_source;
+        generate_sectors(level, floordata, room, sector_source, sector_base_index);
+        if (geometry)
+        {
+            _pending_geometry = std::move(geometry.value());
+        }
+        else
+        {
+            generate_geometry(room);
+        }
+        generate_adjacency();
+    }
+
+    void Room::upload(const trlevel::ILevel& level, const IMeshStorage& mesh_storage, const Activity& activity)
+    {
+        upload(level, level.get_room(_index), mesh_storage, activity);
+    }
+
+    void Room::upload(const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage, const Activity& activity)
+    {
+        // Events are subscribed here rather than in the constructor as rooms may be created on worker threads.
         if (auto parent = _level.lock())
         {
             _token_store += parent->on_geometry_colours_changed += [&]() { _all_geometry_meshes.clear(); };
         }
+
+        _mesh = _mesh_source(_pending_geometry.vertices, _pending_geometry.indices, std::vector<uint32_t>{}, _pending_geometry.transparent_triangles, _pending_geometry.collision_triangles);
+        _pending_geometry = {};
+
+        // Generate the bounding box based on the room dimensions.
+        update_bounding_box();
+
+        generate_static_meshes(_mesh_source, level, room, mesh_storage, activity);
     }
 
-    void Room::initialise(const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage,
-        const IStaticMesh::MeshSource& static_mesh_mesh_source, const IStaticMesh::PositionSource& static_mesh_position_source,
-        const ISector::Source& sector_source, uint32_t sector_base_index, const Activity& activity)
+    const RoomGeometry& Room::pending_geometry() const
     {
-        generate_sectors(level, room, sector_source, sector_base_index);
-        generate_geometry(_mesh_source, room);
-        generate_adjacency();
-        generate_static_meshes(_mesh_source, level, room, mesh_storage, static_mesh_mesh_source, static_mesh_position_source, activity);
+        return _pending_geometry;
     }
 
     RoomInfo Room::info() const
@@ -96,8 +159,6 @@ namespace trview
 
     std::vector<PickResult> Room::pick(const Vector3& position, const Vector3& direction, PickFilter filters) const
     {
-        using namespace DirectX::TriangleTests;
-
         // Test against bounding box for the room first, to avoid more expensive mesh-ray intersection
         float box_distance = 0;
         if (!_bounding_box.Intersects(position, direction, box_distance))
@@ -105,14 +166,84 @@ namespace trview
             return {};
         }
 
+        // Geometry is the first target when it is included. Callers only use hits up to the nearest geometry, so anything
+        // further away can be skipped.
         std::vector<PickResult> pick_results;
+        float limit = FLT_MAX;
+        for (const auto& target : pick_targets(filters))
+        {
+            float distance = 0;
+            if (!target.test || !target.bounds.Intersects(position, direction, distance) || distance > limit)
+            {
+                continue;
+            }
+
+            PickResult result = target.test(position, direction);
+            if (result.hit && result.distance <= limit)
+            {
+                pick_results.push_back(result);
+                if (result.type == PickResult::Type::Room)
+                {
+                    limit = std::min(limit, result.distance);
+                }
+            }
+        }
+
+        std::sort(pick_results.begin(), pick_results.end(),
+            [](const auto& l, const auto& r) { return l.distance < r.distance; });
+        return pick_results;
+    }
+
+    std::vector<PickTarget> Room::pick_targets(PickFilter filters) const
+    {
+        std::vector<PickTarget> targets;
+
+        std::vector<std::shared_ptr<IMesh>> meshes;
+        if (has_flag(filters, PickFilter::AllGeometry))
+        {
+            if (_all_geometry_meshes.empty())
+            {
+                generate_all_geometry_mesh(_mesh_source);
+            }
+
+            for (const auto& mesh : _all_geometry_meshes)
+            {
+                meshes.push_back(mesh.second);
+            }
+        }
+        else if (has_flag(filters, PickFilter::Geometry) && _mesh)
+        {
+            meshes.push_back(_mesh);
+        }
+
+        if (!meshes.empty())
+        {
+            targets.push_back(
+                {
+                    .bounds = _bounding_box,
+                    .test = [meshes, room = std::weak_ptr<IRoom>(std::const_pointer_cast<IRoom>(shared_from_this())), room_offset = _room_offset, inverted_room_offset = _inverted_room_offset](const Vector3& position, const Vector3& direction)
+                        {
+                            PickResult nearest;
+                            const auto room_position = Vector3::Transform(position, inverted_room_offset);
+                            for (const auto& mesh : meshes)
+                            {
+                                PickResult result = mesh->pick(room_position, direction);
+                                if (result.hit && result.distance < nearest.distance)
+                                {
+                                    add_centroid_to_pick(*mesh, result, room, room_offset, inverted_room_offset);
+                                    nearest = result;
+                                }
+                            }
+                            return nearest;
+                        }
+                });
+        }
 
         if (has_flag(filters, PickFilter::Entities))
         {
-            // Pick against the entity geometry:
             for (const auto& entity : _entities)
             {
-                auto entity_ptr = entity.lock();
+                const auto entity_ptr = entity.lock();
                 if (!entity_ptr || !entity_ptr->visible())
                 {
                     continue;
@@ -121,11 +252,7 @@ namespace trview
                 const auto ng = entity_ptr->ng_plus();
                 if (!ng.has_value() || ng.value() == has_flag(filters, PickFilter::NgPlus))
                 {
-                    auto entity_result = entity_ptr->pick(position, direction);
-                    if (entity_result.hit)
-                    {
-                        pick_results.push_back(entity_result);
-                    }
+                    targets.push_back(entity_ptr->pick_target());
                 }
             }
         }
@@ -134,16 +261,9 @@ namespace trview
         {
             for (const auto& light : _lights)
             {
-                auto light_ptr = light.lock();
-                if (!light_ptr || !light_ptr->visible())
-                {
-                    continue;
-                }
-
-                auto light_result = light_ptr->pick(position, direction);
-                if (light_result.hit)
+                if (const auto light_ptr = light.lock(); light_ptr && light_ptr->visible())
                 {
-                    pick_results.push_back(light_result);
+                    targets.push_back(light_ptr->pick_target());
                 }
             }
         }
@@ -152,34 +272,20 @@ namespace trview
         {
             for (const auto& camera_sink : _camera_sinks)
             {
-                auto camera_sink_ptr = camera_sink.lock();
-                if (!camera_sink_ptr || !camera_sink_ptr->visible())
-                {
-                    continue;
-                }
-
-                auto camera_sink_result = camera_sink_ptr->pick(position, direction);
-                if (camera_sink_result.hit)
+                if (const auto camera_sink_ptr = camera_sink.lock(); camera_sink_ptr && camera_sink_ptr->visible())
                 {
-                    pick_results.push_back(camera_sink_result);
+                    targets.push_back(camera_sink_ptr->pick_target());
                 }
             }
         }
 
         if (has_flag(filters, PickFilter::Triggers))
         {
-            for (const auto& trigger_pair : _triggers)
+            for (const auto& trigger : _triggers)
             {
-                auto trigger = trigger_pair.second.lock();
-                if (!trigger || !trigger->visible())
+                if (const auto trigger_ptr = trigger.second.lock(); trigger_ptr && trigger_ptr->visible())
                 {
-                    continue;
-                }
-
-                auto trigger_result = trigger->pick(position, direction);
-                if (trigger_result.hit)
-                {
-                    pick_results.push_back(trigger_result);
+                    targets.push_back(trigger_ptr->pick_target());
                 }
             }
         }
@@ -193,44 +299,25 @@ namespace trview
                     continue;
                 }
 
-                PickResult static_mesh_result = static_mesh->pick(position, direction);
-                if (static_mesh_result.hit)
+                auto target = static_mesh->pick_target();
+                if (target.test)
                 {
-                    static_mesh_result.type = PickResult::Type::StaticMesh;
-                    static_mesh_result.static_mesh = static_mesh;
-                    pick_results.push_back(static_mesh_result);
+                    target.test = [test = std::move(target.test), mesh = std::weak_ptr<IStaticMesh>(static_mesh)](const Vector3& position, const Vector3& direction)
+                        {
+                            PickResult static_mesh_result = test(position, direction);
+                            if (static_mesh_result.hit)
+                            {
+                                static_mesh_result.type = PickResult::Type::StaticMesh;
+                                static_mesh_result.static_mesh = mesh;
+                            }
+                            return static_mesh_result;
+                        };
                 }
+                targets.push_back(std::move(target));
             }
         }
 
-        if (has_flag(filters, PickFilter::AllGeometry))
-        {
-            auto room_offset = Matrix::CreateTranslation(-_info.x / trlevel::Scale_X, 0, -_info.z / trlevel::Scale_Z);
-            for (const auto& mesh : _all_geometry_meshes)
-            {
-                PickResult all_geometry_result = mesh.second->pick(Vector3::Transform(position, room_offset), direction);
-                if (all_geometry_result.hit)
-                {
-                    add_centroid_to_pick(*mesh.second, all_geometry_result);
-                    pick_results.push_back(all_geometry_result);
-                }
-            }
-        }
-        else if (has_flag(filters, PickFilter::Geometry))
-        {
-            // Pick against the room geometry:
-            auto room_offset = Matrix::CreateTranslation(-_info.x / trlevel::Scale_X, 0, -_info.z / trlevel::Scale_Z);
-            PickResult geometry_result = _mesh->pick(Vector3::Transform(position, room_offset), direction);
-            if (geometry_result.hit)
-            {
-                add_centroid_to_pick(*_mesh, geometry_result);
-                pick_results.push_back(geometry_result);
-            }
-        }
-
-        std::sort(pick_results.begin(), pick_results.end(),
-            [](const auto& l, const auto& r) { return l.distance < r.distance; });
-        return pick_results;
+        return targets;
     }
 
     void Room::render(const ICamera& camera, SelectionMode selected, RenderFilter render_filter, const std::unordered_set<uint32_t>& visible_rooms)
@@ -331,8 +418,7 @@ namespace trview
         }
     }
 
-    void Room::generate_static_meshes(const IMesh::Source& mesh_source, const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage,
-        const IStaticMesh::MeshSource& static_mesh_mesh_source, const IStaticMesh::PositionSource& static_mesh_position_source, const Activity& activity)
+    void Room::generate_static_meshes(const IMesh::Source& mesh_source, const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage, const Activity& activity)
     {
         for (uint32_t i = 0; i < room.static_meshes.size(); ++i)
         {
@@ -343,7 +429,7 @@ namespace trview
                 activity.log(trview::Message::Status::Error, std::format("Static Mesh {} was requested but not found", room_mesh.mesh_id));
                 continue;
             }
-            _static_meshes.push_back(static_mesh_mesh_source(room_mesh, level_static_mesh.value(), mesh_storage.mesh(level_static_mesh.value().Mesh), shared_from_this(), _level));
+            _static_meshes.push_back(_static_mesh_mesh_source(room_mesh, level_static_mesh.value(), mesh_storage.mesh(level_static_mesh.value().Mesh), shared_from_this(), _level));
         }
 
         // Also read the room sprites - they're similar enough for now.
@@ -356,7 +442,7 @@ namespace trview
             auto vertex = room.data.vertices[room_sprite.vertex].vertex;
             auto pos = Vector3(vertex.x / trlevel::Scale_X, vertex.y / trlevel::Scale_Y, vertex.z / trlevel::Scale_Z);
             pos = Vector3::Transform(pos, _room_offset) + offset;
-            _static_meshes.push_back(static_mesh_position_source(room_sprite, pos, scale, sprite_mesh, shared_from_this(), _level));
+            _static_meshes.push_back(_static_mesh_position_source(room_sprite, pos, scale, sprite_mesh, shared_from_this(), _level));
         }
     }
 
@@ -382,24 +468,16 @@ namespace trview
         }
     }
 
-    void Room::generate_geometry(const IMesh::Source& mesh_source, const trlevel::tr3_room& room)
+    void Room::generate_geometry(const trlevel::tr3_room& room)
     {
-        std::vector<MeshVertex> vertices;
-        std::vector<TransparentTriangle> transparent_triangles;
+        auto& geometry = _pending_geometry;
 
         // The indices are grouped by the number of textiles so that it can be drawn as the selected texture.
-        std::vector<std::vector<uint32_t>> indices(_texture_storage->num_tiles());
-        
-        std::vector<Triangle> collision_triangles;
-
-        process_textured_rectangles(room.data.rectangles, room.data.vertices, *_texture_storage, vertices, indices, transparent_triangles, collision_triangles, false);
-        process_textured_triangles(room.data.triangles, room.data.vertices, *_texture_storage, vertices, indices, transparent_triangles, collision_triangles, false);
-        process_collision_transparency(transparent_triangles, collision_triangles);
-
-        _mesh = mesh_source(vertices, indices, std::vector<uint32_t>{}, transparent_triangles, collision_triangles);
+        geometry.indices.resize(_texture_storage->num_tiles());
 
-        // Generate the bounding box based on the room dimensions.
-        update_bounding_box();
+        process_textured_rectangles(room.data.rectangles, room.data.vertices, *_texture_storage, geometry.vertices, geometry.indices, geometry.transparent_triangles, geometry.collision_triangles, false);
+        process_textured_triangles(room.data.triangles, room.data.vertices, *_texture_storage, geometry.vertices, geometry.indices, geometry.transparent_triangles, geometry.collision_triangles, false);
+        process_collision_transparency(geometry.transparent_triangles, geometry.collision_triangles);
     }
 
     void Room::generate_adjacency()
@@ -462,12 +540,12 @@ namespace trview
         _camera_sinks.push_back(camera_sink);
     }
 
-    void Room::generate_sectors(const trlevel::ILevel& level, const trlevel::tr3_room& room, const ISector::Source& sector_source, uint32_t sector_base_index)
+    void Room::generate_sectors(const trlevel::ILevel& level, const LevelFloordata& floordata, const trlevel::tr3_room& room, const ISector::Source& sector_source, uint32_t sector_base_index)
     {
         for (auto i = 0u; i < room.sector_list.size(); ++i)
         {
             const trlevel::tr_room_sector &sector = room.sector_list[i];
-            _sectors.push_back(sector_source(level, room, sector, i, shared_from_this(), sector_base_index + i));
+            _sectors.push_back(sector_source(level, floordata, room, sector, i, shared_from_this(), sector_base_index + i));
         }
     }
 
@@ -479,10 +557,7 @@ namespace trview
         {
             if (!has_flag(render_filter, RenderFilter::AllGeometry))
             {
-                for (const auto& triangle : _mesh->transparent_triangles())
-                {
-                    transparency.add(triangle.transform(_room_offset, colour, !has_flag(render_filter, RenderFilter::Lighting)));
-                }
+                _transparent_triangles.add(transparency, _mesh, _room_offset, colour, !has_flag(render_filter, RenderFilter::Lighting));
 
                 for (const auto& static_mesh : _static_meshes)
                 {
@@ -919,31 +994,6 @@ namespace trview
         return _num_z_sectors; 
     }
 
-    void Room::add_centroid_to_pick(const IMesh& mesh, PickResult& geometry_result) const
-    {
-        // Transform the position back in to world space. Also mark it as a room pick result.
-        geometry_result.type = PickResult::Type::Room;
-        geometry_result.room = std::const_pointer_cast<IRoom>(shared_from_this());
-        geometry_result.position = Vector3::Transform(geometry_result.position, _room_offset);
-
-        const auto& tri = geometry_result.triangle;
-        if (tri.normal.y < 0)
-        {
-            Vector3 centroid = { std::floor(geometry_result.position.x) + 0.5f, geometry_result.position.y, std::floor(geometry_result.position.z) + 0.5f };
-            Vector3 ray_direction = { 0, -tri.normal.y, 0 };
-
-            centroid = Vector3::Transform(centroid, _inverted_room_offset);
-            ray_direction.Normalize();
-            PickResult centroid_hit = mesh.pick(centroid - ray_direction * 0.5f, ray_direction);
-            geometry_result.centroid = centroid_hit.hit ? Vector3::Transform(centroid_hit.position, _room_offset) : geometry_result.position;
-            geometry_result.triangle = centroid_hit.hit ? centroid_hit.triangle : geometry_result.triangle;
-        }
-        else
-        {
-            geometry_result.centroid = geometry_result.position;
-        }
-    }
-
     bool Room::flag(Flag flag) const
     {
         return _flags & static_cast<uint16_t>(flag);
@@ -972,7 +1022,7 @@ namespace trview
         }
     }
 
-    void Room::generate_all_geometry_mesh(const IMesh::Source& mesh_source)
+    void Room::generate_all_geometry_mesh(const IMesh::Source& mesh_source) const
     {
         // TODO: Split into meshes for the main room and then for adjacent rooms. If the adjacent room is being rendered
         // then only one room needs to render that part. This can be decided based on which room has the lower room number.
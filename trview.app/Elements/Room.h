@@ -14,6 +14,7 @@
 #include <trview.app/Geometry/IMesh.h>
 #include <trview.app/Elements/ISector.h>
 #include <trview.app/Geometry/PickResult.h>
+#include <trview.app/Geometry/TransparentTriangleCache.h>
 #include <trview.graphics/Texture.h>
 #include "IStaticMesh.h"
 #include "IRoom.h"
@@ -23,6 +24,17 @@
 
 namespace trview
 {
+    /// <summary>
+    /// Room geometry that has been built but not yet turned into a mesh.
+    /// </summary>
+    struct RoomGeometry
+    {
+        std::vector<MeshVertex> vertices;
+        std::vector<std::vector<uint32_t>> indices;
+        std::vector<TransparentTriangle> transparent_triangles;
+        std::vector<Triangle> collision_triangles;
+    };
+
     class Room final : public IRoom, public std::enable_shared_from_this<IRoom>
     {
     public:
@@ -37,6 +49,7 @@ namespace trview
         virtual RoomInfo info() const override;
         virtual std::set<uint16_t> neighbours() const override;
         virtual std::vector<PickResult> pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, PickFilter filters = PickFilter::Default) const override;
+        virtual std::vector<PickTarget> pick_targets(PickFilter filters) const override;
         virtual void render(const ICamera& camera, SelectionMode selected, RenderFilter render_filter, const std::unordered_set<uint32_t>& visible_rooms) override;
         virtual void render_bounding_boxes(const ICamera& camera) override;
         virtual void render_lights(const ICamera& camera, const std::weak_ptr<ILight>& selected_light) override;
@@ -86,6 +99,7 @@ namespace trview
         int16_t ambient_intensity_2() const override;
         int16_t light_mode() const override;
         void initialise(const trlevel::ILevel& level,
+            const LevelFloordata& floordata,
             const trlevel::tr3_room& room,
             const IMeshStorage& mesh_storage,
             const IStaticMesh::MeshSource& static_mesh_mesh_source,
@@ -93,15 +107,33 @@ namespace trview
             const ISector::Source& sector_source,
             uint32_t sector_base_index,
             const Activity& activity);
+        /// <summary>
+        /// Build the sectors, adjacency and geometry for the room without creating any meshes. Different rooms can
+        /// be built on different threads.
+        /// </summary>
+        /// <param name="geometry">Geometry built for this room by an earlier load. If this is empty the geometry is generated.</param>
+        void build(const trlevel::ILevel& level,
+            const LevelFloordata& floordata,
+            const trlevel::tr3_room& room,
+            const IStaticMesh::MeshSource& static_mesh_mesh_source,
+            const IStaticMesh::PositionSource& static_mesh_position_source,
+            const ISector::Source& sector_source,
+            uint32_t sector_base_index,
+            std::optional<RoomGeometry> geometry);
+        void upload(const trlevel::ILevel& level, const IMeshStorage& mesh_storage, const Activity& activity) override;
+        /// <summary>
+        /// Get the geometry that is waiting to be uploaded.
+        /// </summary>
+        const RoomGeometry& pending_geometry() const;
         std::vector<std::weak_ptr<IStaticMesh>> static_meshes() const override;
     private:
-        void generate_geometry(const IMesh::Source& mesh_source, const trlevel::tr3_room& room);
+        void generate_geometry(const trlevel::tr3_room& room);
         void generate_adjacency();
-        void generate_static_meshes(const IMesh::Source& mesh_source, const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage,
-            const IStaticMesh::MeshSource& static_mesh_mesh_source, const IStaticMesh::PositionSource& static_mesh_position_source, const Activity& activity);
+        void generate_static_meshes(const IMesh::Source& mesh_source, const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage, const Activity& activity);
+        void upload(const trlevel::ILevel& level, const trlevel::tr3_room& room, const IMeshStorage& mesh_storage, const Activity& activity);
         void render_contained(const ICamera& camera, const DirectX::SimpleMath::Color& colour, RenderFilter render_filter);
         void get_contained_transparent_triangles(ITransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour, RenderFilter render_filter);
-        void generate_sectors(const trlevel::ILevel& level, const trlevel::tr3_room& room, const ISector::Source& sector_source, uint32_t sector_base_index);
+        void generate_sectors(const trlevel::ILevel& level, const LevelFloordata& floordata, const trlevel::tr3_room& room, const ISector::Source& sector_source, uint32_t sector_base_index);
         ISector* get_trigger_sector(int32_t x, int32_t z);
         uint32_t get_sector_id(int32_t x, int32_t z) const;
 
@@ -110,9 +142,7 @@ namespace trview
         /// @param collision_triangles The collision output vector.
         void process_collision_transparency(const std::vector<TransparentTriangle>& transparent_triangles, std::vector<Triangle>& collision_triangles);
 
-        void generate_all_geometry_mesh(const IMesh::Source& mesh_source);
-
-        void add_centroid_to_pick(const IMesh& mesh, PickResult& geometry_result) const;
+        void generate_all_geometry_mesh(const IMesh::Source& mesh_source) const;
 
         RoomInfo                           _info;
         std::set<uint16_t>                 _neighbours;
@@ -121,7 +151,9 @@ namespace trview
         std::vector<std::shared_ptr<IStaticMesh>> _static_meshes;
 
         std::shared_ptr<IMesh> _mesh;
-        std::unordered_map<uint32_t, std::shared_ptr<IMesh>> _all_geometry_meshes;
+        TransparentTriangleCache _transparent_triangles;
+        // Made by whichever of rendering or picking needs them first, so that picking doesn't depend on a render having happened.
+        mutable std::unordered_map<uint32_t, std::shared_ptr<IMesh>> _all_geometry_meshes;
         DirectX::SimpleMath::Matrix _room_offset;
         DirectX::SimpleMath::Matrix _inverted_room_offset;
 
@@ -145,6 +177,9 @@ namespace trview
         std::shared_ptr<ILevelTextureStorage> _texture_storage;
         std::vector<std::weak_ptr<ILight>> _lights;
         IMesh::Source _mesh_source;
+        IStaticMesh::MeshSource _static_mesh_mesh_source;
+        IStaticMesh::PositionSource _static_mesh_position_source;
+        RoomGeometry _pending_geometry;
         std::vector<uint32_t> _all_geometry_sector_rooms;
         std::function<std::shared_ptr<IMesh>()> _unmatched_mesh_generator;
 
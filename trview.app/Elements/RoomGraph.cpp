@@ -0,0 +1,92 @@
+#include "RoomGraph.h"
+
+namespace trview
+{
+    RoomGraph::RoomGraph(const std::vector<std::set<uint16_t>>& neighbours)
+    {
+        _offsets.reserve(neighbours.size() + 1);
+        _offsets.push_back(0);
+        for (const auto& room_neighbours : neighbours)
+        {
+            for (const auto neighbour : room_neighbours)
+            {
+                if (neighbour < neighbours.size())
+                {
+                    _neighbours.push_back(neighbour);
+                }
+            }
+            _offsets.push_back(static_cast<uint32_t>(_neighbours.size()));
+        }
+    }
+
+    std::span<const uint16_t> RoomGraph::neighbours(uint16_t room) const
+    {
+        if (room >= size())
+        {
+            return {};
+        }
+        return std::span<const uint16_t>(_neighbours).subspan(_offsets[room], _offsets[room + 1] - _offsets[room]);
+    }
+
+    uint32_t RoomGraph::size() const
+    {
+        return _offsets.empty() ? 0 : static_cast<uint32_t>(_offsets.size() - 1);
+    }
+
+    std::span<const uint16_t> RoomGraph::rooms_within(uint16_t room, uint32_t max_depth) const
+    {
+        if (room >= size())
+        {
+            return {};
+        }
+
+        const auto& room_layers = layers(room);
+        const auto end = room_layers.ends[std::min<std::size_t>(max_depth, room_layers.ends.size() - 1)];
+        return std::span<const uint16_t>(room_layers.rooms).first(end);
+    }
+
+    uint32_t RoomGraph::distance(uint16_t from, uint16_t to) const
+    {
+        if (from >= size() || to >= size())
+        {
+            return Unreachable;
+        }
+        return layers(from).distances[to];
+    }
+
+    const RoomGraph::Layers& RoomGraph::layers(uint16_t room) const
+    {
+        auto found = _layers.find(room);
+        if (found != _layers.end())
+        {
+            return found->second;
+        }
+
+        Layers result;
+        result.distances.resize(size(), Unreachable);
+        result.distances[room] = 0;
+        result.rooms.push_back(room);
+
+        std::size_t layer_start = 0;
+        while (layer_start < result.rooms.size())
+        {
+            const auto layer_end = result.rooms.size();
+            result.ends.push_back(static_cast<uint32_t>(layer_end));
+            const auto next_distance = static_cast<uint32_t>(result.ends.size());
+            for (auto i = layer_start; i < layer_end; ++i)
+            {
+                for (const auto neighbour : neighbours(result.rooms[i]))
+                {
+                    if (result.distances[neighbour] == Unreachable)
+                    {
+                        result.distances[neighbour] = next_distance;
+                        result.rooms.push_back(neighbour);
+                    }
+                }
+            }
+            layer_start = layer_end;
+        }
+
+        return _layers.emplace(room, std::move(result)).first->second;
+    }
+}
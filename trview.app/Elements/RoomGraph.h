@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace trview
+{
+    /// <summary>
+    /// Room adjacency for a level, stored as one flat neighbour list with an offset per room. Breadth first
+    /// distance layers are calculated the first time a room is used as a starting point and then kept.
+    /// </summary>
+    class RoomGraph final
+    {
+    public:
+        static constexpr uint32_t Unreachable = UINT32_MAX;
+
+        RoomGraph() = default;
+        /// <summary>
+        /// Create the graph from the neighbours of each room.
+        /// </summary>
+        /// <param name="neighbours">The neighbours of each room, indexed by room number. Neighbours that are not rooms are ignored.</param>
+        explicit RoomGraph(const std::vector<std::set<uint16_t>>& neighbours);
+        /// <summary>
+        /// Get the direct neighbours of a room.
+        /// </summary>
+        /// <param name="room">The room number.</param>
+        /// <returns>The neighbours in ascending order.</returns>
+        std::span<const uint16_t> neighbours(uint16_t room) const;
+        /// <summary>
+        /// Get the number of rooms in the graph.
+        /// </summary>
+        uint32_t size() const;
+        /// <summary>
+        /// Get the rooms that can be reached from a room by crossing at most max_depth neighbours, including the room itself.
+        /// </summary>
+        /// <param name="room">The room to start from.</param>
+        /// <param name="max_depth">The maximum number of steps.</param>
+        /// <returns>The rooms, in order of distance.</returns>
+        std::span<const uint16_t> rooms_within(uint16_t room, uint32_t max_depth) const;
+        /// <summary>
+        /// Get the number of steps between two rooms.
+        /// </summary>
+        /// <param name="from">The room to start from.</param>
+        /// <param name="to">The room to reach.</param>
+        /// <returns>The distance or Unreachable.</returns>
+        uint32_t distance(uint16_t from, uint16_t to) const;
+    private:
+        struct Layers
+        {
+            /// Reachable rooms ordered by distance.
+            std::vector<uint16_t> rooms;
+            /// Index into rooms of the end of each layer.
+            std::vector<uint32_t> ends;
+            std::vector<uint32_t> distances;
+        };
+
+        const Layers& layers(uint16_t room) const;
+
+        std::vector<uint32_t> _offsets;
+        std::vector<uint16_t> _neighbours;
+        mutable std::unordered_map<uint16_t, Layers> _layers;
+    };
+}
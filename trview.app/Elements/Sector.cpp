@@ -7,13 +7,13 @@ using namespace DirectX::SimpleMath;
 
 namespace trview
 {
-    Sector::Sector(const trlevel::ILevel& level, const trlevel::tr3_room& room, const trlevel::tr_room_sector& sector, int sector_id, const std::weak_ptr<IRoom>& room_ptr, uint32_t sector_number)
+    Sector::Sector(const trlevel::ILevel& level, const LevelFloordata& floordata, const trlevel::tr3_room& room, const trlevel::tr_room_sector& sector, int sector_id, const std::weak_ptr<IRoom>& room_ptr, uint32_t sector_number)
         : _sector(sector), _sector_id(static_cast<uint16_t>(sector_id)), _room_above(sector.room_above), _room_below(sector.room_below), _room(room_number(room_ptr)), _info(room.info), _room_ptr(room_ptr),
         _floordata_index(sector.floordata_index), _number(sector_number)
     {
         _x = static_cast<int16_t>(sector_id / room.num_z_sectors);
         _z = static_cast<int16_t>(sector_id % room.num_z_sectors);
-        parse(level);
+        parse(level, floordata);
         calculate_neighbours(level);
     }
 
@@ -33,13 +33,13 @@ namespace trview
     }
 
     bool
-    Sector::parse(const trlevel::ILevel& level)
+    Sector::parse(const trlevel::ILevel& level, const LevelFloordata& level_floordata)
     {
         // Basic sector items 
         if (_sector.floor == -127 && _sector.ceiling == -127)
         {
             _flags |= SectorFlag::Wall;
-            const auto info = level.get_room(_room);
+            const auto& info = level.get_room(_room);
             if ((_x > 0 && _z > 0) && (_x < info.num_x_sectors - 1 && _z < info.num_z_sectors - 1))
             {
                 _flags |= SectorFlag::SpecialWall;
@@ -62,7 +62,7 @@ namespace trview
 
         if (_sector.floordata_index != 0)
         {
-            auto floordata = parse_floordata(level.get_floor_data_all(), _sector.floordata_index, FloordataMeanings::None, level.trng(), level.platform_and_version());
+            const auto& floordata = level_floordata.at(_sector.floordata_index);
 
             for (const auto& command : floordata.commands)
             {
@@ -10,7 +10,7 @@ namespace trview
     {
     public:
         // Constructs sector object and parses floor data automatically 
-        Sector(const trlevel::ILevel& level, const trlevel::tr3_room& room, const trlevel::tr_room_sector& sector, int sector_id, const std::weak_ptr<IRoom>& room_ptr, uint32_t sector_number);
+        Sector(const trlevel::ILevel& level, const LevelFloordata& floordata, const trlevel::tr3_room& room, const trlevel::tr_room_sector& sector, int sector_id, const std::weak_ptr<IRoom>& room_ptr, uint32_t sector_number);
         virtual ~Sector() = default;
         // Returns the id of the room that this floor data points to 
         virtual std::uint16_t portal() const override;
@@ -51,7 +51,7 @@ namespace trview
         TriangulationDirection ceiling_triangulation() const override;
         uint32_t number() const override;
     private:
-        bool parse(const trlevel::ILevel& level);
+        bool parse(const trlevel::ILevel& level, const LevelFloordata& floordata);
         void parse_slope();
         void parse_ceiling_slope();
         void calculate_neighbours(const trlevel::ILevel& level);
@@ -10,6 +10,7 @@
 
 #include "../../Geometry/IRenderable.h"
 #include "../../Geometry/PickResult.h"
+#include "../../Geometry/PickTarget.h"
 
 namespace trlevel
 {
@@ -30,6 +31,7 @@ namespace trview
         virtual int16_t id() const = 0;
         virtual uint32_t number() const = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        virtual PickTarget pick_target() const = 0;
         virtual uint8_t pitch() const = 0;
         virtual DirectX::SimpleMath::Vector3 position() const = 0;
         virtual uint8_t range() const = 0;
@@ -69,20 +69,30 @@ namespace trview
 
     PickResult SoundSource::pick(const Vector3& position, const Vector3& direction) const
     {
-        PickResult result{};
-        BoundingBox cube(_position, Vector3(0.125f, 0.125f, 0.125f));
+        return pick_target().test(position, direction);
+    }
 
-        float distance = 0;
-        if (cube.Intersects(position, direction, distance))
+    PickTarget SoundSource::pick_target() const
+    {
+        const BoundingBox cube(_position, Vector3(0.125f, 0.125f, 0.125f));
+        return
         {
-            result.distance = distance;
-            result.hit = true;
-            result.position = position + direction * distance;
-            result.type = PickResult::Type::SoundSource;
-            result.sound_source = std::const_pointer_cast<ISoundSource>(shared_from_this());
-        }
-
-        return result;
+            .bounds = cube,
+            .test = [cube, sound_source = std::weak_ptr<ISoundSource>(std::const_pointer_cast<ISoundSource>(shared_from_this()))](const Vector3& position, const Vector3& direction)
+                {
+                    PickResult result{};
+                    float distance = 0;
+                    if (cube.Intersects(position, direction, distance))
+                    {
+                        result.distance = distance;
+                        result.hit = true;
+                        result.position = position + direction * distance;
+                        result.type = PickResult::Type::SoundSource;
+                        result.sound_source = sound_source;
+                    }
+                    return result;
+                }
+        };
     }
 
     uint8_t SoundSource::pitch() const
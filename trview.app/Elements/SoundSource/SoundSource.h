@@ -25,6 +25,7 @@ namespace trview
         int16_t id() const override;
         uint32_t number() const override;
         PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const;
+        PickTarget pick_target() const override;
         uint8_t pitch() const override;
         DirectX::SimpleMath::Vector3 position() const override;
         uint8_t range() const override;
@@ -78,30 +78,44 @@ namespace trview
             return;
         }
 
+        // Sprites face the camera so they have to be transformed every time.
         if (_type == Type::Sprite)
         {
             _world = create_billboard(_position, Vector3(), _scale, camera);
+            for (const auto& triangle : _mesh->transparent_triangles())
+            {
+                transparency.add(triangle.transform(_world, colour, true));
+            }
+            return;
         }
 
-        for (const auto& triangle : _mesh->transparent_triangles())
-        {
-            transparency.add(triangle.transform(_world, colour, true));
-        }
+        _transparent_triangles.add(transparency, _mesh, _world, colour, true);
     }
 
     PickResult StaticMesh::pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
+    {
+        return _mesh ? pick_target().test(position, direction) : PickResult();
+    }
+
+    PickTarget StaticMesh::pick_target() const
     {
         if (!_mesh)
         {
-            return {};
+            return { .bounds = bounding_box() };
         }
 
-        const auto transform = _world.Invert();
-        auto normal_direction = Vector3::TransformNormal(direction, transform);
-        normal_direction.Normalize();
-        PickResult result = _mesh->pick(Vector3::Transform(position, transform), normal_direction);
-        result.position = Vector3::Transform(result.position, _world);
-        return result;
+        return
+        {
+            .bounds = bounding_box(),
+            .test = [mesh = _mesh, world = _world, transform = _world.Invert()](const Vector3& position, const Vector3& direction)
+                {
+                    auto normal_direction = Vector3::TransformNormal(direction, transform);
+                    normal_direction.Normalize();
+                    PickResult result = mesh->pick(Vector3::Transform(position, transform), normal_direction);
+                    result.position = Vector3::Transform(result.position, world);
+                    return result;
+                }
+        };
     }
 
     Vector3 StaticMesh::position() const
@@ -124,6 +138,25 @@ namespace trview
         return _collision;
     }
 
+    DirectX::BoundingBox StaticMesh::bounding_box() const
+    {
+        if (!_mesh)
+        {
+            return BoundingBox(_position, Vector3::Zero);
+        }
+
+        BoundingBox box;
+        if (_type == Type::Sprite)
+        {
+            _mesh->bounding_box().Transform(box, _scale);
+            const float radius = Vector3(box.Center).Length() + Vector3(box.Extents).Length();
+            return BoundingBox(_position, Vector3(radius));
+        }
+
+        _mesh->bounding_box().Transform(box, _world);
+        return box;
+    }
+
     float StaticMesh::rotation() const
     {
         return _rotation;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <trview.app/Elements/IStaticMesh.h>
+#include <trview.app/Geometry/TransparentTriangleCache.h>
 
 namespace trview
 {
@@ -14,11 +15,13 @@ namespace trview
         void render_bounding_box(const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
         virtual void get_transparent_triangles(ITransparencyBuffer& transparency, const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        virtual PickTarget pick_target() const override;
 
         DirectX::SimpleMath::Vector3 position() const override;
         std::weak_ptr<IRoom> room() const override;
         DirectX::BoundingBox visibility() const override;
         DirectX::BoundingBox collision() const override;
+        DirectX::BoundingBox bounding_box() const override;
         float rotation() const override;
         Type type() const override;
         uint16_t id() const override;
@@ -37,6 +40,7 @@ namespace trview
         DirectX::BoundingBox _collision;
         DirectX::SimpleMath::Matrix  _world;
         std::shared_ptr<IMesh> _mesh;
+        TransparentTriangleCache _transparent_triangles;
         std::shared_ptr<IMesh> _bounding_mesh;
         DirectX::SimpleMath::Matrix _scale;
         std::weak_ptr<IRoom> _room;
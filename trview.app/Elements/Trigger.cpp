@@ -121,18 +121,31 @@ namespace trview
 
     PickResult Trigger::pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
-        if (_mesh)
+        return _mesh ? pick_target().test(position, direction) : PickResult();
+    }
+
+    PickTarget Trigger::pick_target() const
+    {
+        if (!_mesh)
         {
-            auto result = _mesh->pick(position, direction);
-            if (result.hit)
-            {
-                result.type = PickResult::Type::Trigger;
-                result.trigger = std::const_pointer_cast<ITrigger>(shared_from_this());
-                return result;
-            }
+            return { .bounds = bounding_box() };
         }
 
-        return PickResult();
+        return
+        {
+            .bounds = _mesh->bounding_box(),
+            .test = [mesh = _mesh, trigger = std::weak_ptr<ITrigger>(std::const_pointer_cast<ITrigger>(shared_from_this()))](const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction)
+                {
+                    auto result = mesh->pick(position, direction);
+                    if (result.hit)
+                    {
+                        result.type = PickResult::Type::Trigger;
+                        result.trigger = trigger;
+                        return result;
+                    }
+                    return PickResult();
+                }
+        };
     }
 
     void Trigger::render(const ICamera&, const DirectX::SimpleMath::Color&)
@@ -146,11 +159,7 @@ namespace trview
             return;
         }
 
-        using namespace DirectX::SimpleMath;
-        for (auto& triangle : _mesh->transparent_triangles())
-        {
-            transparency.add(triangle.transform(Matrix::Identity, colour, true));
-        }
+        _transparent_triangles.add(transparency, _mesh, DirectX::SimpleMath::Matrix::Identity, colour, true);
     }
 
     void Trigger::set_position(const DirectX::SimpleMath::Vector3& position)
@@ -158,6 +167,11 @@ namespace trview
         _position = position;
     }
 
+    DirectX::BoundingBox Trigger::bounding_box() const
+    {
+        return _mesh ? _mesh->bounding_box() : DirectX::BoundingBox(_position, DirectX::SimpleMath::Vector3::Zero);
+    }
+
     DirectX::SimpleMath::Vector3 Trigger::position() const
     {
         return _position;
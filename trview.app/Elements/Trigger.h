@@ -3,6 +3,7 @@
 #include <memory>
 
 #include <trview.app/Geometry/IMesh.h>
+#include <trview.app/Geometry/TransparentTriangleCache.h>
 #include <trview.app/Elements/ITrigger.h>
 #include <trview.app/Camera/ICamera.h>
 #include "../Elements/ISector.h"
@@ -31,6 +32,8 @@ namespace trview
         void set_colour(const std::optional<Colour>& colour) override;
         virtual void set_triangles(const std::vector<TransparentTriangle>& transparent_triangles) override;
         virtual PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        virtual PickTarget pick_target() const override;
+        DirectX::BoundingBox bounding_box() const override;
         virtual void set_position(const DirectX::SimpleMath::Vector3& position) override;
         virtual DirectX::SimpleMath::Vector3 position() const override;
         void render(const ICamera& camera, const DirectX::SimpleMath::Color& colour) override;
@@ -43,6 +46,7 @@ namespace trview
         std::vector<uint16_t> _objects;
         std::vector<Command> _commands;
         std::shared_ptr<IMesh> _mesh;
+        TransparentTriangleCache _transparent_triangles;
         DirectX::SimpleMath::Vector3 _position;
         IMesh::TransparentSource _mesh_source;
         TriggerType _type;
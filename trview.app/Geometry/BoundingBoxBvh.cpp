@@ -0,0 +1,161 @@
+#include "BoundingBoxBvh.h"
+#include "RayBox.h"
+#include <algorithm>
+#include <array>
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace
+    {
+        constexpr uint32_t MaxLeafSize = 2;
+        // Leaves are forced at this depth, which keeps the traversal stack a fixed size.
+        constexpr uint32_t MaxDepth = 48;
+
+        Vector3 minimum_of(const DirectX::BoundingBox& box)
+        {
+            return Vector3(box.Center) - Vector3(box.Extents);
+        }
+
+        Vector3 maximum_of(const DirectX::BoundingBox& box)
+        {
+            return Vector3(box.Center) + Vector3(box.Extents);
+        }
+
+        float component(const DirectX::XMFLOAT3& v, uint32_t axis)
+        {
+            return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+        }
+    }
+
+    BoundingBoxBvh::BoundingBoxBvh(const std::vector<DirectX::BoundingBox>& boxes)
+    {
+        if (boxes.empty())
+        {
+            return;
+        }
+
+        _indices.resize(boxes.size());
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            _indices[i] = i;
+        }
+        _nodes.reserve(boxes.size() * 2);
+        build(boxes, 0, static_cast<uint32_t>(boxes.size()), 0);
+
+        _bounds.reserve(boxes.size());
+        for (const auto index : _indices)
+        {
+            _bounds.push_back({ minimum_of(boxes[index]), maximum_of(boxes[index]) });
+        }
+    }
+
+    void BoundingBoxBvh::build(const std::vector<DirectX::BoundingBox>& boxes, uint32_t start, uint32_t end, uint32_t depth)
+    {
+        const uint32_t node_index = static_cast<uint32_t>(_nodes.size());
+        _nodes.push_back({});
+
+        Vector3 minimum(FLT_MAX, FLT_MAX, FLT_MAX);
+        Vector3 maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        Vector3 centre_minimum = minimum;
+        Vector3 centre_maximum = maximum;
+        for (uint32_t i = start; i < end; ++i)
+        {
+            const auto& box = boxes[_indices[i]];
+            minimum = Vector3::Min(minimum, minimum_of(box));
+            maximum = Vector3::Max(maximum, maximum_of(box));
+            centre_minimum = Vector3::Min(centre_minimum, box.Center);
+            centre_maximum = Vector3::Max(centre_maximum, box.Center);
+        }
+        _nodes[node_index].minimum = minimum;
+        _nodes[node_index].maximum = maximum;
+
+        const Vector3 spread = centre_maximum - centre_minimum;
+        const uint32_t count = end - start;
+        if (count <= MaxLeafSize || depth >= MaxDepth || (spread.x <= 0 && spread.y <= 0 && spread.z <= 0))
+        {
+            _nodes[node_index].first = start;
+            _nodes[node_index].count = count;
+            return;
+        }
+
+        // There are usually only a few hundred boxes, so splitting at the median centre along the widest axis is enough.
+        const uint32_t axis = spread.x >= spread.y && spread.x >= spread.z ? 0 : spread.y >= spread.z ? 1 : 2;
+        const uint32_t middle = start + count / 2;
+        std::nth_element(_indices.begin() + start, _indices.begin() + middle, _indices.begin() + end,
+            [&](uint32_t l, uint32_t r) { return component(boxes[l].Center, axis) < component(boxes[r].Center, axis); });
+
+        build(boxes, start, middle, depth + 1);
+        _nodes[node_index].first = static_cast<uint32_t>(_nodes.size());
+        build(boxes, middle, end, depth + 1);
+    }
+
+    void BoundingBoxBvh::pick(const Vector3& position, const Vector3& direction, const Visitor& visitor, float limit) const
+    {
+        if (_nodes.empty())
+        {
+            return;
+        }
+
+        const Vector3 inverse = inverse_direction(direction);
+
+        struct Entry
+        {
+            uint32_t node;
+            float distance;
+        };
+        std::array<Entry, MaxDepth + 2> stack;
+        uint32_t size = 0;
+
+        if (const auto distance = ray_box_entry(_nodes[0].minimum, _nodes[0].maximum, position, inverse, limit))
+        {
+            stack[size++] = { 0, distance.value() };
+        }
+
+        while (size > 0)
+        {
+            const auto entry = stack[--size];
+            if (entry.distance > limit)
+            {
+                continue;
+            }
+
+            const auto& node = _nodes[entry.node];
+            if (node.count > 0)
+            {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i)
+                {
+                    if (ray_box_entry(_bounds[i].minimum, _bounds[i].maximum, position, inverse, limit))
+                    {
+                        limit = std::min(limit, visitor(_indices[i], limit));
+                    }
+                }
+                continue;
+            }
+
+            const uint32_t first_child = entry.node + 1;
+            const auto first = ray_box_entry(_nodes[first_child].minimum, _nodes[first_child].maximum, position, inverse, limit);
+            const auto second = ray_box_entry(_nodes[node.first].minimum, _nodes[node.first].maximum, position, inverse, limit);
+            if (first && second)
+            {
+                const bool first_nearer = first.value() <= second.value();
+                stack[size++] = first_nearer ? Entry{ node.first, second.value() } : Entry{ first_child, first.value() };
+                stack[size++] = first_nearer ? Entry{ first_child, first.value() } : Entry{ node.first, second.value() };
+            }
+            else if (first)
+            {
+                stack[size++] = { first_child, first.value() };
+            }
+            else if (second)
+            {
+                stack[size++] = { node.first, second.value() };
+            }
+        }
+    }
+
+    std::size_t BoundingBoxBvh::size() const
+    {
+        return _indices.size();
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cfloat>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <SimpleMath.h>
+
+namespace trview
+{
+    /// <summary>
+    /// Bounding volume hierarchy over a set of boxes, used to find the things a ray might hit without testing each of them.
+    /// Stored as a flat array of nodes in depth first order.
+    /// </summary>
+    class BoundingBoxBvh final
+    {
+    public:
+        /// <summary>
+        /// Called with the index of each box that the ray enters, nearer boxes first where the tree allows it. Returns the
+        /// distance beyond which no more boxes need to be visited.
+        /// </summary>
+        using Visitor = std::function<float(uint32_t index, float limit)>;
+
+        BoundingBoxBvh() = default;
+        explicit BoundingBoxBvh(const std::vector<DirectX::BoundingBox>& boxes);
+        /// <summary>
+        /// Visit the boxes along a ray.
+        /// </summary>
+        /// <param name="position">The start of the ray.</param>
+        /// <param name="direction">The normalised direction of the ray.</param>
+        /// <param name="visitor">Called for each box that the ray enters within the current limit.</param>
+        /// <param name="limit">The distance beyond which boxes are ignored from the start.</param>
+        void pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, const Visitor& visitor, float limit = FLT_MAX) const;
+        /// <summary>
+        /// Get the number of boxes in the hierarchy.
+        /// </summary>
+        std::size_t size() const;
+    private:
+        struct Node
+        {
+            DirectX::SimpleMath::Vector3 minimum;
+            /// First entry in _indices for a leaf, or the index of the second child. The first child follows this node.
+            uint32_t first{ 0 };
+            DirectX::SimpleMath::Vector3 maximum;
+            /// Number of boxes for a leaf, zero for other nodes.
+            uint32_t count{ 0 };
+        };
+
+        struct Bounds
+        {
+            DirectX::SimpleMath::Vector3 minimum;
+            DirectX::SimpleMath::Vector3 maximum;
+        };
+
+        void build(const std::vector<DirectX::BoundingBox>& boxes, uint32_t start, uint32_t end, uint32_t depth);
+
+        std::vector<Node> _nodes;
+        /// The original index of each box in leaf order.
+        std::vector<uint32_t> _indices;
+        /// The bounds of each box in leaf order.
+        std::vector<Bounds> _bounds;
+    };
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <stop_token>
+#include <vector>
 #include <trview.common/Event.h>
 
 #include "PickInfo.h"
@@ -11,13 +14,22 @@ namespace trview
 
     struct IPicking
     {
+        /// Part of a pick that runs on the picking thread. It must only use data that doesn't change, such as a PickScene,
+        /// and should return early when the stop token is triggered.
+        using Query = std::function<PickResult(const PickInfo&, std::stop_token)>;
+
         virtual ~IPicking() = 0;
 
         virtual void pick(const ICamera& camera) = 0;
+        /// Raise on_pick for the latest pick that has finished on the picking thread, if there is a new one.
+        virtual void update() = 0;
 
-        /// The sources of pick information.
+        /// The sources of pick information. These are called when the pick starts.
         Event<PickInfo, PickResult&> pick_sources;
 
+        /// The sources of queries to run on the picking thread, unless one of the pick_sources has stopped the pick.
+        Event<PickInfo, std::vector<Query>&> query_sources;
+
         /// Raise when something has been picked.
         Event<PickInfo, PickResult> on_pick;
     };
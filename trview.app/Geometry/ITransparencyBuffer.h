@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <trview.app/Geometry/TransparentTriangle.h>
 #include <trview.app/Camera/ICamera.h>
 
@@ -13,6 +14,10 @@ namespace trview
         // triangle: The triangle to add.
         virtual void add(const TransparentTriangle& triangle) = 0;
 
+        /// Add triangles to the end of the transparency buffer.
+        /// @param triangles The triangles to add.
+        virtual void add(std::span<const TransparentTriangle> triangles) = 0;
+
         // Sort the accumulated transparent triangles in order of farthest to
         // nearest, based on the position of the camera.
         // eye_position: The position of the camera.
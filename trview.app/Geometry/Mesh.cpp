@@ -12,7 +12,7 @@ namespace trview
         const std::vector<TransparentTriangle>& transparent_triangles,
         const std::vector<Triangle>& collision_triangles,
         const std::shared_ptr<ITextureStorage>& texture_storage)
-        : _device(device), _transparent_triangles(transparent_triangles), _collision_triangles(collision_triangles), _texture_storage(texture_storage)
+        : _device(device), _transparent_triangles(transparent_triangles), _collision(collision_triangles), _texture_storage(texture_storage)
     {
         if (!vertices.empty())
         {
@@ -83,7 +83,7 @@ namespace trview
     }
 
     Mesh::Mesh(const std::vector<TransparentTriangle>& transparent_triangles, const std::vector<Triangle>& collision_triangles)
-        : _transparent_triangles(transparent_triangles), _collision_triangles(collision_triangles)
+        : _transparent_triangles(transparent_triangles), _collision(collision_triangles)
     {
         calculate_bounding_box({}, transparent_triangles);
     }
@@ -209,21 +209,13 @@ namespace trview
 
     PickResult Mesh::pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
-        using namespace DirectX::TriangleTests;
-
         PickResult result;
         result.type = PickResult::Type::Mesh;
-        for (const auto& tri : _collision_triangles)
+        if (const auto hit = _collision.pick(position, direction))
         {
-            float distance = 0;
-            if (direction.Dot(tri.normal) < 0 &&
-                Intersects(position, direction, tri.v0, tri.v1, tri.v2, distance) &&
-                distance < result.distance)
-            {
-                result.hit = true;
-                result.distance = std::min(distance, result.distance);
-                result.triangle = tri;
-            }
+            result.hit = true;
+            result.distance = hit->distance;
+            result.triangle = _collision.triangles()[hit->triangle];
         }
 
         // Calculate the world space hit position, if there was a hit.
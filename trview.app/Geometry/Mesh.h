@@ -5,6 +5,7 @@
 #include <trlevel/LevelVersion.h>
 #include <trview.graphics/IDevice.h>
 #include "IMesh.h"
+#include "TriangleBvh.h"
 
 namespace trview
 {
@@ -19,7 +20,8 @@ namespace trview
         /// @param indices The indices for triangles that use level textures.
         /// @param untextured_indices The indices for triangles that do not use level textures.
         /// @param transparent_triangles The transparent triangles to use to create the mesh.
-        /// @param collision_triangles The triangles for picking.
+        /// @param collision_triangles The triangles for picking. The picking BVH is built from these here, so room meshes
+        /// build theirs on the main thread when they are uploaded.
         Mesh(const std::shared_ptr<graphics::IDevice>& device,
              const std::vector<MeshVertex>& vertices, 
              const std::vector<std::vector<uint32_t>>& indices, 
@@ -64,7 +66,7 @@ namespace trview
         Microsoft::WRL::ComPtr<ID3D11Buffer>              _untextured_index_buffer;
         uint32_t                                          _untextured_index_count{ 0u };
         std::vector<TransparentTriangle>                  _transparent_triangles;
-        std::vector<Triangle>                             _collision_triangles;
+        TriangleBvh                                       _collision;
         DirectX::BoundingBox                              _bounding_box;
         std::weak_ptr<ITextureStorage>                    _texture_storage;
     };
@@ -6,6 +6,7 @@ namespace trview
 {
     struct ITransparencyBuffer;
     struct IMesh;
+    class TransparentTriangleCache;
     struct IModel
     {
         using Source = std::function<std::shared_ptr<IModel>(const trlevel::tr_model&, const std::vector<std::shared_ptr<IMesh>>&, const std::vector<DirectX::SimpleMath::Matrix>&)>;
@@ -14,7 +15,15 @@ namespace trview
         virtual DirectX::BoundingBox bounding_box() const = 0;
         virtual PickResult pick(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
         virtual void render(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Matrix& view_projection, const DirectX::SimpleMath::Color& colour) = 0;
-        virtual void render_transparency(const DirectX::SimpleMath::Matrix& world, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour) = 0;
+        /// <summary>
+        /// Add the transparent triangles of the model. Models are shared by every item of the same type, so the caller
+        /// keeps the triangles transformed by its own world transform.
+        /// </summary>
+        /// <param name="world">The world transform for the model.</param>
+        /// <param name="transparency">The buffer to add the triangles to.</param>
+        /// <param name="colour">The colour for the triangles.</param>
+        /// <param name="caches">The caller's transformed triangles, one for each mesh. Resized to match the model.</param>
+        virtual void render_transparency(const DirectX::SimpleMath::Matrix& world, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour, std::vector<TransparentTriangleCache>& caches) = 0;
         virtual uint32_t type_id() const = 0;
     };
 }
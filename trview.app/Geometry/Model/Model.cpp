@@ -1,5 +1,6 @@
 #include "Model.h"
 #include "../ITransparencyBuffer.h"
+#include "../TransparentTriangleCache.h"
 
 namespace trview
 {
@@ -10,6 +11,10 @@ namespace trview
     Model::Model(const trlevel::tr_model& model, const std::vector<std::shared_ptr<IMesh>>& meshes, const std::vector<DirectX::SimpleMath::Matrix>& transforms)
         : _meshes(meshes), _world_transforms(transforms), _model(model)
     {
+        for (const auto& transform : _world_transforms)
+        {
+            _inverse_world_transforms.push_back(transform.Invert());
+        }
         generate_bounding_box();
     }
 
@@ -25,17 +30,17 @@ namespace trview
 
         std::vector<uint32_t> pick_meshes;
 
+        // Transform the position and the direction into model space once, each mesh then only needs its own transform.
+        const auto transform = world.Invert();
+        const auto model_position = Vector3::Transform(position, transform);
+        const auto model_direction = Vector3::TransformNormal(direction, transform);
+
         // Check each of the meshes in the object.
         for (uint32_t i = 0; i < _meshes.size(); ++i)
         {
-            // Transform the position and the direction into mesh space.
-            const auto transform = world.Invert();
-            const auto transformed_position = Vector3::Transform(position, transform);
-            const auto transformed_direction = Vector3::TransformNormal(direction, transform);
-
             // Try and pick against the bounding box.
             float obb_distance = 0;
-            if (_oriented_boxes[i].Intersects(transformed_position, transformed_direction, obb_distance))
+            if (_oriented_boxes[i].Intersects(model_position, model_direction, obb_distance))
             {
                 // Pick against the triangles in this mesh.
                 pick_meshes.push_back(i);
@@ -53,9 +58,8 @@ namespace trview
         for (auto i : pick_meshes)
         {
             // Transform the position and the direction into mesh space.
-            const auto transform = (_world_transforms[i] * world).Invert();
-            const auto transformed_position = Vector3::Transform(position, transform);
-            const auto transformed_direction = Vector3::TransformNormal(direction, transform);
+            const auto transformed_position = Vector3::Transform(model_position, _inverse_world_transforms[i]);
+            const auto transformed_direction = Vector3::TransformNormal(model_direction, _inverse_world_transforms[i]);
 
             // Pick against mesh.
             auto mesh_result = _meshes[i]->pick(transformed_position, transformed_direction);
@@ -79,14 +83,12 @@ namespace trview
         }
     }
 
-    void Model::render_transparency(const DirectX::SimpleMath::Matrix& world, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour)
+    void Model::render_transparency(const DirectX::SimpleMath::Matrix& world, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour, std::vector<TransparentTriangleCache>& caches)
     {
+        caches.resize(_meshes.size());
         for (uint32_t i = 0; i < _meshes.size(); ++i)
         {
-            for (const auto& triangle : _meshes[i]->transparent_triangles())
-            {
-                transparency.add(triangle.transform(_world_transforms[i] * world, colour, true));
-            }
+            caches[i].add(transparency, _meshes[i], _world_transforms[i] * world, colour, true);
         }
     }
 
@@ -162,16 +162,13 @@ namespace trview
     ModelStorage::ModelStorage(const std::shared_ptr<IMeshStorage>& mesh_storage,
         const IModel::Source& model_source,
         const trlevel::ILevel& level)
-        : _platform_and_version(level.platform_and_version())
+        : _mesh_storage(mesh_storage), _model_source(model_source), _platform_and_version(level.platform_and_version())
     {
-        load_models(mesh_storage, model_source, level);
+        load_models(level);
     }
 
-    void ModelStorage::load_models(const std::shared_ptr<IMeshStorage>& mesh_storage, const IModel::Source& model_source, const trlevel::ILevel& level)
+    void ModelStorage::load_models(const trlevel::ILevel& level)
     {
-
-        using namespace DirectX::SimpleMath;
-
         const auto version = level.platform_and_version();
         for (uint32_t i = 0; i < level.num_models(); ++i)
         {
@@ -181,18 +178,13 @@ namespace trview
                 continue;
             }
 
-            std::vector<std::shared_ptr<IMesh>> meshes;
-
+            std::vector<uint32_t> mesh_pointers;
             if (version.platform == trlevel::Platform::PSX && equals_any(version.version, trlevel::LevelVersion::Tomb4, trlevel::LevelVersion::Tomb5))
             {
                 const uint32_t end_pointer = static_cast<uint32_t>(model.StartingMesh + model.NumMeshes * 2);
                 for (uint32_t mesh_pointer = model.StartingMesh; mesh_pointer < end_pointer; mesh_pointer += 2)
                 {
-                    auto mesh = mesh_storage->mesh(mesh_pointer);
-                    if (mesh)
-                    {
-                        meshes.push_back(mesh);
-                    }
+                    mesh_pointers.push_back(mesh_pointer);
                 }
             }
             else
@@ -200,28 +192,37 @@ namespace trview
                 const uint32_t end_pointer = static_cast<uint32_t>(model.StartingMesh + model.NumMeshes);
                 for (uint32_t mesh_pointer = model.StartingMesh; mesh_pointer < end_pointer; ++mesh_pointer)
                 {
-                    auto mesh = mesh_storage->mesh(mesh_pointer);
-                    if (mesh)
-                    {
-                        meshes.push_back(mesh);
-                    }
+                    mesh_pointers.push_back(mesh_pointer);
                 }
             }
 
-            auto transforms = load_transforms(model, level);
-            _models.push_back(model_source(model, meshes, transforms));
+            _models.push_back({ .model = model, .mesh_pointers = std::move(mesh_pointers), .transforms = load_transforms(model, level) });
         }
     }
 
     std::weak_ptr<IModel> ModelStorage::find_by_type_id(uint16_t type_id) const
     {
         const uint16_t updated_type_id = get_skin_id(_platform_and_version, type_id);
-        for (const auto& model : _models)
+        for (const auto& entry : _models)
         {
-            if (model->type_id() == updated_type_id)
+            if (entry.model.ID != updated_type_id)
             {
-                return model;
+                continue;
+            }
+
+            if (!entry.created)
+            {
+                std::vector<std::shared_ptr<IMesh>> meshes;
+                for (const auto mesh_pointer : entry.mesh_pointers)
+                {
+                    if (auto mesh = _mesh_storage->mesh(mesh_pointer))
+                    {
+                        meshes.push_back(mesh);
+                    }
+                }
+                entry.created = _model_source(entry.model, meshes, entry.transforms);
             }
+            return entry.created;
         }
         return {};
     }
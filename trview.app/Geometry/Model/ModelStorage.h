@@ -8,6 +8,11 @@
 namespace trview
 {
     struct IMeshStorage;
+
+    /// <summary>
+    /// Models in the level. The frames and mesh pointers are read when the storage is created, but a model and its
+    /// meshes are only created the first time something looks it up.
+    /// </summary>
     class ModelStorage final : public IModelStorage
     {
     public:
@@ -17,11 +22,19 @@ namespace trview
         virtual ~ModelStorage() = default;
         std::weak_ptr<IModel> find_by_type_id(uint16_t type_id) const override;
     private:
-        void load_models(const std::shared_ptr<IMeshStorage>& mesh_storage, 
-            const IModel::Source& model_source,
-            const trlevel::ILevel& level);
+        struct Entry
+        {
+            trlevel::tr_model model;
+            std::vector<uint32_t> mesh_pointers;
+            std::vector<DirectX::SimpleMath::Matrix> transforms;
+            mutable std::shared_ptr<IModel> created;
+        };
+
+        void load_models(const trlevel::ILevel& level);
 
-        std::vector<std::shared_ptr<IModel>> _models;
+        std::shared_ptr<IMeshStorage> _mesh_storage;
+        IModel::Source _model_source;
+        std::vector<Entry> _models;
         trlevel::PlatformAndVersion _platform_and_version;
     };
 }
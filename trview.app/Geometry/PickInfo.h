@@ -12,5 +12,7 @@ namespace trview
         Point screen_position;
         DirectX::SimpleMath::Vector3 position;
         DirectX::SimpleMath::Vector3 direction;
+        /// Increases with each pick, so that a result can be matched to the mouse and camera state that produced it.
+        uint64_t sequence{ 0 };
     };
 }
@@ -0,0 +1,99 @@
+#include "PickScene.h"
+#include <algorithm>
+#include <optional>
+#include <ranges>
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    PickScene::PickScene(std::vector<PickTarget> targets)
+    {
+        std::erase_if(targets, [](const auto& target) { return !target.test; });
+        _targets = std::move(targets);
+    }
+
+    const BoundingBoxBvh& PickScene::hierarchy() const
+    {
+        std::call_once(_index_built, [this]()
+            {
+                _index = BoundingBoxBvh(_targets | std::views::transform([](const auto& target) { return target.bounds; }) | std::ranges::to<std::vector>());
+            });
+        return _index;
+    }
+
+    PickResult PickScene::pick(const Vector3& position, const Vector3& direction, std::stop_token stop) const
+    {
+        return pick(position, direction, nullptr, stop);
+    }
+
+    PickResult PickScene::pick(const Vector3& position, const Vector3& direction, const DirectX::BoundingFrustum& frustum, std::stop_token stop) const
+    {
+        return pick(position, direction, &frustum, stop);
+    }
+
+    PickResult PickScene::pick(const Vector3& position, const Vector3& direction, const DirectX::BoundingFrustum* frustum, std::stop_token stop) const
+    {
+        std::vector<PickResult> results;
+        hierarchy().pick(position, direction,
+            [&](uint32_t index, float limit)
+            {
+                // A negative limit is nearer than every box, so this ends the search.
+                if (stop.stop_requested())
+                {
+                    return -1.0f;
+                }
+
+                // Only what the camera can see can be picked, so nothing past the far plane is hit.
+                if (frustum && !frustum->Intersects(_targets[index].bounds))
+                {
+                    return limit;
+                }
+
+                auto result = _targets[index].test(position, direction);
+                if (result.hit)
+                {
+                    results.push_back(result);
+                    // Nothing beyond the first room hit can be chosen, so there is no need to look any further.
+                    if (result.type == PickResult::Type::Room)
+                    {
+                        limit = std::min(limit, result.distance);
+                    }
+                }
+                return limit;
+            });
+
+        if (stop.stop_requested())
+        {
+            return {};
+        }
+
+        std::sort(results.begin(), results.end(), [](const auto& l, const auto& r) { return l.distance < r.distance; });
+
+        std::optional<PickResult> actual_result;
+        if (!results.empty())
+        {
+            actual_result = results.front();
+        }
+
+        for (const auto& result : results)
+        {
+            if (result.type == PickResult::Type::Room)
+            {
+                return actual_result.value_or(result);
+            }
+
+            if (result.type == PickResult::Type::Entity)
+            {
+                actual_result = result;
+            }
+        }
+
+        return actual_result.value_or(PickResult {});
+    }
+
+    std::size_t PickScene::size() const
+    {
+        return _targets.size();
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <mutex>
+#include <stop_token>
+#include <vector>
+#include "BoundingBoxBvh.h"
+#include "PickTarget.h"
+
+namespace trview
+{
+    /// <summary>
+    /// A fixed set of pick targets with a hierarchy over their bounds. A scene is never changed after it is built, so it can
+    /// be picked on the picking thread while the level it came from carries on changing. The hierarchy is built by the
+    /// first pick, which is usually on the picking thread, so making a scene doesn't hold up the frame.
+    /// </summary>
+    class PickScene final
+    {
+    public:
+        PickScene() = default;
+        /// <summary>
+        /// Create a scene from a set of targets. Targets without a test are dropped.
+        /// </summary>
+        explicit PickScene(std::vector<PickTarget> targets);
+        /// <summary>
+        /// Find what a ray hits. This is the nearest hit unless there are entities in front of the first room hit, in which
+        /// case it is the last of those entities.
+        /// </summary>
+        /// <param name="position">The start of the ray.</param>
+        /// <param name="direction">The normalised direction of the ray.</param>
+        /// <param name="stop">Stops the search early, in which case there is no hit.</param>
+        /// <returns>The pick result.</returns>
+        PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, std::stop_token stop = {}) const;
+        /// <summary>
+        /// Find what a ray hits, ignoring targets that are outside the view of the camera.
+        /// </summary>
+        /// <param name="position">The start of the ray.</param>
+        /// <param name="direction">The normalised direction of the ray.</param>
+        /// <param name="frustum">The camera frustum. Targets whose bounds are outside it can't be hit.</param>
+        /// <param name="stop">Stops the search early, in which case there is no hit.</param>
+        /// <returns>The pick result.</returns>
+        PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, const DirectX::BoundingFrustum& frustum, std::stop_token stop = {}) const;
+        /// <summary>
+        /// Get the number of targets in the scene.
+        /// </summary>
+        std::size_t size() const;
+    private:
+        const BoundingBoxBvh& hierarchy() const;
+        PickResult pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, const DirectX::BoundingFrustum* frustum, std::stop_token stop) const;
+
+        std::vector<PickTarget> _targets;
+        mutable std::once_flag _index_built;
+        mutable BoundingBoxBvh _index;
+    };
+}
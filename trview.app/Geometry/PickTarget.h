@@ -0,0 +1,27 @@
+#pragma once
+
+#include <functional>
+#include <DirectXCollision.h>
+#include <SimpleMath.h>
+#include "PickResult.h"
+
+namespace trview
+{
+    /// <summary>
+    /// A copy of everything needed to pick one thing. Only holds values and geometry that doesn't change after loading, so
+    /// it can be used from the picking thread while the original carries on changing.
+    /// </summary>
+    struct PickTarget
+    {
+        using Test = std::function<PickResult(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction)>;
+
+        /// <summary>
+        /// World space bounds that contain everything the test can hit.
+        /// </summary>
+        DirectX::BoundingBox bounds;
+        /// <summary>
+        /// Test a ray against the target. Empty if there is nothing to pick.
+        /// </summary>
+        Test test;
+    };
+}
@@ -0,0 +1,76 @@
+#include "PickWorker.h"
+#include <utility>
+
+namespace trview
+{
+    PickWorker::PickWorker()
+        : _thread([this](std::stop_token thread_stop) { run(thread_stop); })
+    {
+    }
+
+    PickWorker::~PickWorker()
+    {
+        // The thread is joined when it is destroyed, so make sure it isn't still busy with a query.
+        cancel();
+    }
+
+    void PickWorker::submit(const PickInfo& info, const PickResult& result, std::vector<IPicking::Query> queries)
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _current.request_stop();
+            _pending = Request{ info, result, std::move(queries) };
+        }
+        _condition.notify_one();
+    }
+
+    void PickWorker::cancel()
+    {
+        std::lock_guard lock(_mutex);
+        _current.request_stop();
+        _pending.reset();
+        _completed.reset();
+    }
+
+    std::optional<PickWorker::Completed> PickWorker::take()
+    {
+        std::lock_guard lock(_mutex);
+        return std::exchange(_completed, std::nullopt);
+    }
+
+    void PickWorker::run(std::stop_token thread_stop)
+    {
+        while (true)
+        {
+            std::optional<Request> request;
+            std::stop_token stop;
+            {
+                std::unique_lock lock(_mutex);
+                if (!_condition.wait(lock, thread_stop, [&] { return _pending.has_value(); }))
+                {
+                    return;
+                }
+                request = std::exchange(_pending, std::nullopt);
+                _current = std::stop_source();
+                stop = _current.get_token();
+            }
+
+            PickResult result = request->result;
+            for (const auto& query : request->queries)
+            {
+                if (stop.stop_requested())
+                {
+                    break;
+                }
+                result = nearest_result(result, query(request->info, stop));
+            }
+
+            // A pick that was cancelled while it was running has been replaced, so its result is dropped.
+            std::lock_guard lock(_mutex);
+            if (!stop.stop_requested())
+            {
+                _completed = Completed{ request->info, result };
+            }
+        }
+    }
+}
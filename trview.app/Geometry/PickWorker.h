@@ -0,0 +1,65 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+#include "IPicking.h"
+
+namespace trview
+{
+    /// <summary>
+    /// Runs pick queries on a background thread. Only the latest pick matters, so submitting a pick cancels the one that
+    /// is in progress and replaces any that hasn't started yet.
+    /// </summary>
+    class PickWorker final
+    {
+    public:
+        /// <summary>
+        /// A pick that has finished on the picking thread.
+        /// </summary>
+        struct Completed
+        {
+            PickInfo info;
+            PickResult result;
+        };
+
+        PickWorker();
+        ~PickWorker();
+        PickWorker(const PickWorker&) = delete;
+        PickWorker& operator=(const PickWorker&) = delete;
+        /// <summary>
+        /// Start a pick, cancelling the one in progress.
+        /// </summary>
+        /// <param name="info">The pick being made.</param>
+        /// <param name="result">The result so far, which the query results are compared against.</param>
+        /// <param name="queries">The queries to run.</param>
+        void submit(const PickInfo& info, const PickResult& result, std::vector<IPicking::Query> queries);
+        /// <summary>
+        /// Cancel the pick in progress and discard any finished pick that hasn't been taken yet.
+        /// </summary>
+        void cancel();
+        /// <summary>
+        /// Get the latest finished pick, if one has finished since the last call.
+        /// </summary>
+        std::optional<Completed> take();
+    private:
+        struct Request
+        {
+            PickInfo info;
+            PickResult result;
+            std::vector<IPicking::Query> queries;
+        };
+
+        void run(std::stop_token thread_stop);
+
+        std::mutex _mutex;
+        std::condition_variable_any _condition;
+        std::optional<Request> _pending;
+        std::stop_source _current;
+        std::optional<Completed> _completed;
+        std::jthread _thread;
+    };
+}
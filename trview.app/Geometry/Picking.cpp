@@ -27,6 +27,7 @@ namespace trview
         {
             PickResult empty;
             empty.stop = true;
+            _worker.cancel();
             on_pick({}, empty);
             return;
         }
@@ -44,10 +45,33 @@ namespace trview
             window_size.width, window_size.height, 0.1f, 10000.0f, projection, view, world);
 
         // Call the registered pickers.
-        PickInfo info{ camera.view_size(), mouse_pos, position, direction };
+        PickInfo info{ camera.view_size(), mouse_pos, position, direction, ++_sequence };
         PickResult result{};
         pick_sources(info, result);
 
-        on_pick(info, result);
+        std::vector<Query> queries;
+        if (!result.stop)
+        {
+            query_sources(info, queries);
+        }
+
+        if (queries.empty())
+        {
+            _worker.cancel();
+            on_pick(info, result);
+            return;
+        }
+
+        _worker.submit(info, result, std::move(queries));
+    }
+
+    void Picking::update()
+    {
+        // A pick can finish just before the next one is submitted, so a result from an older pick than the last one
+        // started is out of date and is dropped.
+        if (auto completed = _worker.take(); completed && completed->info.sequence == _sequence)
+        {
+            on_pick(completed->info, completed->result);
+        }
     }
 }
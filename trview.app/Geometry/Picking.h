@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IPicking.h"
+#include "PickWorker.h"
 
 namespace trview
 {
@@ -12,11 +13,14 @@ namespace trview
         explicit Picking(const Window& window);
 
         /// <summary>
-        /// Perform a pick operation.
+        /// Start a pick operation. Queries are run on the picking thread and the result is raised by a later call to update.
         /// </summary>
         /// <param name="camera">The current scene camera.</param>
         virtual void pick(const ICamera& camera) override;
+        void update() override;
     private:
         Window _window;
+        uint64_t _sequence{ 0 };
+        PickWorker _worker;
     };
 }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <optional>
+#include <SimpleMath.h>
+
+namespace trview
+{
+    /// <summary>
+    /// Get the reciprocal of a ray direction for use with ray_box_entry. Zero components are replaced with a large value so
+    /// that the slab test never multiplies zero by infinity.
+    /// </summary>
+    inline DirectX::SimpleMath::Vector3 inverse_direction(const DirectX::SimpleMath::Vector3& direction)
+    {
+        const auto inverse = [](float value) { return value != 0 ? 1.0f / value : FLT_MAX; };
+        return { inverse(direction.x), inverse(direction.y), inverse(direction.z) };
+    }
+
+    /// <summary>
+    /// Find where a ray enters an axis aligned box.
+    /// </summary>
+    /// <param name="minimum">The minimum corner of the box.</param>
+    /// <param name="maximum">The maximum corner of the box.</param>
+    /// <param name="position">The start of the ray.</param>
+    /// <param name="inverse">The result of inverse_direction for the ray direction.</param>
+    /// <param name="limit">The distance beyond which the box is treated as missed.</param>
+    /// <returns>The distance to the box, or zero if the ray starts inside it. Empty if the ray misses.</returns>
+    inline std::optional<float> ray_box_entry(
+        const DirectX::SimpleMath::Vector3& minimum,
+        const DirectX::SimpleMath::Vector3& maximum,
+        const DirectX::SimpleMath::Vector3& position,
+        const DirectX::SimpleMath::Vector3& inverse,
+        float limit)
+    {
+        // Rounding can make a ray that grazes the box miss it, so the exit distance is extended slightly.
+        constexpr float ExitScale = 1.0000008f;
+        const float x0 = (minimum.x - position.x) * inverse.x;
+        const float x1 = (maximum.x - position.x) * inverse.x;
+        const float y0 = (minimum.y - position.y) * inverse.y;
+        const float y1 = (maximum.y - position.y) * inverse.y;
+        const float z0 = (minimum.z - position.z) * inverse.z;
+        const float z1 = (maximum.z - position.z) * inverse.z;
+        const float near_distance = std::max({ std::min(x0, x1), std::min(y0, y1), std::min(z0, z1), 0.0f });
+        const float far_distance = std::min({ std::max(x0, x1), std::max(y0, y1), std::max(z0, z1) }) * ExitScale;
+        if (near_distance > far_distance || near_distance > limit)
+        {
+            return std::nullopt;
+        }
+        return near_distance;
+    }
+}
@@ -67,14 +67,19 @@ namespace trview
         _triangles.push_back(triangle);
     }
 
+    void TransparencyBuffer::add(std::span<const TransparentTriangle> triangles)
+    {
+        _triangles.insert(_triangles.end(), triangles.begin(), triangles.end());
+    }
+
     void TransparencyBuffer::sort(const Vector3& eye_position)
     {
-        std::sort(_triangles.begin(), _triangles.end(),
-            [&eye_position](const auto& l, const auto& r)
+        _distances.resize(_triangles.size());
+        for (std::size_t i = 0; i < _triangles.size(); ++i)
         {
-            return Vector3::DistanceSquared(eye_position, l.position) > Vector3::DistanceSquared(eye_position, r.position);
-        });
-        complete();
+            _distances[i] = Vector3::DistanceSquared(eye_position, _triangles[i].position);
+        }
+        complete(_sort.sort(_distances));
     }
 
     void TransparencyBuffer::render(const ICamera& camera, bool ignore_blend)
@@ -178,7 +183,7 @@ namespace trview
         _matrix_buffer = _device->create_buffer(matrix_desc, std::optional<D3D11_SUBRESOURCE_DATA>());
     }
 
-    void TransparencyBuffer::complete()
+    void TransparencyBuffer::complete(const std::vector<uint32_t>& order)
     {
         // Convert the triangles into mesh vertexes.
         // Also will have to capture the runs of textures.
@@ -187,8 +192,9 @@ namespace trview
         _texture_run.clear();
 
         std::size_t index = 0;
-        for (const auto& triangle : _triangles)
+        for (const auto i : order)
         {
+            const auto& triangle = _triangles[i];
             if (_texture_run.empty() ||
                 _texture_run.back().texture != triangle.texture || 
                 _texture_run.back().mode != triangle.mode) 
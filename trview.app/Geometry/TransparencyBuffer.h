@@ -8,6 +8,7 @@
 #include <trview.graphics/IDevice.h>
 #include <trview.graphics/Texture.h>
 #include "ITransparencyBuffer.h"
+#include "TransparencySort.h"
 
 namespace trview
 {
@@ -28,6 +29,10 @@ namespace trview
         // triangle: The triangle to add.
         void add(const TransparentTriangle& triangle) override;
 
+        /// Add triangles to the end of the transparency buffer.
+        /// @param triangles The triangles to add.
+        void add(std::span<const TransparentTriangle> triangles) override;
+
         // Sort the accumulated transparent triangles in order of farthest to
         // nearest, based on the position of the camera.
         // eye_position: The position of the camera.
@@ -44,7 +49,7 @@ namespace trview
     private:
         void create_buffer();
         void create_matrix_buffer();
-        void complete();
+        void complete(const std::vector<uint32_t>& order);
         void set_blend_mode(const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& context, TransparentTriangle::Mode mode) const;
 
         std::shared_ptr<graphics::IDevice> _device;
@@ -55,6 +60,8 @@ namespace trview
         Microsoft::WRL::ComPtr<ID3D11DepthStencilState> _transparency_depth_state;
 
         std::vector<TransparentTriangle> _triangles;
+        std::vector<float> _distances;
+        TransparencySort _sort;
         std::vector<MeshVertex> _vertices;
 
         struct TextureRun
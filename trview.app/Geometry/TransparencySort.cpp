@@ -0,0 +1,129 @@
+#include "TransparencySort.h"
+#include <array>
+#include <bit>
+
+namespace trview
+{
+    namespace
+    {
+        constexpr uint32_t RadixBits = 11;
+        constexpr uint32_t Buckets = 1 << RadixBits;
+        constexpr uint32_t Passes = 3;
+        // The previous order is abandoned once the insertion sort has moved triangles this far on average, as the
+        // radix sort is faster from around here.
+        constexpr std::size_t MaxMovesPerTriangle = 4;
+
+        /// Map a distance to a key that sorts farthest first as an unsigned integer.
+        uint64_t entry(float distance, uint32_t index)
+        {
+            const uint32_t bits = std::bit_cast<uint32_t>(distance);
+            const uint32_t ascending = bits ^ ((bits & 0x80000000u) ? 0xffffffffu : 0x80000000u);
+            return (static_cast<uint64_t>(~ascending) << 32) | index;
+        }
+
+        uint32_t digit(uint64_t entry, uint32_t pass)
+        {
+            return static_cast<uint32_t>(entry >> (32 + pass * RadixBits)) & (Buckets - 1);
+        }
+    }
+
+    const std::vector<uint32_t>& TransparencySort::sort(std::span<const float> distances)
+    {
+        _refined = refine(distances);
+        if (!_refined)
+        {
+            radix_sort(distances);
+        }
+
+        _order.resize(distances.size());
+        for (std::size_t i = 0; i < _entries.size(); ++i)
+        {
+            _order[i] = static_cast<uint32_t>(_entries[i]);
+        }
+        return _order;
+    }
+
+    bool TransparencySort::refined() const
+    {
+        return _refined;
+    }
+
+    bool TransparencySort::refine(std::span<const float> distances)
+    {
+        if (distances.empty() || _order.size() != distances.size())
+        {
+            return false;
+        }
+
+        _entries.resize(distances.size());
+        for (std::size_t i = 0; i < _order.size(); ++i)
+        {
+            _entries[i] = entry(distances[_order[i]], _order[i]);
+        }
+
+        const std::size_t max_moves = distances.size() * MaxMovesPerTriangle;
+        std::size_t moves = 0;
+        for (std::size_t i = 1; i < _entries.size(); ++i)
+        {
+            const uint64_t value = _entries[i];
+            std::size_t j = i;
+            while (j > 0 && _entries[j - 1] > value)
+            {
+                _entries[j] = _entries[j - 1];
+                --j;
+            }
+            _entries[j] = value;
+
+            moves += i - j;
+            if (moves > max_moves)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void TransparencySort::radix_sort(std::span<const float> distances)
+    {
+        _entries.resize(distances.size());
+        _scratch.resize(distances.size());
+        if (distances.empty())
+        {
+            return;
+        }
+
+        std::array<std::array<uint32_t, Buckets>, Passes> counts{};
+        for (uint32_t i = 0; i < distances.size(); ++i)
+        {
+            _entries[i] = entry(distances[i], i);
+            for (uint32_t pass = 0; pass < Passes; ++pass)
+            {
+                ++counts[pass][digit(_entries[i], pass)];
+            }
+        }
+
+        for (uint32_t pass = 0; pass < Passes; ++pass)
+        {
+            // Every entry has the same digit, so this pass wouldn't move anything.
+            auto& count = counts[pass];
+            if (count[digit(_entries[0], pass)] == distances.size())
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (auto& bucket : count)
+            {
+                const uint32_t size = bucket;
+                bucket = offset;
+                offset += size;
+            }
+
+            for (const uint64_t value : _entries)
+            {
+                _scratch[count[digit(value, pass)]++] = value;
+            }
+            std::swap(_entries, _scratch);
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace trview
+{
+    /// <summary>
+    /// Orders transparent triangles from farthest to nearest. The previous order is kept and, while the camera moves
+    /// smoothly, only needs a few changes which an insertion sort makes quickly. Otherwise the distances are radix sorted.
+    /// </summary>
+    class TransparencySort final
+    {
+    public:
+        /// <summary>
+        /// Sort triangles by distance, farthest first. Triangles at the same distance stay in the order they were given.
+        /// </summary>
+        /// <param name="distances">The distance (or squared distance) of each triangle from the camera.</param>
+        /// <returns>The indices of the triangles in the order to render them.</returns>
+        const std::vector<uint32_t>& sort(std::span<const float> distances);
+        /// <summary>
+        /// Whether the last sort was made by fixing up the previous order.
+        /// </summary>
+        bool refined() const;
+    private:
+        bool refine(std::span<const float> distances);
+        void radix_sort(std::span<const float> distances);
+
+        /// Sort key in the upper half and triangle index in the lower half, so that comparing entries also keeps
+        /// triangles at the same distance in order.
+        std::vector<uint64_t> _entries;
+        std::vector<uint64_t> _scratch;
+        std::vector<uint32_t> _order;
+        bool _refined{ false };
+    };
+}
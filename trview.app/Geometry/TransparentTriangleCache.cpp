@@ -0,0 +1,31 @@
+#include "TransparentTriangleCache.h"
+#include "IMesh.h"
+#include "ITransparencyBuffer.h"
+
+namespace trview
+{
+    void TransparentTriangleCache::add(ITransparencyBuffer& transparency, const std::shared_ptr<IMesh>& mesh, const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Color& colour, bool use_colour_override)
+    {
+        if (!mesh)
+        {
+            return;
+        }
+
+        // Comparing owners rather than addresses means a new mesh at the address of a destroyed one is still noticed.
+        const bool same_mesh = !_mesh.owner_before(mesh) && !mesh.owner_before(_mesh);
+        if (!same_mesh || world != _world || colour != _colour || use_colour_override != _use_colour_override)
+        {
+            _mesh = mesh;
+            _world = world;
+            _colour = colour;
+            _use_colour_override = use_colour_override;
+            _triangles.clear();
+            for (const auto& triangle : mesh->transparent_triangles())
+            {
+                _triangles.push_back(triangle.transform(world, colour, use_colour_override));
+            }
+        }
+
+        transparency.add(_triangles);
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <SimpleMath.h>
+#include "TransparentTriangle.h"
+
+namespace trview
+{
+    struct IMesh;
+    struct ITransparencyBuffer;
+
+    /// <summary>
+    /// The transparent triangles of a mesh in world space. They are only transformed again when the mesh, the transform
+    /// or the colour changes, so that collecting transparent triangles again is just a copy.
+    /// </summary>
+    class TransparentTriangleCache final
+    {
+    public:
+        /// <summary>
+        /// Add the transformed triangles to a transparency buffer, transforming them first if anything has changed.
+        /// </summary>
+        /// <param name="transparency">The buffer to add the triangles to.</param>
+        /// <param name="mesh">The mesh with the triangles.</param>
+        /// <param name="world">The world transform for the mesh.</param>
+        /// <param name="colour">The colour to use when use_colour_override is set.</param>
+        /// <param name="use_colour_override">Whether to use the colour instead of the triangle colours.</param>
+        void add(ITransparencyBuffer& transparency, const std::shared_ptr<IMesh>& mesh, const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Color& colour, bool use_colour_override);
+    private:
+        std::weak_ptr<IMesh> _mesh;
+        DirectX::SimpleMath::Matrix _world;
+        DirectX::SimpleMath::Color _colour;
+        bool _use_colour_override{ false };
+        std::vector<TransparentTriangle> _triangles;
+    };
+}
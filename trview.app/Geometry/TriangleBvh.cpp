@@ -0,0 +1,296 @@
+#include "TriangleBvh.h"
+#include "RayBox.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <DirectXCollision.h>
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace
+    {
+        // One packet, so that a leaf is tested all at once.
+        constexpr uint32_t MaxLeafSize = TrianglePacket::Width;
+        // Leaves are forced at this depth, which keeps the traversal stack a fixed size.
+        constexpr uint32_t MaxDepth = 48;
+        constexpr uint32_t Bins = 12;
+        // Relative cost of visiting a node compared to testing a triangle.
+        constexpr float TraversalCost = 1.0f;
+
+        float component(const Vector3& v, uint32_t axis)
+        {
+            return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+        }
+    }
+
+    void TriangleBvh::Bounds::add(const Vector3& point)
+    {
+        minimum = Vector3::Min(minimum, point);
+        maximum = Vector3::Max(maximum, point);
+    }
+
+    void TriangleBvh::Bounds::add(const Bounds& other)
+    {
+        minimum = Vector3::Min(minimum, other.minimum);
+        maximum = Vector3::Max(maximum, other.maximum);
+    }
+
+    float TriangleBvh::Bounds::area() const
+    {
+        const Vector3 size = maximum - minimum;
+        return size.x < 0 ? 0.0f : 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    TriangleBvh::TriangleBvh(const std::vector<Triangle>& triangles)
+    {
+        if (triangles.empty())
+        {
+            return;
+        }
+
+        Build state;
+        state.bounds.resize(triangles.size());
+        state.centroids.resize(triangles.size());
+        state.order.resize(triangles.size());
+        for (uint32_t i = 0; i < triangles.size(); ++i)
+        {
+            const auto& triangle = triangles[i];
+            state.bounds[i].add(triangle.v0);
+            state.bounds[i].add(triangle.v1);
+            state.bounds[i].add(triangle.v2);
+            state.centroids[i] = (state.bounds[i].minimum + state.bounds[i].maximum) * 0.5f;
+            state.order[i] = i;
+        }
+
+        _nodes.reserve(triangles.size() * 2 / MaxLeafSize + 1);
+        build(state, 0, static_cast<uint32_t>(triangles.size()), 0);
+
+        _triangles.reserve(triangles.size());
+        for (const auto index : state.order)
+        {
+            _triangles.push_back(triangles[index]);
+        }
+        _order = std::move(state.order);
+
+        for (auto& node : _nodes)
+        {
+            if (node.count == 0)
+            {
+                continue;
+            }
+
+            const uint32_t first_packet = static_cast<uint32_t>(_packets.size());
+            pack_triangles(std::span(_triangles).subspan(node.first, node.count), _packets);
+            for (uint32_t first = node.first; _packet_first.size() < _packets.size(); first += TrianglePacket::Width)
+            {
+                _packet_first.push_back(first);
+            }
+            node.first = first_packet;
+        }
+    }
+
+    void TriangleBvh::build(Build& state, uint32_t start, uint32_t end, uint32_t depth)
+    {
+        const uint32_t node_index = static_cast<uint32_t>(_nodes.size());
+        _nodes.push_back({});
+
+        Bounds bounds;
+        Bounds centroid_bounds;
+        for (uint32_t i = start; i < end; ++i)
+        {
+            bounds.add(state.bounds[state.order[i]]);
+            centroid_bounds.add(state.centroids[state.order[i]]);
+        }
+        _nodes[node_index].minimum = bounds.minimum;
+        _nodes[node_index].maximum = bounds.maximum;
+
+        const uint32_t count = end - start;
+        const auto make_leaf = [&]()
+            {
+                _nodes[node_index].first = start;
+                _nodes[node_index].count = count;
+            };
+
+        if (count <= MaxLeafSize || depth >= MaxDepth)
+        {
+            return make_leaf();
+        }
+
+        // Find the cheapest split between bins of centroids on any axis.
+        struct Bin
+        {
+            Bounds bounds;
+            uint32_t count{ 0 };
+        };
+
+        float best_cost = FLT_MAX;
+        uint32_t best_axis = 0;
+        uint32_t best_split = 0;
+        for (uint32_t axis = 0; axis < 3; ++axis)
+        {
+            const float axis_minimum = component(centroid_bounds.minimum, axis);
+            const float extent = component(centroid_bounds.maximum, axis) - axis_minimum;
+            if (extent <= 0)
+            {
+                continue;
+            }
+
+            std::array<Bin, Bins> bins;
+            const float scale = Bins / extent;
+            for (uint32_t i = start; i < end; ++i)
+            {
+                const auto index = state.order[i];
+                const auto bin = std::min(Bins - 1, static_cast<uint32_t>((component(state.centroids[index], axis) - axis_minimum) * scale));
+                bins[bin].bounds.add(state.bounds[index]);
+                ++bins[bin].count;
+            }
+
+            // Sweep from the right to get the cost of everything after each split, then from the left.
+            std::array<float, Bins> right_costs{};
+            Bounds right;
+            uint32_t right_count = 0;
+            for (uint32_t b = Bins - 1; b > 0; --b)
+            {
+                right.add(bins[b].bounds);
+                right_count += bins[b].count;
+                right_costs[b] = right.area() * right_count;
+            }
+
+            Bounds left;
+            uint32_t left_count = 0;
+            for (uint32_t split = 1; split < Bins; ++split)
+            {
+                left.add(bins[split - 1].bounds);
+                left_count += bins[split - 1].count;
+                if (left_count == 0 || left_count == count)
+                {
+                    continue;
+                }
+
+                const float cost = left.area() * left_count + right_costs[split];
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = split;
+                }
+            }
+        }
+
+        // All centroids in the same place, or splitting costs more than testing every triangle here.
+        const float parent_area = bounds.area();
+        if (best_cost == FLT_MAX ||
+            (parent_area > 0 && TraversalCost + best_cost / parent_area >= count && count <= MaxLeafSize * 4))
+        {
+            return make_leaf();
+        }
+
+        const float axis_minimum = component(centroid_bounds.minimum, best_axis);
+        const float scale = Bins / (component(centroid_bounds.maximum, best_axis) - axis_minimum);
+        const auto middle = std::partition(state.order.begin() + start, state.order.begin() + end, [&](uint32_t index)
+            {
+                return std::min(Bins - 1, static_cast<uint32_t>((component(state.centroids[index], best_axis) - axis_minimum) * scale)) < best_split;
+            });
+        const uint32_t split = static_cast<uint32_t>(middle - state.order.begin());
+        if (split == start || split == end)
+        {
+            return make_leaf();
+        }
+
+        build(state, start, split, depth + 1);
+        _nodes[node_index].first = static_cast<uint32_t>(_nodes.size());
+        build(state, split, end, depth + 1);
+    }
+
+    std::optional<TriangleBvh::Hit> TriangleBvh::pick(const Vector3& position, const Vector3& direction) const
+    {
+        if (_nodes.empty())
+        {
+            return std::nullopt;
+        }
+
+        const Vector3 inverse = inverse_direction(direction);
+
+        std::optional<Hit> result;
+        float best = FLT_MAX;
+        uint32_t best_order = UINT32_MAX;
+
+        struct Entry
+        {
+            uint32_t node;
+            float distance;
+        };
+        std::array<Entry, MaxDepth + 2> stack;
+        uint32_t size = 0;
+
+        if (const auto distance = ray_box_entry(_nodes[0].minimum, _nodes[0].maximum, position, inverse, best))
+        {
+            stack[size++] = { 0, distance.value() };
+        }
+
+        while (size > 0)
+        {
+            const auto entry = stack[--size];
+            if (entry.distance > best)
+            {
+                continue;
+            }
+
+            const auto& node = _nodes[entry.node];
+            if (node.count > 0)
+            {
+                const uint32_t packets = (node.count + TrianglePacket::Width - 1) / TrianglePacket::Width;
+                for (uint32_t packet = node.first; packet < node.first + packets; ++packet)
+                {
+                    TrianglePacket::Lanes distances;
+                    for (uint32_t hits = intersect_packet(_packets[packet], position, direction, best, distances); hits; hits &= hits - 1)
+                    {
+                        const uint32_t lane = std::countr_zero(hits);
+                        const uint32_t i = _packet_first[packet] + lane;
+                        const float distance = distances[lane];
+                        if (distance < best || (distance == best && _order[i] < best_order))
+                        {
+                            best = distance;
+                            best_order = _order[i];
+                            result = { .distance = distance, .triangle = i };
+                        }
+                    }
+                }
+                continue;
+            }
+
+            // Visit the nearer child first so that hits in it can rule out the other.
+            const uint32_t first_child = entry.node + 1;
+            const auto first = ray_box_entry(_nodes[first_child].minimum, _nodes[first_child].maximum, position, inverse, best);
+            const auto second = ray_box_entry(_nodes[node.first].minimum, _nodes[node.first].maximum, position, inverse, best);
+            if (first && second)
+            {
+                const bool first_nearer = first.value() <= second.value();
+                stack[size++] = first_nearer ? Entry{ node.first, second.value() } : Entry{ first_child, first.value() };
+                stack[size++] = first_nearer ? Entry{ first_child, first.value() } : Entry{ node.first, second.value() };
+            }
+            else if (first)
+            {
+                stack[size++] = { first_child, first.value() };
+            }
+            else if (second)
+            {
+                stack[size++] = { node.first, second.value() };
+            }
+        }
+
+        return result;
+    }
+
+    const std::vector<Triangle>& TriangleBvh::triangles() const
+    {
+        return _triangles;
+    }
+
+    std::size_t TriangleBvh::node_count() const
+    {
+        return _nodes.size();
+    }
+}
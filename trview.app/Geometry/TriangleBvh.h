@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cfloat>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <SimpleMath.h>
+#include "Triangle.h"
+#include "TrianglePacket.h"
+
+namespace trview
+{
+    /// <summary>
+    /// Bounding volume hierarchy over a set of triangles for ray picking. The tree is built with binned surface area
+    /// heuristic splits and stored as a flat array of nodes in depth first order. The triangles in each leaf are packed
+    /// so that the whole leaf is tested at once.
+    /// </summary>
+    class TriangleBvh final
+    {
+    public:
+        struct Hit
+        {
+            float distance;
+            /// Index into triangles().
+            uint32_t triangle;
+        };
+
+        TriangleBvh() = default;
+        explicit TriangleBvh(const std::vector<Triangle>& triangles);
+        /// <summary>
+        /// Find the nearest front facing triangle hit by a ray. This gives the same result as testing every triangle in
+        /// the order they were given to the constructor.
+        /// </summary>
+        /// <param name="position">The start of the ray.</param>
+        /// <param name="direction">The normalised direction of the ray.</param>
+        /// <returns>The nearest hit, if there was one.</returns>
+        std::optional<Hit> pick(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const;
+        /// <summary>
+        /// Get the triangles in the order used by the tree.
+        /// </summary>
+        const std::vector<Triangle>& triangles() const;
+        std::size_t node_count() const;
+    private:
+        struct Node
+        {
+            DirectX::SimpleMath::Vector3 minimum;
+            /// First packet for a leaf, or the index of the second child. The first child follows this node.
+            uint32_t first{ 0 };
+            DirectX::SimpleMath::Vector3 maximum;
+            /// Number of triangles for a leaf, zero for other nodes.
+            uint32_t count{ 0 };
+        };
+
+        struct Bounds
+        {
+            DirectX::SimpleMath::Vector3 minimum{ FLT_MAX, FLT_MAX, FLT_MAX };
+            DirectX::SimpleMath::Vector3 maximum{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+            void add(const DirectX::SimpleMath::Vector3& point);
+            void add(const Bounds& other);
+            float area() const;
+        };
+
+        struct Build
+        {
+            std::vector<Bounds> bounds;
+            std::vector<DirectX::SimpleMath::Vector3> centroids;
+            std::vector<uint32_t> order;
+        };
+
+        void build(Build& build, uint32_t start, uint32_t end, uint32_t depth);
+
+        std::vector<Node> _nodes;
+        std::vector<Triangle> _triangles;
+        /// The original index of each triangle, used to choose between hits at the same distance.
+        std::vector<uint32_t> _order;
+        std::vector<TrianglePacket> _packets;
+        /// The index of the triangle in the first lane of each packet.
+        std::vector<uint32_t> _packet_first;
+    };
+}
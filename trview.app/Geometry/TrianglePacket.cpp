@@ -0,0 +1,213 @@
+#include "TrianglePacket.h"
+
+#include <trview.common/Cpu.h>
+
+// SSE2 is part of x64 so is always there. MSVC can use AVX intrinsics in any function and they are only called after
+// checking has_avx, but other compilers only allow them when the whole file is built for AVX.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define TRVIEW_PACKET_SSE
+#include <immintrin.h>
+#if defined(_MSC_VER) || defined(__AVX__)
+#define TRVIEW_PACKET_AVX
+#endif
+#endif
+
+using namespace DirectX::SimpleMath;
+
+namespace trview
+{
+    namespace
+    {
+        // The determinant below which DirectX::TriangleTests::Intersects treats a ray as parallel to the triangle.
+        constexpr float RayEpsilon = 1e-20f;
+
+#ifdef TRVIEW_PACKET_SSE
+        struct Sse
+        {
+            using V = __m128;
+            static constexpr uint32_t Lanes = 4;
+            static V set1(float v) { return _mm_set1_ps(v); }
+            static V load(const float* p) { return _mm_loadu_ps(p); }
+            static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+            static V add(V a, V b) { return _mm_add_ps(a, b); }
+            static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+            static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+            static V div(V a, V b) { return _mm_div_ps(a, b); }
+            static V lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+            static V le(V a, V b) { return _mm_cmple_ps(a, b); }
+            static V gt(V a, V b) { return _mm_cmpgt_ps(a, b); }
+            static V ge(V a, V b) { return _mm_cmpge_ps(a, b); }
+            static V or_mask(V a, V b) { return _mm_or_ps(a, b); }
+            static V and_mask(V a, V b) { return _mm_and_ps(a, b); }
+            static V and_not_mask(V a, V b) { return _mm_andnot_ps(a, b); }
+            static uint32_t bits(V v) { return static_cast<uint32_t>(_mm_movemask_ps(v)); }
+        };
+#endif
+
+#ifdef TRVIEW_PACKET_AVX
+        struct Avx
+        {
+            using V = __m256;
+            static constexpr uint32_t Lanes = 8;
+            static V set1(float v) { return _mm256_set1_ps(v); }
+            static V load(const float* p) { return _mm256_loadu_ps(p); }
+            static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+            static V add(V a, V b) { return _mm256_add_ps(a, b); }
+            static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+            static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+            static V div(V a, V b) { return _mm256_div_ps(a, b); }
+            static V lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OS); }
+            static V le(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OS); }
+            static V gt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GT_OS); }
+            static V ge(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GE_OS); }
+            static V or_mask(V a, V b) { return _mm256_or_ps(a, b); }
+            static V and_mask(V a, V b) { return _mm256_and_ps(a, b); }
+            static V and_not_mask(V a, V b) { return _mm256_andnot_ps(a, b); }
+            static uint32_t bits(V v) { return static_cast<uint32_t>(_mm256_movemask_ps(v)); }
+        };
+#endif
+
+#ifdef TRVIEW_PACKET_SSE
+        // Tests the lanes from offset to offset + Ops::Lanes. Every product and sum is done in the same order as
+        // DirectX::TriangleTests::Intersects and Vector3::Dot so that the results match them exactly.
+        template <typename Ops>
+        uint32_t intersect_lanes(const TrianglePacket& packet, uint32_t offset, const Vector3& position, const Vector3& direction, float limit, TrianglePacket::Lanes& distances)
+        {
+            using V = typename Ops::V;
+            const auto load = [&](const TrianglePacket::Lanes& lanes) { return Ops::load(lanes.data() + offset); };
+            const auto dot = [](V ax, V ay, V az, V bx, V by, V bz) { return Ops::add(Ops::add(Ops::mul(ax, bx), Ops::mul(ay, by)), Ops::mul(az, bz)); };
+
+            const V dx = Ops::set1(direction.x);
+            const V dy = Ops::set1(direction.y);
+            const V dz = Ops::set1(direction.z);
+            const V e1x = load(packet.e1[0]);
+            const V e1y = load(packet.e1[1]);
+            const V e1z = load(packet.e1[2]);
+            const V e2x = load(packet.e2[0]);
+            const V e2y = load(packet.e2[1]);
+            const V e2z = load(packet.e2[2]);
+
+            // p = direction x e2
+            const V px = Ops::sub(Ops::mul(dy, e2z), Ops::mul(dz, e2y));
+            const V py = Ops::sub(Ops::mul(dz, e2x), Ops::mul(dx, e2z));
+            const V pz = Ops::sub(Ops::mul(dx, e2y), Ops::mul(dy, e2x));
+            const V det = dot(e1x, e1y, e1z, px, py, pz);
+
+            const V sx = Ops::sub(Ops::set1(position.x), load(packet.v0[0]));
+            const V sy = Ops::sub(Ops::set1(position.y), load(packet.v0[1]));
+            const V sz = Ops::sub(Ops::set1(position.z), load(packet.v0[2]));
+            const V u = dot(sx, sy, sz, px, py, pz);
+
+            // q = s x e1
+            const V qx = Ops::sub(Ops::mul(sy, e1z), Ops::mul(sz, e1y));
+            const V qy = Ops::sub(Ops::mul(sz, e1x), Ops::mul(sx, e1z));
+            const V qz = Ops::sub(Ops::mul(sx, e1y), Ops::mul(sy, e1x));
+            const V v = dot(dx, dy, dz, qx, qy, qz);
+            const V t = dot(e2x, e2y, e2z, qx, qy, qz);
+            const V uv = Ops::add(u, v);
+            const V zero = Ops::set1(0.0f);
+
+            // The sign of the determinant says which side of the triangle the ray hits, and the bounds flip with it.
+            const V positive_miss = Ops::or_mask(Ops::or_mask(Ops::or_mask(Ops::lt(u, zero), Ops::gt(u, det)), Ops::or_mask(Ops::lt(v, zero), Ops::gt(uv, det))), Ops::lt(t, zero));
+            const V negative_miss = Ops::or_mask(Ops::or_mask(Ops::or_mask(Ops::gt(u, zero), Ops::lt(u, det)), Ops::or_mask(Ops::gt(v, zero), Ops::lt(uv, det))), Ops::gt(t, zero));
+            const V positive = Ops::and_not_mask(positive_miss, Ops::ge(det, Ops::set1(RayEpsilon)));
+            const V negative = Ops::and_not_mask(negative_miss, Ops::le(det, Ops::set1(-RayEpsilon)));
+
+            // Intersects multiplies by the reciprocal rather than dividing.
+            const V distance = Ops::mul(t, Ops::div(Ops::set1(1.0f), det));
+            const V facing = Ops::lt(dot(dx, dy, dz, load(packet.normal[0]), load(packet.normal[1]), load(packet.normal[2])), zero);
+            const V hit = Ops::and_mask(Ops::and_mask(Ops::or_mask(positive, negative), facing), Ops::le(distance, Ops::set1(limit)));
+
+            Ops::store(distances.data() + offset, distance);
+            return Ops::bits(hit) << offset;
+        }
+#endif
+    }
+
+    void pack_triangles(std::span<const Triangle> triangles, std::vector<TrianglePacket>& packets)
+    {
+        for (std::size_t first = 0; first < triangles.size(); first += TrianglePacket::Width)
+        {
+            // Empty lanes have no area and no normal, so they can never be hit.
+            TrianglePacket packet{};
+            for (uint32_t lane = 0; lane < TrianglePacket::Width && first + lane < triangles.size(); ++lane)
+            {
+                const auto set = [lane](std::array<TrianglePacket::Lanes, 3>& target, const Vector3& value)
+                    {
+                        target[0][lane] = value.x;
+                        target[1][lane] = value.y;
+                        target[2][lane] = value.z;
+                    };
+
+                const auto& triangle = triangles[first + lane];
+                set(packet.v0, triangle.v0);
+                set(packet.e1, triangle.v1 - triangle.v0);
+                set(packet.e2, triangle.v2 - triangle.v0);
+                set(packet.normal, triangle.normal);
+            }
+            packets.push_back(packet);
+        }
+    }
+
+    uint32_t intersect_packet(const TrianglePacket& packet, const Vector3& position, const Vector3& direction, float limit, TrianglePacket::Lanes& distances)
+    {
+#ifdef TRVIEW_PACKET_AVX
+        if (has_avx())
+        {
+            return intersect_lanes<Avx>(packet, 0, position, direction, limit, distances);
+        }
+#endif
+
+#ifdef TRVIEW_PACKET_SSE
+        uint32_t result = 0;
+        for (uint32_t offset = 0; offset < TrianglePacket::Width; offset += Sse::Lanes)
+        {
+            result |= intersect_lanes<Sse>(packet, offset, position, direction, limit, distances);
+        }
+        return result;
+#else
+        return scalar::intersect_packet(packet, position, direction, limit, distances);
+#endif
+    }
+
+    namespace scalar
+    {
+        uint32_t intersect_packet(const TrianglePacket& packet, const Vector3& position, const Vector3& direction, float limit, TrianglePacket::Lanes& distances)
+        {
+            uint32_t result = 0;
+            for (uint32_t lane = 0; lane < TrianglePacket::Width; ++lane)
+            {
+                const Vector3 e1(packet.e1[0][lane], packet.e1[1][lane], packet.e1[2][lane]);
+                const Vector3 e2(packet.e2[0][lane], packet.e2[1][lane], packet.e2[2][lane]);
+                const Vector3 normal(packet.normal[0][lane], packet.normal[1][lane], packet.normal[2][lane]);
+                const Vector3 s = position - Vector3(packet.v0[0][lane], packet.v0[1][lane], packet.v0[2][lane]);
+                const auto dot = [](const Vector3& a, const Vector3& b) { return (a.x * b.x + a.y * b.y) + a.z * b.z; };
+                const auto cross = [](const Vector3& a, const Vector3& b) { return Vector3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); };
+
+                const Vector3 p = cross(direction, e2);
+                const float det = dot(e1, p);
+                const float u = dot(s, p);
+                const Vector3 q = cross(s, e1);
+                const float v = dot(direction, q);
+                const float t = dot(e2, q);
+
+                bool hit = false;
+                if (det >= RayEpsilon)
+                {
+                    hit = !(u < 0 || u > det || v < 0 || u + v > det || t < 0);
+                }
+                else if (det <= -RayEpsilon)
+                {
+                    hit = !(u > 0 || u < det || v > 0 || u + v < det || t > 0);
+                }
+
+                distances[lane] = t * (1.0f / det);
+                if (hit && dot(direction, normal) < 0 && distances[lane] <= limit)
+                {
+                    result |= 1u << lane;
+                }
+            }
+            return result;
+        }
+    }
+}
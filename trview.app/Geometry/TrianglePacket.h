@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <SimpleMath.h>
+#include "Triangle.h"
+
+namespace trview
+{
+    /// <summary>
+    /// Eight triangles with each component in its own array, so that a ray can be tested against all of them at once.
+    /// Edges are stored instead of the other two vertices as that is what the intersection test uses.
+    /// </summary>
+    struct TrianglePacket
+    {
+        static constexpr uint32_t Width = 8;
+        using Lanes = std::array<float, Width>;
+
+        alignas(32) std::array<Lanes, 3> v0;
+        std::array<Lanes, 3> e1;
+        std::array<Lanes, 3> e2;
+        std::array<Lanes, 3> normal;
+    };
+
+    /// <summary>
+    /// Pack triangles into the end of a set of packets. The last packet is filled with empty lanes that can't be hit.
+    /// </summary>
+    /// <param name="triangles">The triangles to pack.</param>
+    /// <param name="packets">Receives the packets.</param>
+    void pack_triangles(std::span<const Triangle> triangles, std::vector<TrianglePacket>& packets);
+
+    /// <summary>
+    /// Test a ray against every triangle in a packet. A lane is hit when the ray hits the front of the triangle no further
+    /// away than the limit. This is the same test as DirectX::TriangleTests::Intersects with a check that the triangle
+    /// faces the ray, done in the same order so that the distances are exactly the same. Uses AVX when the processor
+    /// supports it, SSE2 otherwise and the scalar version when the build has neither.
+    /// </summary>
+    /// <param name="packet">The triangles to test.</param>
+    /// <param name="position">The start of the ray.</param>
+    /// <param name="direction">The normalised direction of the ray.</param>
+    /// <param name="limit">The furthest hit to accept.</param>
+    /// <param name="distances">Receives the distance for each lane that was hit.</param>
+    /// <returns>A mask with a bit set for each lane that was hit.</returns>
+    uint32_t intersect_packet(const TrianglePacket& packet, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, float limit, TrianglePacket::Lanes& distances);
+
+    namespace scalar
+    {
+        /// <summary>
+        /// A version of intersect_packet that never uses SIMD, for tests and benchmarks.
+        /// </summary>
+        uint32_t intersect_packet(const TrianglePacket& packet, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction, float limit, TrianglePacket::Lanes& distances);
+    }
+}
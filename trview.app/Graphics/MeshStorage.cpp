@@ -1,27 +1,79 @@
 #include "MeshStorage.h"
+#include <trview.app/Geometry/MeshVertex.h>
+#include <trview.common/Logs/Activity.h>
 
 namespace trview
 {
+    namespace
+    {
+        /// <summary>
+        /// Approximate size of the vertex and index buffers that a mesh will need.
+        /// </summary>
+        std::size_t estimated_size(const trlevel::tr_mesh& mesh)
+        {
+            const std::size_t rectangles = mesh.textured_rectangles.size() + mesh.coloured_rectangles.size();
+            const std::size_t triangles = mesh.textured_triangles.size() + mesh.coloured_triangles.size();
+            return (rectangles * 4 + triangles * 3) * sizeof(MeshVertex) + (rectangles * 6 + triangles * 3) * sizeof(uint32_t);
+        }
+    }
+
     IMeshStorage::~IMeshStorage()
     {
     }
 
-    MeshStorage::MeshStorage(const IMesh::Source& mesh_source, const trlevel::ILevel& level, const ILevelTextureStorage& texture_storage)
+    MeshStorage::MeshStorage(const IMesh::Source& mesh_source, const std::shared_ptr<trlevel::ILevel>& level, const std::shared_ptr<ILevelTextureStorage>& texture_storage, const std::shared_ptr<ILog>& log)
+        : _mesh_source(mesh_source), _level(level), _texture_storage(texture_storage)
     {
-        const uint32_t pointers = level.num_mesh_pointers();
+        struct Usage
+        {
+            uint32_t first_pointer;
+            uint32_t count;
+        };
+
+        const uint32_t pointers = level->num_mesh_pointers();
+        std::unordered_map<uint32_t, Usage> usage;
         for (uint32_t i = 0; i < pointers; ++i)
         {
-            _meshes.insert({ i, create_mesh(level.get_mesh_by_pointer(i), mesh_source, texture_storage, level.platform_and_version()) });
+            const auto offset = level->get_mesh_pointer(i);
+            ++usage.insert({ offset, { i, 0 } }).first->second.count;
+            _offsets.push_back(offset);
+        }
+
+        std::size_t saved = 0;
+        for (const auto& [offset, mesh_usage] : usage)
+        {
+            if (mesh_usage.count > 1)
+            {
+                saved += estimated_size(level->get_mesh_by_pointer(mesh_usage.first_pointer)) * (mesh_usage.count - 1);
+            }
         }
+
+        Activity activity(log, "Level", level->name());
+        activity.log(std::format("{} mesh pointers share {} unique meshes, saving approximately {} KB", pointers, usage.size(), saved / 1024));
     }
 
     std::shared_ptr<IMesh> MeshStorage::mesh(uint32_t mesh_pointer) const 
     {
-        auto found = _meshes.find(mesh_pointer);
+        if (mesh_pointer >= _offsets.size())
+        {
+            return nullptr;
+        }
+
+        const auto offset = _offsets[mesh_pointer];
+        auto found = _meshes.find(offset);
         if (found != _meshes.end())
         {
             return found->second;
         }
-        return nullptr;
+
+        const auto level = _level.lock();
+        if (!level)
+        {
+            return nullptr;
+        }
+
+        auto mesh = create_mesh(level->get_mesh_by_pointer(mesh_pointer), _mesh_source, *_texture_storage, level->platform_and_version());
+        _meshes.insert({ offset, mesh });
+        return mesh;
     }
 }
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <memory>
 #include <trlevel/ILevel.h>
+#include <trview.common/Logs/ILog.h>
 #include "IMeshStorage.h"
 #include <trview.app/Geometry/IMesh.h>
 
@@ -11,13 +12,24 @@ namespace trview
 {
     struct ILevelTextureStorage;
 
+    /// <summary>
+    /// Creates meshes for mesh pointers as they are requested. Mesh pointers that refer to the same mesh data
+    /// share a single mesh.
+    /// </summary>
     class MeshStorage final : public IMeshStorage
     {
     public:
-        explicit MeshStorage(const IMesh::Source& mesh_source, const trlevel::ILevel& level, const ILevelTextureStorage& texture_storage);
+        explicit MeshStorage(const IMesh::Source& mesh_source, const std::shared_ptr<trlevel::ILevel>& level, const std::shared_ptr<ILevelTextureStorage>& texture_storage, const std::shared_ptr<ILog>& log);
         virtual ~MeshStorage() = default;
         virtual std::shared_ptr<IMesh> mesh(uint32_t mesh_pointer) const override;
     private:
+        IMesh::Source _mesh_source;
+        std::weak_ptr<trlevel::ILevel> _level;
+        std::shared_ptr<ILevelTextureStorage> _texture_storage;
+        /// <summary>
+        /// Mesh data offset for each mesh pointer.
+        /// </summary>
+        std::vector<uint32_t> _offsets;
         mutable std::unordered_map<uint32_t, std::shared_ptr<IMesh>> _meshes;
     };
 }
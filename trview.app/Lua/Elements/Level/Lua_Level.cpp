@@ -51,7 +51,8 @@ namespace trview
                 }
                 else if (key == "floordata")
                 {
-                    const auto data = level->floor_data();
+                    const auto floordata = level->floor_data();
+                    const auto data = floordata ? floordata->data() : std::span<const uint16_t>{};
                     lua_createtable(L, static_cast<int>(data.size()), 0);
                     for (auto i = 0u; i < data.size(); ++i)
                     {
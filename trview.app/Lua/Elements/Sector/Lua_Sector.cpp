@@ -137,12 +137,12 @@ namespace trview
                     {
                         if (auto level = room->level().lock())
                         {
-                            const auto data = level->floor_data();
-                            if (sector->floordata_index() < data.size())
+                            const auto floordata = level->floor_data();
+                            if (floordata && sector->floordata_index() < floordata->size())
                             {
                                 lua_newtable(L);
                                 push_list(L, 
-                                    parse_floordata(level->floor_data(), sector->floordata_index(), FloordataMeanings::None, level->trng()).commands
+                                    floordata->at(sector->floordata_index()).commands
                                     | std::views::transform([](auto& f) { return f.data; })
                                     | std::views::join,
                                     [](auto L, auto f) { lua_pushinteger(L, f); });
@@ -86,7 +86,13 @@ namespace trview
                 }
                 else if (key == "level")
                 {
-                    return create_level(L, application->current_level().lock());
+                    // Scripts can read anything in the level, so they have to wait for a progressive load to finish.
+                    auto level = application->current_level().lock();
+                    if (level)
+                    {
+                        level->finish_load();
+                    }
+                    return create_level(L, level);
                 }
                 else if (key == "load")
                 {
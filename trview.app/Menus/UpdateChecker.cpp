@@ -13,7 +13,11 @@ namespace trview
     }
 
     UpdateChecker::UpdateChecker(const Window& window)
-        : MessageHandler(window)
+        : MessageHandler(window), _current_version(current_version())
+    {
+    }
+
+    std::string current_version()
     {
         TCHAR filename[MAX_PATH];
         GetModuleFileName(NULL, filename, MAX_PATH);
@@ -27,9 +31,9 @@ namespace trview
         VerQueryValue(&data[0], L"\\", reinterpret_cast<void**>(&buffer), &value_size);
         VS_FIXEDFILEINFO* info = reinterpret_cast<VS_FIXEDFILEINFO*>(buffer);
 
-        _current_version = "v" + std::to_string(info->dwFileVersionMS >> 16 & 0xffff) + "." +
-                                 std::to_string(info->dwFileVersionMS >> 0 & 0xffff) + "." +
-                                 std::to_string(info->dwFileVersionLS >> 16 & 0xffff);
+        return "v" + std::to_string(info->dwFileVersionMS >> 16 & 0xffff) + "." +
+                     std::to_string(info->dwFileVersionMS >> 0 & 0xffff) + "." +
+                     std::to_string(info->dwFileVersionLS >> 16 & 0xffff);
     }
 
     UpdateChecker::~UpdateChecker()
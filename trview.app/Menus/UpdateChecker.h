@@ -31,5 +31,9 @@ namespace trview
         std::thread _thread;
         std::string _current_version;
     };
+
+    /// Get the version of the running trview executable.
+    /// @returns The version in the form vX.Y.Z.
+    std::string current_version();
 }
 
@@ -18,6 +18,7 @@ namespace trview
             MOCK_METHOD(uint32_t, number, (), (const, override));
             MOCK_METHOD(std::weak_ptr<IRoom>, room, (), (const, override));
             MOCK_METHOD(PickResult, pick, (const DirectX::SimpleMath::Vector3&, const DirectX::SimpleMath::Vector3&), (const, override));
+            MOCK_METHOD(PickTarget, pick_target, (), (const, override));
             MOCK_METHOD(DirectX::BoundingBox, bounding_box, (), (const, override));
             MOCK_METHOD(void, adjust_y, (float), (override));
             MOCK_METHOD(bool, needs_ocb_adjustment, (), (const, override));
@@ -19,11 +19,14 @@ namespace trview
             MOCK_METHOD(std::vector<std::weak_ptr<ICameraSink>>, camera_sinks, (), (const, override));
             MOCK_METHOD(std::string, filename, (), (const, override));
             MOCK_METHOD(bool, has_model, (uint32_t), (const, override));
-            MOCK_METHOD(std::vector<uint16_t>, floor_data, (), (const, override));
+            MOCK_METHOD(std::shared_ptr<const LevelFloordata>, floor_data, (), (const, override));
             MOCK_METHOD(bool, highlight_mode_enabled, (RoomHighlightMode), (const, override));
             MOCK_METHOD(std::weak_ptr<IItem>, item, (uint32_t), (const, override));
             MOCK_METHOD(std::vector<std::weak_ptr<IItem>>, items, (), (const, override));
             MOCK_METHOD(std::vector<graphics::Texture>, level_textures, (), (const, override));
+            MOCK_METHOD(LoadStage, load_stage, (), (const, override));
+            MOCK_METHOD(void, continue_load, (), (override));
+            MOCK_METHOD(void, finish_load, (), (override));
             MOCK_METHOD(std::weak_ptr<ILight>, light, (uint32_t), (const, override));
             MOCK_METHOD(std::vector<std::weak_ptr<ILight>>, lights, (), (const, override));
             MOCK_METHOD(std::string, name, (), (const, override));
@@ -31,6 +34,7 @@ namespace trview
             MOCK_METHOD(uint32_t, number_of_rooms, (), (const, override));
             MOCK_METHOD(void, on_camera_moved, (), (override));
             MOCK_METHOD(PickResult, pick, (const ICamera&, const DirectX::SimpleMath::Vector3&, const DirectX::SimpleMath::Vector3&), (const, override));
+            MOCK_METHOD(std::shared_ptr<const PickScene>, pick_scene, (), (const, override));
             MOCK_METHOD(void, render, (const ICamera&, bool), (override));
             MOCK_METHOD(void, render_transparency, (const ICamera&), (override));
             MOCK_METHOD(std::weak_ptr<IRoom>, room, (uint32_t), (const, override));
@@ -69,6 +73,7 @@ namespace trview
             MOCK_METHOD(std::shared_ptr<ILevelTextureStorage>, texture_storage, (), (const, override));
             MOCK_METHOD(std::weak_ptr<ITrigger>, trigger, (uint32_t), (const, override));
             MOCK_METHOD(std::vector<std::weak_ptr<ITrigger>>, triggers, (), (const, override));
+            MOCK_METHOD(std::vector<std::weak_ptr<ITrigger>>, triggers_for_item, (uint32_t), (const, override));
             MOCK_METHOD(trlevel::LevelVersion, version, (), (const, override));
             MOCK_METHOD(MapColours, map_colours, (), (const, override));
             MOCK_METHOD(void, set_map_colours, (const MapColours&), (override));
@@ -76,6 +81,7 @@ namespace trview
             MOCK_METHOD(std::optional<uint32_t>, selected_camera_sink, (), (const, override));
             MOCK_METHOD(std::weak_ptr<IStaticMesh>, static_mesh, (uint32_t), (const, override));
             MOCK_METHOD(std::vector<std::weak_ptr<IStaticMesh>>, static_meshes, (), (const));
+            MOCK_METHOD(std::weak_ptr<IRoom>, start_room, (), (const, override));
             MOCK_METHOD(std::weak_ptr<ISoundStorage>, sound_storage, (), (const, override));
             MOCK_METHOD(std::vector<std::weak_ptr<ISoundSource>>, sound_sources, (), (const, override));
             MOCK_METHOD(void, set_show_sound_sources, (bool), (override));
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "../../Elements/ILevelCache.h"
+
+namespace trview
+{
+    namespace mocks
+    {
+        struct MockLevelCache : public ILevelCache
+        {
+            MockLevelCache();
+            ~MockLevelCache();
+            MOCK_METHOD(std::optional<std::string>, key, (const std::string&), (const, override));
+            MOCK_METHOD(std::optional<std::vector<RoomGeometry>>, load, (const std::string&, const std::string&), (const, override));
+            MOCK_METHOD(void, save, (const std::string&, const std::string&, const std::vector<RoomGeometry>&), (override));
+            MOCK_METHOD(void, set_settings, (const UserSettings&), (override));
+        };
+    }
+}
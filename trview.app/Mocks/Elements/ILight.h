@@ -23,6 +23,7 @@ namespace trview
             MOCK_METHOD(int32_t, intensity, (), (const, override));
             MOCK_METHOD(int32_t, fade, (), (const, override));
             MOCK_METHOD(PickResult, pick, (const DirectX::SimpleMath::Vector3&, const DirectX::SimpleMath::Vector3&), (const, override));
+            MOCK_METHOD(PickTarget, pick_target, (), (const, override));
             MOCK_METHOD(DirectX::SimpleMath::Vector3, direction, (), (const, override));
             MOCK_METHOD(float, in, (), (const, override));
             MOCK_METHOD(float, out, (), (const, override));
@@ -35,6 +35,7 @@ namespace trview
             MOCK_METHOD(uint32_t, number, (), (const, override));
             MOCK_METHOD(bool, outside, (), (const, override));
             MOCK_METHOD(std::vector<PickResult>, pick, (const DirectX::SimpleMath::Vector3&, const DirectX::SimpleMath::Vector3&, PickFilter), (const, override));
+            MOCK_METHOD(std::vector<PickTarget>, pick_targets, (PickFilter), (const, override));
             MOCK_METHOD(bool, quicksand, (), (const, override));
             MOCK_METHOD(void, render, (const ICamera&, SelectionMode, RenderFilter, const std::unordered_set<uint32_t>&), (override));
             MOCK_METHOD(void, render_bounding_boxes, (const ICamera&), (override));
@@ -53,6 +54,7 @@ namespace trview
             MOCK_METHOD(float, y_top, (), (const, override));
             MOCK_METHOD(ISector::Portal, sector_portal, (int, int, int, int), (const, override));
             MOCK_METHOD(void, set_sector_triangle_rooms, (const std::vector<uint32_t>&), (override));
+            MOCK_METHOD(void, upload, (const trlevel::ILevel&, const IMeshStorage&, const Activity&), (override));
             MOCK_METHOD(DirectX::SimpleMath::Vector3, position, (), (const, override));
             MOCK_METHOD(bool, visible, (), (const, override));
             MOCK_METHOD(void, set_visible, (bool visible), (override));
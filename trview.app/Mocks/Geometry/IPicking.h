@@ -11,6 +11,7 @@ namespace trview
             MockPicking();
             virtual ~MockPicking();
             MOCK_METHOD(void, pick, (const ICamera&), (override));
+            MOCK_METHOD(void, update, (), (override));
         };
     }
 }
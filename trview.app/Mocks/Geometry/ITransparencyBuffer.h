@@ -11,6 +11,7 @@ namespace trview
             MockTransparencyBuffer();
             virtual ~MockTransparencyBuffer();
             MOCK_METHOD(void, add, (const TransparentTriangle&), (override));
+            MOCK_METHOD(void, add, (std::span<const TransparentTriangle>), (override));
             MOCK_METHOD(void, sort, (const DirectX::SimpleMath::Vector3&), (override));
             MOCK_METHOD(void, render, (const ICamera&, bool), (override));
             MOCK_METHOD(void, reset, (), (override));
@@ -6,6 +6,7 @@
 #include "Elements/IFlybyNode.h"
 #include "Elements/IItem.h"
 #include "Elements/ILevel.h"
+#include "Elements/ILevelCache.h"
 #include "Elements/ILight.h"
 #include "Elements/INgPlusSwitcher.h"
 #include "Elements/IRoom.h"
@@ -301,6 +302,9 @@ namespace trview
         MockNgPlusSwitcher::MockNgPlusSwitcher() {};
         MockNgPlusSwitcher::~MockNgPlusSwitcher() {};
 
+        MockLevelCache::MockLevelCache() {};
+        MockLevelCache::~MockLevelCache() {};
+
         MockAboutWindowManager::MockAboutWindowManager() {};
         MockAboutWindowManager::~MockAboutWindowManager() {};
 
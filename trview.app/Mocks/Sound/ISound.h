@@ -11,6 +11,7 @@ namespace trview
             MockSound();
             virtual ~MockSound();
             MOCK_METHOD(void, play, (), (override));
+            MOCK_METHOD(bool, is_playing, (), (const, override));
         };
     }
 }
@@ -10,7 +10,7 @@ namespace trview
         {
             MockSoundStorage();
             virtual ~MockSoundStorage();
-            MOCK_METHOD(void, add, (ISoundStorage::Index, const std::vector<uint8_t>&), (override));
+            MOCK_METHOD(void, add, (ISoundStorage::Index, std::span<const uint8_t>, const Owner&, const Decoder&), (override));
             MOCK_METHOD(std::weak_ptr<ISound>, get, (uint16_t), (const, override));
             MOCK_METHOD(std::vector<Entry>, sounds, (), (const, override));
         };
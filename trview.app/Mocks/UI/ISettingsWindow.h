@@ -35,6 +35,8 @@ namespace trview
             MOCK_METHOD(void, set_fov, (float), (override));
             MOCK_METHOD(void, set_camera_sink_startup, (bool), (override));
             MOCK_METHOD(void, set_statics_startup, (bool), (override));
+            MOCK_METHOD(void, set_level_cache, (bool), (override));
+            MOCK_METHOD(void, set_parallel_rooms, (bool), (override));
         };
     }
 }
@@ -21,7 +21,7 @@ namespace trview
             MOCK_METHOD(void, set_selected_trigger, (const std::weak_ptr<ITrigger>& ), (override));
             MOCK_METHOD(std::weak_ptr<IRoomsWindow>, create_window, (), (override));
             MOCK_METHOD(void, update, (float), (override));
-            MOCK_METHOD(void, set_floordata, (const std::vector<uint16_t>&), (override));
+            MOCK_METHOD(void, set_floordata, (const std::shared_ptr<const LevelFloordata>&), (override));
             MOCK_METHOD(void, set_selected_camera_sink, (const std::weak_ptr<ICameraSink>&), (override));
             MOCK_METHOD(void, set_selected_light, (const std::weak_ptr<ILight>&), (override));
             MOCK_METHOD(void, set_ng_plus, (bool), (override));
@@ -128,6 +128,9 @@ namespace trview
             read_attribute(json, settings.triggers_window_columns, "triggers_window_columns");
             read_attribute(json, settings.flyby_columns, "flyby_columns");
             read_attribute(json, settings.flyby_node_columns, "flyby_node_columns");
+            read_attribute(json, settings.level_cache, "level_cache");
+            read_attribute(json, settings.level_cache_size, "level_cache_size");
+            read_attribute(json, settings.parallel_rooms, "parallel_rooms");
 
             settings.recent_files.resize(std::min<std::size_t>(settings.recent_files.size(), settings.max_recent_files));
         }
@@ -208,6 +211,9 @@ namespace trview
             json["triggers_window_columns"] = settings.triggers_window_columns;
             json["flyby_columns"] = settings.flyby_columns;
             json["flyby_node_columns"] = settings.flyby_node_columns;
+            json["level_cache"] = settings.level_cache;
+            json["level_cache_size"] = settings.level_cache_size;
+            json["parallel_rooms"] = settings.parallel_rooms;
             _files->save_file(file_path, json.dump());
         }
         catch (...)
@@ -64,6 +64,9 @@ namespace trview
             statics_window_columns == other.statics_window_columns &&
             sounds_window_columns == other.sounds_window_columns &&
             lights_window_columns == other.lights_window_columns &&
-            triggers_window_columns == other.triggers_window_columns;
+            triggers_window_columns == other.triggers_window_columns &&
+            level_cache == other.level_cache &&
+            level_cache_size == other.level_cache_size &&
+            parallel_rooms == other.parallel_rooms;
     }
 }
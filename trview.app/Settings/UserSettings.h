@@ -78,6 +78,12 @@ namespace trview
         std::vector<std::string> triggers_window_columns{ "#", "Type", "Room", "Hide" };
         std::vector<std::string> flyby_columns{ "#", "Hide" };
         std::vector<std::string> flyby_node_columns{ "#", "Room" };
+        /// Keep processed room geometry on disk so that reopening a level is faster.
+        bool level_cache{ false };
+        /// Maximum size of the level cache in megabytes.
+        uint32_t level_cache_size{ 1024 };
+        /// Read and build rooms on multiple threads when opening a level.
+        bool parallel_rooms{ true };
 
         bool operator==(const UserSettings& other) const;
     };
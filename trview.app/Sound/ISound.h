@@ -7,6 +7,10 @@ namespace trview
         using Source = std::function<std::shared_ptr<ISound>(const std::vector<uint8_t>&)>;
         virtual ~ISound() = 0;
         virtual void play() = 0;
+        /// <summary>
+        /// Whether the sound has been started and has not yet reached the end.
+        /// </summary>
+        virtual bool is_playing() const = 0;
     };
 
     std::shared_ptr<ISound> create_sound(const std::vector<uint8_t>& data);
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <vector>
 #include <memory>
+#include <span>
 
 namespace trview
 {
@@ -10,6 +12,15 @@ namespace trview
 
     struct ISoundStorage
     {
+        /// <summary>
+        /// Converts stored sample data into data that can be played.
+        /// </summary>
+        using Decoder = std::function<std::vector<uint8_t>(std::span<const uint8_t>)>;
+        /// <summary>
+        /// Keeps the sample data alive for as long as the sample is stored.
+        /// </summary>
+        using Owner = std::shared_ptr<const void>;
+
         struct Index
         {
             uint16_t sound_map;
@@ -25,7 +36,14 @@ namespace trview
         };
 
         virtual ~ISoundStorage() = 0;
-        virtual void add(Index index, const std::vector<uint8_t>& data) = 0;
+        /// <summary>
+        /// Add a sample. The data is not copied or decoded until the sound is first played.
+        /// </summary>
+        /// <param name="index">The sound map, details and sample that use the data.</param>
+        /// <param name="data">The undecoded sample data.</param>
+        /// <param name="owner">The owner of the data, kept while the sample is stored.</param>
+        /// <param name="decoder">The decoder for the data, or empty if the data can be played as it is.</param>
+        virtual void add(Index index, std::span<const uint8_t> data, const Owner& owner, const Decoder& decoder) = 0;
         virtual std::weak_ptr<ISound> get(uint16_t index) const = 0;
         virtual std::vector<Entry> sounds() const = 0;
     };
@@ -55,6 +55,17 @@ namespace trview
         }
     }
 
+    bool Sound::is_playing() const
+    {
+        if (!_impl->initialised || !ma_device_is_started(&_impl->device))
+        {
+            return false;
+        }
+
+        ma_uint64 available = 0;
+        return MA_SUCCESS == ma_decoder_get_available_frames(&_impl->decoder, &available) && available > 0;
+    }
+
     bool Sound::initialise()
     {
         if (_impl->initialised)
@@ -10,6 +10,7 @@ namespace trview
         explicit Sound(const std::vector<uint8_t>& data);
         virtual ~Sound();
         void play() override;
+        bool is_playing() const override;
     private:
         bool initialise();
         struct Impl;
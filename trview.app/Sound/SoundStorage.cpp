@@ -1,31 +1,133 @@
 #include "SoundStorage.h"
-#include <ranges>
 
 namespace trview
 {
+    /// <summary>
+    /// The sound handed out for a sample. Playing it fetches the decoded sound from the storage.
+    /// </summary>
+    class SoundStorage::Sample final : public ISound
+    {
+    public:
+        Sample(SoundStorage& storage, uint16_t sample_index, std::span<const uint8_t> data, const Owner& owner, const Decoder& decoder)
+            : _storage(&storage), _sample_index(sample_index), _data(data), _owner(owner), _decoder(decoder)
+        {
+        }
+
+        virtual ~Sample() = default;
+
+        void play() override
+        {
+            if (!_storage)
+            {
+                return;
+            }
+
+            if (const auto sound = _storage->decode(_sample_index, _data, _decoder))
+            {
+                sound->play();
+            }
+        }
+
+        bool is_playing() const override
+        {
+            return _storage && _storage->is_playing(_sample_index);
+        }
+
+        void detach()
+        {
+            _storage = nullptr;
+        }
+    private:
+        SoundStorage* _storage;
+        uint16_t _sample_index;
+        std::span<const uint8_t> _data;
+        Owner _owner;
+        Decoder _decoder;
+    };
+
     ISoundStorage::~ISoundStorage()
     {
     }
 
-    SoundStorage::SoundStorage(const ISound::Source& sound_source)
-        : _sound_source(sound_source)
+    SoundStorage::SoundStorage(const ISound::Source& sound_source, std::size_t decoded_limit)
+        : _sound_source(sound_source), _decoded_limit(decoded_limit)
     {
     }
 
-    void SoundStorage::add(Index index, const std::vector<uint8_t>& data)
+    SoundStorage::~SoundStorage()
     {
-        const auto sound = _sound_source(data);
-        _sounds.push_back({ .index = index, .sound = sound });
+        // Anything that still has a sample locked can no longer decode it.
+        for (auto& [_, sample] : _samples)
+        {
+            sample->detach();
+        }
+    }
+
+    void SoundStorage::add(Index index, std::span<const uint8_t> data, const Owner& owner, const Decoder& decoder)
+    {
+        _indices.push_back(index);
+        if (!_samples.contains(index.sample_index))
+        {
+            _samples.emplace(index.sample_index, std::make_shared<Sample>(*this, index.sample_index, data, owner, decoder));
+        }
     }
 
     std::weak_ptr<ISound> SoundStorage::get(uint16_t index) const
     {
-        const auto found = std::ranges::find_if(_sounds, [=](auto& s) { return s.index.sample_index == index; });
-        return found == _sounds.end() ? nullptr : found->sound;
+        const auto found = _samples.find(index);
+        return found == _samples.end() ? nullptr : found->second;
     }
 
     std::vector<ISoundStorage::Entry> SoundStorage::sounds() const
     {
-        return _sounds | std::views::transform([](auto&& e) -> Entry { return { .index = e.index, .sound = e.sound }; }) | std::ranges::to<std::vector>();
+        std::vector<Entry> results;
+        results.reserve(_indices.size());
+        for (const auto& index : _indices)
+        {
+            results.push_back({ .index = index, .sound = _samples.at(index.sample_index) });
+        }
+        return results;
+    }
+
+    std::size_t SoundStorage::decoded_size() const
+    {
+        return _decoded_size;
+    }
+
+    std::shared_ptr<ISound> SoundStorage::decode(uint16_t sample_index, std::span<const uint8_t> data, const Decoder& decoder)
+    {
+        const auto found = _decoded_lookup.find(sample_index);
+        if (found != _decoded_lookup.end())
+        {
+            _decoded.splice(_decoded.begin(), _decoded, found->second);
+            return found->second->sound;
+        }
+
+        const auto decoded = decoder ? decoder(data) : std::vector<uint8_t>(data.begin(), data.end());
+        auto sound = _sound_source(decoded);
+        _decoded.push_front({ .sample_index = sample_index, .sound = sound, .size = decoded.size() });
+        _decoded_lookup[sample_index] = _decoded.begin();
+        _decoded_size += decoded.size();
+
+        // The sound that was just decoded is kept even if it is over the limit on its own. Sounds that are still
+        // playing are kept as well, as releasing them would cut them off.
+        auto oldest = _decoded.end();
+        while (_decoded_size > _decoded_limit && oldest != std::next(_decoded.begin()))
+        {
+            --oldest;
+            if (!oldest->sound->is_playing())
+            {
+                _decoded_size -= oldest->size;
+                _decoded_lookup.erase(oldest->sample_index);
+                oldest = _decoded.erase(oldest);
+            }
+        }
+        return sound;
+    }
+
+    bool SoundStorage::is_playing(uint16_t sample_index) const
+    {
+        const auto found = _decoded_lookup.find(sample_index);
+        return found != _decoded_lookup.end() && found->second->sound->is_playing();
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <list>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -9,22 +10,44 @@
 
 namespace trview
 {
+    /// <summary>
+    /// Keeps a view of the undecoded data for each sample and hands out sounds that decode it the first time they are played.
+    /// Decoded sounds are kept up to a size limit, after which the least recently played that are not playing are released.
+    /// </summary>
     class SoundStorage final : public ISoundStorage
     {
     public:
-        explicit SoundStorage(const ISound::Source& sound_source);
-        virtual ~SoundStorage() = default;
-        void add(Index index, const std::vector<uint8_t>& data) override;
+        static constexpr std::size_t DefaultDecodedLimit = 32 * 1024 * 1024;
+
+        explicit SoundStorage(const ISound::Source& sound_source, std::size_t decoded_limit = DefaultDecodedLimit);
+        virtual ~SoundStorage();
+        void add(Index index, std::span<const uint8_t> data, const Owner& owner, const Decoder& decoder) override;
         std::weak_ptr<ISound> get(uint16_t index) const override;
         std::vector<Entry> sounds() const override;
+        /// <summary>
+        /// Get the total size of the decoded samples that are being kept.
+        /// </summary>
+        std::size_t decoded_size() const;
     private:
-        struct OwningEntry
+        class Sample;
+
+        struct Decoded
         {
-            Index index;
+            uint16_t sample_index;
             std::shared_ptr<ISound> sound;
+            std::size_t size;
         };
 
+        std::shared_ptr<ISound> decode(uint16_t sample_index, std::span<const uint8_t> data, const Decoder& decoder);
+        bool is_playing(uint16_t sample_index) const;
+
         ISound::Source _sound_source;
-        std::vector<OwningEntry> _sounds;
+        std::size_t _decoded_limit;
+        std::vector<Index> _indices;
+        std::unordered_map<uint16_t, std::shared_ptr<Sample>> _samples;
+        /// Most recently played first.
+        std::list<Decoded> _decoded;
+        std::unordered_map<uint16_t, std::list<Decoded>::iterator> _decoded_lookup;
+        std::size_t _decoded_size{ 0 };
     };
 }
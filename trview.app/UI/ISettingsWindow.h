@@ -81,6 +81,8 @@ namespace trview
         Event<bool> on_camera_sink_startup;
         Event<std::string, FontSetting> on_font;
         Event<bool> on_statics_startup;
+        Event<bool> on_level_cache;
+        Event<bool> on_parallel_rooms;
 
         virtual void render() = 0;
         /// <summary>
@@ -183,5 +185,15 @@ namespace trview
         /// </summary>
         virtual void toggle_visibility() = 0;
         virtual void set_statics_startup(bool value) = 0;
+        /// <summary>
+        /// Set the new value of the level cache setting. This will not raise the on_level_cache event.
+        /// </summary>
+        /// <param name="value">The new level cache setting.</param>
+        virtual void set_level_cache(bool value) = 0;
+        /// <summary>
+        /// Set the new value of the parallel rooms setting. This will not raise the on_parallel_rooms event.
+        /// </summary>
+        /// <param name="value">The new parallel rooms setting.</param>
+        virtual void set_parallel_rooms(bool value) = 0;
     };
 }
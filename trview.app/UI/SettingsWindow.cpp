@@ -43,6 +43,8 @@ namespace trview
                     checkbox(Names::camera_sink_startup, _camera_sink_startup, on_camera_sink_startup);
                     checkbox(Names::statics_startup, _statics_startup, on_statics_startup);
                     checkbox(Names::randomizer_tools, _randomizer_tools, on_randomizer_tools);
+                    checkbox(Names::level_cache, _level_cache, on_level_cache);
+                    checkbox(Names::parallel_rooms, _parallel_rooms, on_parallel_rooms);
                     if (ImGui::InputInt(Names::max_recent_files.c_str(), &_max_recent_files))
                     {
                         _max_recent_files = std::max(0, _max_recent_files);
@@ -331,4 +333,14 @@ namespace trview
     {
         _statics_startup = value;
     }
+
+    void SettingsWindow::set_level_cache(bool value)
+    {
+        _level_cache = value;
+    }
+
+    void SettingsWindow::set_parallel_rooms(bool value)
+    {
+        _parallel_rooms = value;
+    }
 }
@@ -40,6 +40,8 @@ namespace trview
             static inline const std::string camera_sink_startup = "Open Camera/Sink Window at startup";
             static inline const std::string reset_fov = "Reset##Fov";
             static inline const std::string statics_startup = "Open Statics Window at startup";
+            static inline const std::string level_cache = "Cache processed levels";
+            static inline const std::string parallel_rooms = "Load rooms in parallel";
         };
 
         explicit SettingsWindow(const std::shared_ptr<IDialogs>& dialogs, const std::shared_ptr<IShell>& shell, const std::shared_ptr<IFonts>& fonts);
@@ -69,6 +71,8 @@ namespace trview
         virtual void set_fov(float value) override;
         virtual void set_camera_sink_startup(bool value) override;
         void set_statics_startup(bool value) override;
+        void set_level_cache(bool value) override;
+        void set_parallel_rooms(bool value) override;
     private:
         std::shared_ptr<IDialogs> _dialogs;
         std::shared_ptr<IShell> _shell;
@@ -98,5 +102,7 @@ namespace trview
         std::vector<FontSetting> _all_fonts;
         std::shared_ptr<IFonts> _fonts;
         bool _statics_startup{ false };
+        bool _level_cache{ false };
+        bool _parallel_rooms{ true };
     };
 }
@@ -80,7 +80,7 @@ namespace trview
 
         virtual void set_number(int32_t number) = 0;
 
-        virtual void set_floordata(const std::vector<uint16_t>& data) = 0;
+        virtual void set_floordata(const std::shared_ptr<const LevelFloordata>& data) = 0;
 
         virtual void set_selected_light(const std::weak_ptr<ILight>& light) = 0;
         virtual void set_selected_camera_sink(const std::weak_ptr<ICameraSink>& camera_sink) = 0;
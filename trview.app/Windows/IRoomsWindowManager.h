@@ -60,7 +60,7 @@ namespace trview
         /// <param name="delta">Elapsed time since previous update.</param>
         virtual void update(float delta) = 0;
 
-        virtual void set_floordata(const std::vector<uint16_t>& data) = 0;
+        virtual void set_floordata(const std::shared_ptr<const LevelFloordata>& data) = 0;
         virtual void set_selected_light(const std::weak_ptr<ILight>& light) = 0;
         virtual void set_selected_camera_sink(const std::weak_ptr<ICameraSink>& camera_sink) = 0;
         virtual void set_ng_plus(bool value) = 0;
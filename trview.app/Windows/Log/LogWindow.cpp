@@ -22,9 +22,9 @@ namespace trview
         }
     }
 
-    bool LogWindow::render_log_window()
+    namespace
     {
-        const auto get_colour = [&](auto&& message)
+        ImVec4 get_colour(const Message& message)
         {
             switch (message.status)
             {
@@ -34,7 +34,39 @@ namespace trview
                 return ImVec4(1, 0, 0, 1);
             }
             return ImVec4(1, 1, 1, 1);
-        };
+        }
+
+        std::string format_activities(const Message& message, int level_offset)
+        {
+            std::string activities;
+            for (uint32_t i = level_offset; i < message.activity.size(); ++i)
+            {
+                activities += "[" + message.activity[i] + "]";
+            }
+            return activities;
+        }
+
+        template <typename Row>
+        void render_rows(const std::vector<Row>& rows)
+        {
+            // Only the rows that can be seen are drawn.
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(rows.size()));
+            while (clipper.Step())
+            {
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+                {
+                    ImGui::PushStyleColor(ImGuiCol_Text, rows[i].colour);
+                    ImGui::TextUnformatted(rows[i].text.c_str());
+                    ImGui::PopStyleColor();
+                }
+            }
+        }
+    }
+
+    bool LogWindow::render_log_window()
+    {
+        refresh();
 
         bool stay_open = true;
         ImGui::PushStyleVar(ImGuiStyleVar_WindowMinSize, ImVec2(520, 400));
@@ -45,60 +77,40 @@ namespace trview
             {
                 if (ImGui::BeginTabItem(Names::all_topic.c_str()))
                 {
+                    const auto& view = all_view();
                     if (ImGui::Button(Names::save.c_str()))
                     {
-                        save_to_file(_log->messages(), 0);
+                        save_to_file(view.messages, 0);
                     }
 
                     if (ImGui::BeginChild("allmessages", ImVec2(), false, ImGuiWindowFlags_HorizontalScrollbar))
                     {
-                        for (const auto& message : _log->messages())
-                        {
-                            std::string activities;
-                            for (const auto& activity : message.activity)
-                            {
-                                activities += "[" + activity + "]";
-                            }
-
-                            ImGui::PushStyleColor(ImGuiCol_Text, get_colour(message));
-                            ImGui::Text("[%s] [%s] %s - %s", message.topic.c_str(), message.timestamp.c_str(), activities.c_str(), message.text.c_str());
-                            ImGui::PopStyleColor();
-                        }
+                        render_rows(view.rows);
                     }
                     ImGui::EndChild();
                     ImGui::EndTabItem();
                 }
 
-                for (const auto& topic : _log->topics())
+                for (const auto& topic : _topics)
                 {
                     if (ImGui::BeginTabItem(topic.c_str()))
                     {
                         if (ImGui::BeginTabBar((topic + "-activities").c_str(), ImGuiTabBarFlags_FittingPolicyScroll))
                         {
-                            for (const auto& activity : _log->activities(topic))
+                            for (const auto& activity : activities(topic))
                             {
                                 if (ImGui::BeginTabItem(activity.c_str()))
                                 {
+                                    const auto& view = activity_view(topic, activity);
                                     if (ImGui::Button("Save"))
                                     {
-                                        save_to_file(_log->messages(topic, activity), 1);
+                                        save_to_file(view.messages, 1);
                                     }
 
                                     ImGui::Separator();
                                     if (ImGui::BeginChild((topic + "-" + activity).c_str(), ImVec2(), false, ImGuiWindowFlags_HorizontalScrollbar))
                                     {
-                                        for (const auto& message : _log->messages(topic, activity))
-                                        {
-                                            std::string activities;
-                                            for (auto iter = message.activity.begin() + 1; iter != message.activity.end(); ++iter)
-                                            {
-                                                activities += "[" + *iter + "]";
-                                            }
-
-                                            ImGui::PushStyleColor(ImGuiCol_Text, get_colour(message));
-                                            ImGui::Text("[%s] %s - %s", message.timestamp.c_str(), activities.c_str(), message.text.c_str());
-                                            ImGui::PopStyleColor();
-                                        }
+                                        render_rows(view.rows);
                                     }
                                     ImGui::EndChild();
                                     ImGui::EndTabItem();
@@ -118,6 +130,62 @@ namespace trview
         return stay_open;
     }
 
+    void LogWindow::refresh()
+    {
+        const uint64_t sequence = _log->sequence();
+        if (_sequence == sequence)
+        {
+            return;
+        }
+
+        _sequence = sequence;
+        _topics = _log->topics();
+        _all.reset();
+        _activities.clear();
+        _views.clear();
+    }
+
+    const LogWindow::View& LogWindow::all_view()
+    {
+        if (!_all)
+        {
+            View view{ .messages = _log->messages() };
+            view.rows.reserve(view.messages.size());
+            for (const auto& message : view.messages)
+            {
+                view.rows.push_back({ get_colour(message), std::format("[{}] [{}] {} - {}", message.topic, message.timestamp, format_activities(message, 0), message.text) });
+            }
+            _all = std::move(view);
+        }
+        return _all.value();
+    }
+
+    const std::vector<std::string>& LogWindow::activities(const std::string& topic)
+    {
+        auto existing = _activities.find(topic);
+        if (existing == _activities.end())
+        {
+            existing = _activities.insert({ topic, _log->activities(topic) }).first;
+        }
+        return existing->second;
+    }
+
+    const LogWindow::View& LogWindow::activity_view(const std::string& topic, const std::string& activity)
+    {
+        const auto [existing, inserted] = _views.try_emplace({ topic, activity });
+        if (inserted)
+        {
+            auto& view = existing->second;
+            view.messages = _log->messages(topic, activity);
+            view.rows.reserve(view.messages.size());
+            for (const auto& message : view.messages)
+            {
+                view.rows.push_back({ get_colour(message), std::format("[{}] {} - {}", message.timestamp, format_activities(message, 1), message.text) });
+            }
+        }
+        return existing->second;
+    }
+
     void LogWindow::set_number(int32_t number)
     {
         _id = std::format("Log {}", number);
@@ -135,12 +203,7 @@ namespace trview
         std::for_each(messages.begin(), messages.end(),
             [&stream, level_offset](auto&& message)
             {
-                std::string activities;
-                for (uint32_t i = level_offset; i < message.activity.size(); ++i)
-                {
-                    activities += "[" + message.activity[i] + "]";
-                }
-                stream << std::format("[{}] {} - {}", message.timestamp, activities, message.text) << '\n';
+                stream << std::format("[{}] {} - {}", message.timestamp, format_activities(message, level_offset), message.text) << '\n';
             });
         _files->save_file(result.value().filename, stream.str());
     }
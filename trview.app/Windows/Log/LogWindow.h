@@ -4,6 +4,9 @@
 #include <trview.common/IFiles.h>
 #include <trview.common/Windows/IDialogs.h>
 #include "ILogWindow.h"
+#include <map>
+#include <optional>
+#include <unordered_map>
 
 namespace trview
 {
@@ -22,12 +25,39 @@ namespace trview
         virtual void render() override;
         virtual void set_number(int32_t number) override;
     private:
+        struct Row
+        {
+            ImVec4 colour;
+            std::string text;
+        };
+
+        /// <summary>
+        /// Messages for a tab and the rows they were formatted into.
+        /// </summary>
+        struct View
+        {
+            std::vector<Message> messages;
+            std::vector<Row> rows;
+        };
+
         bool render_log_window();
+        void refresh();
+        const View& all_view();
+        const std::vector<std::string>& activities(const std::string& topic);
+        const View& activity_view(const std::string& topic, const std::string& activity);
         void save_to_file(const std::vector<Message>& messages, int level_offset);
 
         std::shared_ptr<ILog> _log;
         std::shared_ptr<IDialogs> _dialogs;
         std::shared_ptr<IFiles> _files;
         std::string _id{ "Log 0" };
+        /// <summary>
+        /// The log sequence the cached views were made at. Views are only made for tabs that are shown.
+        /// </summary>
+        std::optional<uint64_t> _sequence;
+        std::vector<std::string> _topics;
+        std::optional<View> _all;
+        std::unordered_map<std::string, std::vector<std::string>> _activities;
+        std::map<std::pair<std::string, std::string>, View> _views;
     };
 }
@@ -66,7 +66,7 @@ namespace trview
                                     { { L"TR4 levels", { L"*.tr4" } }, { L"TR5 levels", { L"*.trc" }}, { L"All files", { L"*.*" }} },
                                     part.version.has_value() ? (part.version.value().version == trlevel::LevelVersion::Tomb4 ? 1 : 2) : 3))
                                 {
-                                    _files->save_file(file->filename, part.data);
+                                    _files->save_file(file->filename, std::vector<uint8_t>(part.data.begin(), part.data.end()));
                                 }
                             }
                             ImGui::EndPopup();
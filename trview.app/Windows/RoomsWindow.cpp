@@ -678,9 +678,14 @@ namespace trview
 
         _filters.add_multi_getter<std::string>("Floordata Type", { available_floordata_types.begin(), available_floordata_types.end() }, [&](auto&& room)
             {
+                if (!_floordata)
+                {
+                    return std::vector<std::string>{};
+                }
+
                 const auto& sectors = room.sectors();
                 return sectors
-                    | std::views::transform([&](auto&& s) { return parse_floordata(_floordata, s->floordata_index(), FloordataMeanings::None, _trng).commands; })
+                    | std::views::transform([&](auto&& s) -> const std::vector<Floordata::Command>& { return _floordata->at(s->floordata_index()).commands; })
                     | std::views::join
                     | std::views::transform([](auto&& c) { return c.type; })
                     | std::ranges::to<std::unordered_set>()
@@ -930,9 +935,9 @@ namespace trview
             ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableHeadersRow();
 
-            if (selected_sector)
+            if (selected_sector && _floordata)
             {
-                const Floordata floordata = parse_floordata(_floordata, selected_sector->floordata_index(), FloordataMeanings::Generate, _all_items, _trng);
+                const Floordata floordata = parse_floordata(_floordata->data(), selected_sector->floordata_index(), FloordataMeanings::Generate, _all_items, _trng);
 
                 uint32_t index = selected_sector->floordata_index();
                 for (const auto& command : floordata.commands)
@@ -979,7 +984,7 @@ namespace trview
         }
     }
 
-    void RoomsWindow::set_floordata(const std::vector<uint16_t>& data)
+    void RoomsWindow::set_floordata(const std::shared_ptr<const LevelFloordata>& data)
     {
         _floordata = data;
     }
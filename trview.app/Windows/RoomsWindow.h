@@ -45,7 +45,7 @@ namespace trview
         void set_selected_trigger(const std::weak_ptr<ITrigger>& trigger) override;
         void update(float delta) override;
         void set_number(int32_t number) override;
-        void set_floordata(const std::vector<uint16_t>& data) override;
+        void set_floordata(const std::shared_ptr<const LevelFloordata>& data) override;
         void set_selected_light(const std::weak_ptr<ILight>& light) override;
         void set_selected_camera_sink(const std::weak_ptr<ICameraSink>& camera_sink) override;
         void clear_selected_light() override;
@@ -121,7 +121,7 @@ namespace trview
 
         Filters<IRoom> _filters;
         bool _force_sort{ false };
-        std::vector<uint16_t> _floordata;
+        std::shared_ptr<const LevelFloordata> _floordata;
         bool _simple_mode{ true };
         bool _in_floordata_mode{ false };
         std::weak_ptr<ISector> _selected_sector;
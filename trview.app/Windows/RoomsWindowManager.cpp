@@ -128,7 +128,7 @@ namespace trview
         WindowManager::update(delta);
     }
 
-    void RoomsWindowManager::set_floordata(const std::vector<uint16_t>& data)
+    void RoomsWindowManager::set_floordata(const std::shared_ptr<const LevelFloordata>& data)
     {
         _floordata = data;
         for (auto& window : _windows)
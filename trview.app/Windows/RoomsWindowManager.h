@@ -42,7 +42,7 @@ namespace trview
         void set_selected_trigger(const std::weak_ptr<ITrigger>& trigger) override;
         std::weak_ptr<IRoomsWindow> create_window() override;
         void update(float delta) override;
-        void set_floordata(const std::vector<uint16_t>& data) override;
+        void set_floordata(const std::shared_ptr<const LevelFloordata>& data) override;
         void set_selected_light(const std::weak_ptr<ILight>& light) override;
         void set_selected_camera_sink(const std::weak_ptr<ICameraSink>& camera_sink) override;
         void set_ng_plus(bool value) override;
@@ -57,7 +57,7 @@ namespace trview
         IRoomsWindow::Source _rooms_window_source;
         trlevel::LevelVersion _level_version{ trlevel::LevelVersion::Unknown };
         UserSettings _settings;
-        std::vector<uint16_t> _floordata;
+        std::shared_ptr<const LevelFloordata> _floordata;
         std::vector<std::weak_ptr<ICameraSink>> _all_camera_sinks;
         std::weak_ptr<ICameraSink> _selected_camera_sink;
         std::weak_ptr<ILight> _selected_light;
@@ -9,6 +9,7 @@
 
 #include "../Windows/IItemsWindow.h"
 #include "../Elements/Flyby/IFlybyNode.h"
+#include "../Geometry/PickScene.h"
 
 using namespace DirectX::SimpleMath;
 
@@ -431,22 +432,26 @@ namespace trview
         };
         _token_store += _picking->pick_sources += [&](PickInfo info, PickResult& result)
         {
-            const auto level = _level.lock();
-            if (result.stop || !level)
+            if (result.stop)
             {
                 return;
             }
-            result = nearest_result(result, level->pick(*_camera, info.position, info.direction));
+            result = nearest_result(result, _route->pick(info.position, info.direction));
         };
-        _token_store += _picking->pick_sources += [&](PickInfo info, PickResult& result)
+        _token_store += _picking->query_sources += [&](PickInfo, std::vector<IPicking::Query>& queries)
         {
-            if (result.stop)
+            // The level is picked on the picking thread through a snapshot, so that a slow pick doesn't hold up the frame.
+            const auto level = _level.lock();
+            if (const auto scene = level ? level->pick_scene() : nullptr)
             {
-                return;
+                queries.push_back([scene, frustum = _camera->frustum()](const PickInfo& info, std::stop_token stop)
+                    {
+                        return scene->pick(info.position, info.direction, frustum, stop);
+                    });
             }
-            result = nearest_result(result, _route->pick(info.position, info.direction));
         };
-        _token_store += _picking->pick_sources += [&](PickInfo, PickResult& result)
+
+        _token_store += _picking->on_pick += [&](PickInfo, PickResult result)
         {
             if (_active_tool == Tool::Measure && result.hit && !result.stop)
             {
@@ -461,10 +466,7 @@ namespace trview
                     result.text = "|....|";
                 }
             }
-        };
 
-        _token_store += _picking->on_pick += [&](PickInfo, PickResult result)
-        {
             _current_pick = result;
 
             const auto level = _level.lock();
@@ -799,9 +801,20 @@ namespace trview
             }
             else
             {
-                on_room_selected(new_level->room(0));
+                on_room_selected(_settings.go_to_lara ? new_level->start_room() : new_level->room(0));
             }
 
+            // A progressive load only has Lara once the items have been generated.
+            _level_token_store += new_level->on_load_stage += [&](auto&& stage)
+                {
+                    const auto loaded_level = _level.lock();
+                    std::weak_ptr<IItem> loaded_lara;
+                    if (stage == ILevel::LoadStage::Items && loaded_level && _settings.go_to_lara && !loaded_level->selected_item() && find_last_item_by_type_id(*loaded_level, 0u, loaded_lara))
+                    {
+                        on_item_selected(loaded_lara);
+                    }
+                };
+
             if (auto selected_room = new_level->selected_room().lock())
             {
                 _ui->set_selected_room(selected_room);
@@ -842,6 +855,7 @@ namespace trview
         {
             _picking->pick(*_camera);
         }
+        _picking->update();
         _previous_mouse_pos = mouse_pos;
         _camera_moved = false;
 
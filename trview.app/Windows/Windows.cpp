@@ -218,37 +218,24 @@ namespace trview
             return;
         }
 
-        _camera_sink_windows->set_camera_sinks(new_level->camera_sinks());
-        _camera_sink_windows->set_flybys(new_level->flybys());
         _camera_sink_windows->set_platform_and_version(new_level->platform_and_version());
         _diff_windows->set_level(new_level);
-        _items_windows->set_items(new_level->items());
-        _items_windows->set_triggers(new_level->triggers());
         _items_windows->set_level_version(new_level->version());
         _items_windows->set_model_checker([=](uint32_t id) { return new_level->has_model(id); });
         _items_windows->set_ng_plus(new_level->ng_plus());
         _lights_windows->set_level_version(new_level->version());
-        _lights_windows->set_lights(new_level->lights());
         _pack_windows->set_level(new_level);
         _pack_windows->set_pack(new_level->pack());
         _rooms_windows->set_level_version(new_level->version());
-        _rooms_windows->set_items(new_level->items());
         _rooms_windows->set_floordata(new_level->floor_data());
-        _rooms_windows->set_rooms(new_level->rooms());
         _rooms_windows->set_ng_plus(new_level->ng_plus());
         _rooms_windows->set_trng(new_level->trng());
-        _route_window->set_items(new_level->items());
-        _route_window->set_triggers(new_level->triggers());
-        _route_window->set_rooms(new_level->rooms());
         _sounds_windows->set_level_platform(new_level->platform());
         _sounds_windows->set_level_version(new_level->version());
-        _sounds_windows->set_sound_sources(new_level->sound_sources());
         _sounds_windows->set_sound_storage(new_level->sound_storage());
-        _statics_windows->set_statics(new_level->static_meshes());
-        _triggers_windows->set_items(new_level->items());
-        _triggers_windows->set_triggers(new_level->triggers());
         _triggers_windows->set_platform_and_version(new_level->platform_and_version());
         _textures_windows->set_texture_storage(new_level->texture_storage());
+        set_level_contents(*new_level);
 
         _level_token_store.clear();
         _level_token_store += new_level->on_ng_plus += [this, level](bool value)
@@ -256,6 +243,35 @@ namespace trview
                 _items_windows->set_ng_plus(value);
                 _rooms_windows->set_ng_plus(value);
             };
+        // A progressive load adds rooms and entities after the level has been given to the windows.
+        _level_token_store += new_level->on_load_stage += [this, level](ILevel::LoadStage stage)
+            {
+                if (stage == ILevel::LoadStage::Complete)
+                {
+                    if (const auto loaded = level.lock())
+                    {
+                        set_level_contents(*loaded);
+                    }
+                }
+            };
+    }
+
+    void Windows::set_level_contents(const ILevel& level)
+    {
+        _camera_sink_windows->set_camera_sinks(level.camera_sinks());
+        _camera_sink_windows->set_flybys(level.flybys());
+        _items_windows->set_items(level.items());
+        _items_windows->set_triggers(level.triggers());
+        _lights_windows->set_lights(level.lights());
+        _rooms_windows->set_items(level.items());
+        _rooms_windows->set_rooms(level.rooms());
+        _route_window->set_items(level.items());
+        _route_window->set_triggers(level.triggers());
+        _route_window->set_rooms(level.rooms());
+        _sounds_windows->set_sound_sources(level.sound_sources());
+        _statics_windows->set_statics(level.static_meshes());
+        _triggers_windows->set_items(level.items());
+        _triggers_windows->set_triggers(level.triggers());
     }
 
     void Windows::set_room(const std::weak_ptr<IRoom>& room)
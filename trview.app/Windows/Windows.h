@@ -61,6 +61,10 @@ namespace trview
         void setup(const UserSettings& settings) override;
     private:
         void add_waypoint(const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& normal, uint32_t room, IWaypoint::Type type, uint32_t index);
+        /// <summary>
+        /// Give the windows the lists of entities, triggers and rooms in the level.
+        /// </summary>
+        void set_level_contents(const ILevel& level);
 
         TokenStore _token_store;
         TokenStore _level_token_store;
@@ -0,0 +1,8 @@
+#include <trview.common/Cpu.h>
+
+using namespace trview;
+
+TEST(Cpu, Avx2RequiresAvx)
+{
+    ASSERT_TRUE(!has_avx2() || has_avx());
+}
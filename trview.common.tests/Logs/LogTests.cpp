@@ -1,4 +1,5 @@
 #include <trview.common/Logs/Log.h>
+#include <trview.common/Logs/Activity.h>
 
 using namespace trview;
 
@@ -52,4 +53,125 @@ TEST(Log, Clear)
     ASSERT_EQ(log.messages().size(), 1u);
     log.clear();
     ASSERT_EQ(log.messages().size(), 0u);
-}
\ No newline at end of file
+}
+TEST(Log, TraceEventFormattedWhenRead)
+{
+    Log log;
+    const auto id = log.trace_activity("topic", { "activity" });
+    log.trace({ .event = "Read {} of {}", .activity = id, .offset = 12, .args = { 1, 2 }, .arg_count = 2 });
+    auto messages = log.messages();
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(messages[0].text, "[12] Read 1 of 2");
+    ASSERT_EQ(messages[0].topic, "topic");
+    ASSERT_EQ(messages[0].activity, std::vector<std::string>{ "activity" });
+}
+
+TEST(Log, TraceEventFormattedImmediatelyInTextMode)
+{
+    Log log(Log::Mode::Text);
+    const auto id = log.trace_activity("topic", { "activity" });
+    log.trace({ .event = "Read {}", .activity = id, .offset = 4, .args = { 7 }, .arg_count = 1 });
+    auto messages = log.messages();
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(messages[0].text, "[4] Read 7");
+}
+
+TEST(Log, TraceEventsInterleavedWithMessages)
+{
+    Log log;
+    const auto id = log.trace_activity("topic", { "activity" });
+    log.log(Message::Status::Information, "topic", "activity", "first");
+    log.trace({ .event = "second", .activity = id });
+    log.log(Message::Status::Information, "topic", "activity", "third");
+    auto messages = log.messages();
+    ASSERT_EQ(messages.size(), 3u);
+    ASSERT_EQ(messages[0].text, "first");
+    ASSERT_EQ(messages[1].text, "[0] second");
+    ASSERT_EQ(messages[2].text, "third");
+}
+
+TEST(Log, TraceKeepsMostRecentEvents)
+{
+    Log log(Log::Mode::Trace, 2);
+    const auto id = log.trace_activity("topic", { "activity" });
+    for (int64_t i = 0; i < 3; ++i)
+    {
+        log.trace({ .event = "{}", .activity = id, .args = { i }, .arg_count = 1 });
+    }
+    auto messages = log.messages();
+    ASSERT_EQ(messages.size(), 3u);
+    ASSERT_EQ(messages[0].text, "1 earlier trace events were dropped as the trace buffer holds 2 events");
+    ASSERT_EQ(messages[0].status, Message::Status::Warning);
+    ASSERT_EQ(messages[1].text, "[0] 1");
+    ASSERT_EQ(messages[2].text, "[0] 2");
+}
+
+TEST(Log, TraceActivityIdsShared)
+{
+    Log log;
+    const auto id = log.trace_activity("topic", { "activity" });
+    ASSERT_EQ(log.trace_activity("topic", { "activity" }), id);
+    ASSERT_NE(log.trace_activity("topic", { "activity", "child" }), id);
+    ASSERT_NE(log.trace_activity("topic 2", { "activity" }), id);
+}
+
+TEST(Log, ClearRemovesReleasedTraceActivities)
+{
+    Log log;
+    const auto released = log.trace_activity("topic", { "released" });
+    const auto kept = log.trace_activity("topic", { "kept" });
+    log.release_trace_activity(released);
+    log.clear();
+
+    ASSERT_EQ(log.trace_activity("topic", { "kept" }), kept);
+    ASSERT_NE(log.trace_activity("topic", { "released" }), released);
+
+    log.trace({ .event = "text", .activity = kept });
+    auto messages = log.messages();
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(messages[0].activity, std::vector<std::string>{ "kept" });
+}
+
+TEST(Log, TraceTopicAndActivityFilter)
+{
+    Log log;
+    const auto first = log.trace_activity("topic", { "activity" });
+    const auto second = log.trace_activity("topic", { "activity 2" });
+    log.trace({ .event = "text", .activity = first });
+    log.trace({ .event = "text 2", .activity = second });
+    auto messages = log.messages("topic", "activity 2");
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(messages[0].text, "[0] text 2");
+    std::vector<std::string> expected_activities{ "activity", "activity 2" };
+    ASSERT_EQ(log.activities("topic"), expected_activities);
+}
+
+TEST(Log, SequenceChangesWhenLogChanges)
+{
+    Log log;
+    const auto id = log.trace_activity("topic", { "activity" });
+    const auto initial = log.sequence();
+    log.log(Message::Status::Information, "topic", "activity", "text");
+    const auto logged = log.sequence();
+    ASSERT_NE(logged, initial);
+    log.trace({ .event = "text", .activity = id });
+    const auto traced = log.sequence();
+    ASSERT_NE(traced, logged);
+    log.messages();
+    ASSERT_EQ(log.sequence(), traced);
+    log.clear();
+    ASSERT_NE(log.sequence(), traced);
+}
+
+TEST(Log, ActivityStartAndEndAreTraceEvents)
+{
+    auto log = std::make_shared<Log>(Log::Mode::Trace, 2);
+    {
+        Activity activity(log, "topic", "activity");
+    }
+    auto messages = log->messages();
+    ASSERT_EQ(messages.size(), 2u);
+    ASSERT_EQ(messages[0].text, "Activity Started");
+    ASSERT_EQ(messages[0].activity, std::vector<std::string>{ "activity" });
+    ASSERT_EQ(messages[1].text, "Activity Ended");
+}
@@ -0,0 +1,101 @@
+#include "Cpu.h"
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define TRVIEW_CPU_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace trview
+{
+    namespace
+    {
+#ifdef TRVIEW_CPU_X86
+        struct CpuFeatures
+        {
+            bool avx{ false };
+            bool avx2{ false };
+        };
+
+        void cpuid(int info[4], int leaf, int subleaf)
+        {
+#if defined(_MSC_VER)
+            __cpuidex(info, leaf, subleaf);
+#else
+            __cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
+#endif
+        }
+
+        uint64_t xgetbv0()
+        {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            uint32_t eax = 0;
+            uint32_t edx = 0;
+            __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+        }
+
+        // The OS has to save the YMM registers on a context switch (XCR0 bits 1 and 2) as well as the processor
+        // supporting the instructions, otherwise they can't be used.
+        CpuFeatures detect()
+        {
+            CpuFeatures features;
+            int info[4];
+            cpuid(info, 0, 0);
+            const int max_leaf = info[0];
+            if (max_leaf < 1)
+            {
+                return features;
+            }
+
+            cpuid(info, 1, 0);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (xgetbv0() & 0x6) != 0x6)
+            {
+                return features;
+            }
+            features.avx = true;
+
+            if (max_leaf >= 7)
+            {
+                cpuid(info, 7, 0);
+                features.avx2 = (info[1] & (1 << 5)) != 0;
+            }
+            return features;
+        }
+
+        const CpuFeatures& features()
+        {
+            static const CpuFeatures detected = detect();
+            return detected;
+        }
+#endif
+    }
+
+    bool has_avx()
+    {
+#ifdef TRVIEW_CPU_X86
+        return features().avx;
+#else
+        return false;
+#endif
+    }
+
+    bool has_avx2()
+    {
+#ifdef TRVIEW_CPU_X86
+        return features().avx2;
+#else
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace trview
+{
+    /// Whether the processor supports AVX and the operating system saves the AVX registers.
+    /// Always false on processors that aren't x86 or x64, where the SIMD paths that use it don't apply.
+    /// @returns Whether AVX instructions can be used.
+    bool has_avx();
+
+    /// Whether the processor supports AVX2 and the operating system saves the AVX registers.
+    /// Always false on processors that aren't x86 or x64, where the SIMD paths that use it don't apply.
+    /// @returns Whether AVX2 instructions can be used.
+    bool has_avx2();
+}
@@ -17,12 +17,75 @@ namespace trview
                 }
             }
         };
+
+        class FileMapping final : public IFiles::MappedFile
+        {
+        public:
+            FileMapping(HANDLE file, HANDLE mapping, const uint8_t* view, std::size_t size)
+                : _file(file), _mapping(mapping), _view(view), _size(size)
+            {
+            }
+
+            virtual ~FileMapping()
+            {
+                if (_view)
+                {
+                    UnmapViewOfFile(_view);
+                }
+                if (_mapping)
+                {
+                    CloseHandle(_mapping);
+                }
+                if (_file)
+                {
+                    CloseHandle(_file);
+                }
+            }
+
+            std::span<const uint8_t> data() const override
+            {
+                return { _view, _size };
+            }
+        private:
+            /// <summary>
+            /// Kept open so that other programs still can't write to the file while it is mapped.
+            /// </summary>
+            HANDLE _file{ nullptr };
+            HANDLE _mapping{ nullptr };
+            const uint8_t* _view{ nullptr };
+            std::size_t _size{ 0u };
+        };
+
+        /// <summary>
+        /// File contents that have been read into memory, used when a file can't be mapped.
+        /// </summary>
+        class LoadedFile final : public IFiles::MappedFile
+        {
+        public:
+            explicit LoadedFile(std::vector<uint8_t>&& bytes)
+                : _bytes(std::move(bytes))
+            {
+            }
+
+            virtual ~LoadedFile() = default;
+
+            std::span<const uint8_t> data() const override
+            {
+                return _bytes;
+            }
+        private:
+            std::vector<uint8_t> _bytes;
+        };
     }
 
     IFiles::~IFiles()
     {
     }
 
+    IFiles::MappedFile::~MappedFile()
+    {
+    }
+
     std::string Files::appdata_directory() const
     {
         SafePath path;
@@ -48,6 +111,33 @@ namespace trview
         DeleteFile(to_utf16(filename).c_str());
     }
 
+    void Files::touch_file(const std::string& filename) const
+    {
+        HANDLE file = CreateFile(to_utf16(filename).c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        FILETIME now{};
+        GetSystemTimeAsFileTime(&now);
+        SetFileTime(file, nullptr, nullptr, &now);
+        CloseHandle(file);
+    }
+
+    std::optional<IFiles::File> Files::file_info(const std::string& filename) const
+    {
+        WIN32_FILE_ATTRIBUTE_DATA data{};
+        if (!GetFileAttributesEx(to_utf16(filename).c_str(), GetFileExInfoStandard, &data) ||
+            (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+        {
+            return std::nullopt;
+        }
+
+        return File{ filename, filename_without_path(filename), data.nFileSizeLow,
+            static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32 | data.ftLastWriteTime.dwLowDateTime };
+    }
+
     bool Files::create_directory(const std::string& directory) const
     {
         return CreateDirectory(to_utf16(directory).c_str(), nullptr) || GetLastError() == ERROR_ALREADY_EXISTS;
@@ -88,6 +178,59 @@ namespace trview
         }
     }
 
+    std::shared_ptr<const IFiles::MappedFile> Files::map_file(const std::string& filename) const
+    {
+        // Writes would change the level underneath the parser and mapped files can't be truncated, so other programs
+        // can read, rename or delete the file but not write to it while it is mapped. If another program already has it
+        // open for writing this fails and the file is read into memory instead.
+        HANDLE file = CreateFile(to_utf16(filename).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return load_mapped_copy(filename);
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return load_mapped_copy(filename);
+        }
+
+        // Empty files can't be mapped, but are still valid files.
+        if (size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return std::make_shared<FileMapping>(nullptr, nullptr, nullptr, 0);
+        }
+
+        HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return load_mapped_copy(filename);
+        }
+
+        const auto view = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return load_mapped_copy(filename);
+        }
+
+        return std::make_shared<FileMapping>(file, mapping, view, static_cast<std::size_t>(size.QuadPart));
+    }
+
+    std::shared_ptr<const IFiles::MappedFile> Files::load_mapped_copy(const std::string& filename) const
+    {
+        auto bytes = load_file(filename);
+        if (!bytes)
+        {
+            return nullptr;
+        }
+        return std::make_shared<LoadedFile>(std::move(bytes.value()));
+    }
+
     void Files::save_file(const std::string& filename, const std::vector<uint8_t>& bytes) const
     {
         std::ofstream outfile;
@@ -175,7 +318,8 @@ namespace trview
             {
                 if (!(fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
                 {
-                    File file{ to_utf8(folder + L"\\" + fd.cFileName), to_utf8(fd.cFileName), fd.nFileSizeLow };
+                    File file{ to_utf8(folder + L"\\" + fd.cFileName), to_utf8(fd.cFileName), fd.nFileSizeLow,
+                        static_cast<uint64_t>(fd.ftLastWriteTime.dwHighDateTime) << 32 | fd.ftLastWriteTime.dwLowDateTime };
                     data.push_back(file);
                 }
             } while (FindNextFile(find, &fd) != 0);
@@ -12,8 +12,11 @@ namespace trview
         virtual std::string fonts_directory() const override;
         virtual bool create_directory(const std::string& directory) const override;
         virtual void delete_file(const std::string& filename) const override;
+        virtual void touch_file(const std::string& filename) const override;
+        virtual std::optional<File> file_info(const std::string& filename) const override;
         virtual std::optional<std::vector<uint8_t>> load_file(const std::string& filename) const override;
         virtual std::optional<std::vector<uint8_t>> load_file(const std::wstring& filename) const override;
+        virtual std::shared_ptr<const MappedFile> map_file(const std::string& filename) const override;
         virtual void save_file(const std::string& filename, const std::vector<uint8_t>& bytes) const override;
         virtual void save_file(const std::string& filename, const std::string& text) const override;
         virtual std::vector<File> get_files(const std::string& folder, const std::string& pattern) const override;
@@ -21,6 +24,10 @@ namespace trview
         std::string working_directory() const override;
         void set_working_directory(const std::string& directory) override;
     private:
+        /// <summary>
+        /// Read a file into memory for when it can't be mapped.
+        /// </summary>
+        std::shared_ptr<const MappedFile> load_mapped_copy(const std::string& filename) const;
         std::vector<File> get_files(const std::wstring& folder, const std::vector<std::wstring>& patterns) const;
     };
 }
@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <vector>
 #include <optional>
+#include <memory>
+#include <span>
 
 namespace trview
 {
@@ -14,6 +16,10 @@ namespace trview
             std::string path;
             std::string friendly_name;
             uint32_t size;
+            /// <summary>
+            /// Time of the last write, only useful for comparing against other files.
+            /// </summary>
+            uint64_t last_write_time{ 0 };
         };
 
         struct Directory
@@ -22,13 +28,41 @@ namespace trview
             std::string friendly_name;
         };
 
+        /// <summary>
+        /// Read-only view of the contents of a file. The data is valid for the lifetime of the object.
+        /// </summary>
+        struct MappedFile
+        {
+            virtual ~MappedFile() = 0;
+            virtual std::span<const uint8_t> data() const = 0;
+        };
+
         virtual ~IFiles() = 0;
         virtual std::string appdata_directory() const = 0;
         virtual std::string fonts_directory() const = 0;
         virtual bool create_directory(const std::string& directory) const = 0;
         virtual void delete_file(const std::string& filename) const = 0;
+        /// <summary>
+        /// Set the last write time of a file to now.
+        /// </summary>
+        /// <param name="filename">The file to update.</param>
+        virtual void touch_file(const std::string& filename) const = 0;
+        /// <summary>
+        /// Get the size and last write time of a file without opening it.
+        /// </summary>
+        /// <param name="filename">The file to check.</param>
+        /// <returns>The file details or empty if the file doesn't exist.</returns>
+        virtual std::optional<File> file_info(const std::string& filename) const = 0;
         virtual std::optional<std::vector<uint8_t>> load_file(const std::string& filename) const = 0;
         virtual std::optional<std::vector<uint8_t>> load_file(const std::wstring& filename) const = 0;
+        /// <summary>
+        /// Map a file into memory without copying it. Other programs can't write to the file while it is mapped, so
+        /// keep the mapping only as long as it is needed. If the file can't be mapped, or another program is already
+        /// writing to it, it is read into memory instead.
+        /// </summary>
+        /// <param name="filename">The file to map.</param>
+        /// <returns>The mapped file or nullptr if the file could not be opened.</returns>
+        virtual std::shared_ptr<const MappedFile> map_file(const std::string& filename) const = 0;
         virtual void save_file(const std::string& filename, const std::vector<uint8_t>& bytes) const = 0;
         virtual void save_file(const std::string& filename, const std::string& text) const = 0;
         virtual std::vector<File> get_files(const std::string& folder, const std::string& pattern) const = 0;
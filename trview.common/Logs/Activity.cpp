@@ -6,19 +6,22 @@ namespace trview
     Activity::Activity(const std::shared_ptr<ILog>& log, const std::string& topic, const std::string& name)
         : _log(log), _topic(topic), _names({ name })
     {
-        _log->log(Message::Status::Information, _topic, _names, "Activity Started");
+        _trace_id = _log->trace_activity(_topic, _names);
+        _log->trace({ .activity = _trace_id, .kind = TraceEvent::Kind::ActivityStarted });
     }
 
     Activity::Activity(const Activity& parent, const std::string& name)
         : _log(parent._log), _topic(parent._topic), _names(parent._names)
     {
         _names.push_back(name);
-        _log->log(Message::Status::Information, _topic, _names, "Activity Started");
+        _trace_id = _log->trace_activity(_topic, _names);
+        _log->trace({ .activity = _trace_id, .kind = TraceEvent::Kind::ActivityStarted });
     }
 
     Activity::~Activity()
     {
-        _log->log(Message::Status::Information, _topic, _names, "Activity Ended");
+        _log->trace({ .activity = _trace_id, .kind = TraceEvent::Kind::ActivityEnded });
+        _log->release_trace_activity(_trace_id);
     }
 
     void Activity::log(const std::string& text) const
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <concepts>
 #include "ILog.h"
 
 namespace trview
@@ -27,9 +28,32 @@ namespace trview
         ~Activity();
         void log(const std::string& text) const;
         void log(Message::Status status, const std::string& text) const;
+        /// <summary>
+        /// Record a trace event. The event is only formatted if the log is read.
+        /// </summary>
+        /// <param name="offset">The file offset the event relates to.</param>
+        /// <param name="event">Format string for the event. Must have static storage duration.</param>
+        /// <param name="args">Integer arguments for the format string.</param>
+        template <std::integral... Args>
+        void trace(uint64_t offset, const char* event, Args... args) const;
     private:
         mutable std::shared_ptr<ILog> _log;
         std::string _topic;
         std::vector<std::string> _names;
+        uint32_t _trace_id{ 0u };
     };
+
+    template <std::integral... Args>
+    void Activity::trace(uint64_t offset, const char* event, Args... args) const
+    {
+        static_assert(sizeof...(Args) <= TraceEvent::MaxArgs, "Too many trace arguments");
+        _log->trace(
+            {
+                .event = event,
+                .activity = _trace_id,
+                .offset = offset,
+                .args = { static_cast<int64_t>(args)... },
+                .arg_count = static_cast<uint8_t>(sizeof...(Args))
+            });
+    }
 }
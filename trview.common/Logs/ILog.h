@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Message.h"
+#include "TraceEvent.h"
 
 namespace trview
 {
@@ -14,5 +15,18 @@ namespace trview
         virtual std::vector<std::string> topics() const = 0;
         virtual std::vector<std::string> activities(const std::string& topic) const = 0;
         virtual void clear() = 0;
+        /// <summary>
+        /// Get the id used by trace events for an activity. The id stays valid until it is released.
+        /// </summary>
+        virtual uint32_t trace_activity(const std::string& topic, const std::vector<std::string>& activity) = 0;
+        /// <summary>
+        /// Release an id from trace_activity. Activities that are no longer used are removed when the log is cleared.
+        /// </summary>
+        virtual void release_trace_activity(uint32_t id) = 0;
+        virtual void trace(const TraceEvent& event) = 0;
+        /// <summary>
+        /// Get a number that changes whenever the log contents change, so readers can keep what they formatted until it does.
+        /// </summary>
+        virtual uint64_t sequence() const = 0;
     };
 }
@@ -1,13 +1,94 @@
 #include "Log.h"
 #include <set>
 #include <format>
+#include <algorithm>
+#include <ranges>
 
 namespace trview
 {
+    namespace
+    {
+        const std::string DroppedTopic = "Log";
+        const std::string DroppedActivity = "Trace";
+
+        std::string activity_key(const std::string& topic, const std::vector<std::string>& activity)
+        {
+            std::string key = topic;
+            for (const auto& name : activity)
+            {
+                key += '\0';
+                key += name;
+            }
+            return key;
+        }
+
+        std::string format_timestamp(const SYSTEMTIME& time)
+        {
+            return std::format("{:02d}-{:02d}-{} {:02d}:{:02d}:{:02d}", time.wDay, time.wMonth, time.wYear, time.wHour, time.wMinute, time.wSecond);
+        }
+
+        std::string format_timestamp(uint64_t ticks)
+        {
+            FILETIME utc{ static_cast<DWORD>(ticks), static_cast<DWORD>(ticks >> 32) };
+            FILETIME local{};
+            SYSTEMTIME time{};
+            FileTimeToLocalFileTime(&utc, &local);
+            FileTimeToSystemTime(&local, &time);
+            return format_timestamp(time);
+        }
+
+        uint64_t current_ticks()
+        {
+            FILETIME time;
+            GetSystemTimeAsFileTime(&time);
+            return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+        }
+
+        std::string format_event(const TraceEvent& event)
+        {
+            try
+            {
+                const auto& [a0, a1, a2] = event.args;
+                switch (event.arg_count)
+                {
+                    case 0:
+                        return std::vformat(event.event, std::make_format_args());
+                    case 1:
+                        return std::vformat(event.event, std::make_format_args(a0));
+                    case 2:
+                        return std::vformat(event.event, std::make_format_args(a0, a1));
+                    default:
+                        return std::vformat(event.event, std::make_format_args(a0, a1, a2));
+                }
+            }
+            catch (const std::format_error&)
+            {
+                return event.event;
+            }
+        }
+
+        std::string format_text(const TraceEvent& event)
+        {
+            switch (event.kind)
+            {
+                case TraceEvent::Kind::ActivityStarted:
+                    return "Activity Started";
+                case TraceEvent::Kind::ActivityEnded:
+                    return "Activity Ended";
+            }
+            return std::format("[{}] {}", event.offset, format_event(event));
+        }
+    }
+
     ILog::~ILog()
     {
     }
 
+    Log::Log(Mode mode, std::size_t trace_capacity)
+        : _mode(mode), _trace(mode == Mode::Trace ? trace_capacity : 0u)
+    {
+    }
+
     void Log::log(Message::Status status, const std::string& topic, const std::string& activity, const std::string& text)
     {
         log(status, topic, std::vector<std::string>{ activity }, text);
@@ -18,38 +99,37 @@ namespace trview
         SYSTEMTIME time;
         GetLocalTime(&time);
         std::lock_guard lock{ _mutex };
-        _messages.push_back({
-            status,
-            std::format("{:02d}-{:02d}-{} {:02d}:{:02d}:{:02d}", time.wDay, time.wMonth, time.wYear, time.wHour, time.wMinute, time.wSecond),
-            topic, activity, text });
+        _messages.push_back({ _sequence++, { status, format_timestamp(time), topic, activity, text } });
     }
 
     std::vector<Message> Log::messages() const
     {
-        std::lock_guard lock{ _mutex };
-        return _messages;
+        return collect([](auto&&, auto&&) { return true; });
     }
 
     std::vector<Message> Log::messages(const std::string& topic, const std::string& activity) const 
     {
-        std::vector<Message> messages;
-        {
-            std::lock_guard lock{ _mutex };
-            std::copy_if(_messages.begin(), _messages.end(), std::back_inserter(messages),
-                [&](const auto& m) { return m.topic == topic &&
-                !m.activity.empty() &&
-                m.activity[0] == activity; });
-        }
-        return messages;
+        return collect([&](const std::string& t, const std::vector<std::string>& a)
+            {
+                return t == topic && !a.empty() && a[0] == activity;
+            });
     }
 
     std::vector<std::string> Log::topics() const
     {
         std::set<std::string> all_topics;
         std::lock_guard lock{ _mutex };
-        for (const auto& message : _messages)
+        for (const auto& entry : _messages)
         {
-            all_topics.insert(message.topic);
+            all_topics.insert(entry.message.topic);
+        }
+        for (std::size_t i = 0; i < _trace_count; ++i)
+        {
+            all_topics.insert(_trace_activities.at(_trace[i].event.activity).topic);
+        }
+        if (_trace_dropped)
+        {
+            all_topics.insert(DroppedTopic);
         }
         return { all_topics.begin(), all_topics.end() };
     }
@@ -58,13 +138,25 @@ namespace trview
     {
         std::set<std::string> all_activities;
         std::lock_guard lock{ _mutex };
-        for (const auto& message : _messages)
+        for (const auto& entry : _messages)
+        {
+            if (entry.message.topic == topic && !entry.message.activity.empty())
+            {
+                all_activities.insert(entry.message.activity[0]);
+            }
+        }
+        for (std::size_t i = 0; i < _trace_count; ++i)
         {
-            if (message.topic == topic && !message.activity.empty())
+            const auto& activity = _trace_activities.at(_trace[i].event.activity);
+            if (activity.topic == topic && !activity.activity.empty())
             {
-                all_activities.insert(message.activity[0]);
+                all_activities.insert(activity.activity[0]);
             }
         }
+        if (_trace_dropped && topic == DroppedTopic)
+        {
+            all_activities.insert(DroppedActivity);
+        }
         return { all_activities.begin(), all_activities.end() };
     }
 
@@ -72,5 +164,132 @@ namespace trview
     {
         std::lock_guard lock{ _mutex };
         _messages.clear();
+        _trace_next = 0;
+        _trace_count = 0;
+        _trace_dropped = 0;
+        ++_sequence;
+
+        // Activities that are still alive keep their ids, the rest are only needed to read events that are now gone.
+        std::erase_if(_trace_activity_ids, [&](const auto& id) { return _trace_activities.at(id.second).references == 0; });
+        std::erase_if(_trace_activities, [](const auto& activity) { return activity.second.references == 0; });
+    }
+
+    uint32_t Log::trace_activity(const std::string& topic, const std::vector<std::string>& activity)
+    {
+        std::lock_guard lock{ _mutex };
+        const auto [existing, inserted] = _trace_activity_ids.try_emplace(activity_key(topic, activity), _next_trace_activity);
+        if (inserted)
+        {
+            _trace_activities.insert({ _next_trace_activity++, { topic, activity } });
+        }
+        ++_trace_activities.at(existing->second).references;
+        return existing->second;
+    }
+
+    void Log::release_trace_activity(uint32_t id)
+    {
+        std::lock_guard lock{ _mutex };
+        const auto activity = _trace_activities.find(id);
+        if (activity != _trace_activities.end() && activity->second.references > 0)
+        {
+            --activity->second.references;
+        }
+    }
+
+    void Log::trace(const TraceEvent& event)
+    {
+        if (_mode == Mode::Text)
+        {
+            TraceActivity activity;
+            {
+                std::lock_guard lock{ _mutex };
+                activity = _trace_activities.at(event.activity);
+            }
+            log(event.status, activity.topic, activity.activity, format_text(event));
+            return;
+        }
+
+        if (_trace.empty())
+        {
+            return;
+        }
+
+        const auto ticks = current_ticks();
+        std::lock_guard lock{ _mutex };
+        if (_trace_count == _trace.size())
+        {
+            ++_trace_dropped;
+        }
+        auto& entry = _trace[_trace_next];
+        entry.sequence = _sequence++;
+        entry.event = event;
+        entry.event.ticks = ticks;
+        _trace_next = (_trace_next + 1) % _trace.size();
+        _trace_count = std::min(_trace_count + 1, _trace.size());
+    }
+
+    uint64_t Log::sequence() const
+    {
+        std::lock_guard lock{ _mutex };
+        return _sequence;
+    }
+
+    template <typename Filter>
+    std::vector<Message> Log::collect(Filter&& filter) const
+    {
+        std::lock_guard lock{ _mutex };
+        std::vector<std::pair<uint64_t, Message>> entries;
+        for (const auto& entry : _messages)
+        {
+            if (filter(entry.message.topic, entry.message.activity))
+            {
+                entries.push_back({ entry.sequence, entry.message });
+            }
+        }
+
+        // The oldest event left is where the dropped events were, so the message about them goes just before it.
+        if (_trace_dropped && filter(DroppedTopic, std::vector<std::string>{ DroppedActivity }))
+        {
+            entries.push_back({ _trace[_trace_next].sequence, dropped_message() });
+        }
+
+        // Only the trace events that pass the filter are formatted.
+        for (std::size_t i = 0; i < _trace_count; ++i)
+        {
+            const auto& entry = _trace[i];
+            const auto& activity = _trace_activities.at(entry.event.activity);
+            if (filter(activity.topic, activity.activity))
+            {
+                entries.push_back({ entry.sequence, to_message(entry.event) });
+            }
+        }
+
+        std::ranges::stable_sort(entries, {}, &std::pair<uint64_t, Message>::first);
+        return entries | std::views::values | std::ranges::to<std::vector>();
+    }
+
+    Message Log::to_message(const TraceEvent& event) const
+    {
+        const auto& activity = _trace_activities.at(event.activity);
+        return
+        {
+            .status = event.status,
+            .timestamp = format_timestamp(event.ticks),
+            .topic = activity.topic,
+            .activity = activity.activity,
+            .text = format_text(event)
+        };
+    }
+
+    Message Log::dropped_message() const
+    {
+        return
+        {
+            .status = Message::Status::Warning,
+            .timestamp = format_timestamp(_trace[_trace_next].event.ticks),
+            .topic = DroppedTopic,
+            .activity = { DroppedActivity },
+            .text = std::format("{} earlier trace events were dropped as the trace buffer holds {} events", _trace_dropped, _trace.size())
+        };
     }
 }
@@ -3,12 +3,29 @@
 #include "ILog.h"
 #include "Message.h"
 #include <mutex>
+#include <unordered_map>
 
 namespace trview
 {
     class Log final : public ILog
     {
     public:
+        /// <summary>
+        /// How trace events are stored.
+        /// </summary>
+        enum class Mode
+        {
+            /// <summary>
+            /// Trace events are formatted into messages as they are logged.
+            /// </summary>
+            Text,
+            /// <summary>
+            /// Trace events are kept in a ring buffer and formatted when the log is read.
+            /// </summary>
+            Trace
+        };
+
+        explicit Log(Mode mode = Mode::Trace, std::size_t trace_capacity = 65536);
         virtual ~Log() = default;
         virtual void log(Message::Status status, const std::string& topic, const std::string& activity, const std::string& text) override;
         virtual void log(Message::Status status, const std::string& topic, const std::vector<std::string>& activity, const std::string& text) override;
@@ -17,8 +34,54 @@ namespace trview
         virtual std::vector<std::string> topics() const override;
         virtual std::vector<std::string> activities(const std::string& topic) const override;
         virtual void clear() override;
+        virtual uint32_t trace_activity(const std::string& topic, const std::vector<std::string>& activity) override;
+        virtual void release_trace_activity(uint32_t id) override;
+        virtual void trace(const TraceEvent& event) override;
+        virtual uint64_t sequence() const override;
     private:
-        std::vector<Message> _messages;
+        struct Entry
+        {
+            uint64_t sequence;
+            Message message;
+        };
+
+        struct TraceEntry
+        {
+            uint64_t sequence;
+            TraceEvent event;
+        };
+
+        struct TraceActivity
+        {
+            std::string topic;
+            std::vector<std::string> activity;
+            /// <summary>
+            /// The number of Activity objects that are using this id.
+            /// </summary>
+            uint32_t references{ 0u };
+        };
+
+        template <typename Filter>
+        std::vector<Message> collect(Filter&& filter) const;
+        Message to_message(const TraceEvent& event) const;
+        Message dropped_message() const;
+
+        Mode _mode;
+        std::vector<Entry> _messages;
+        std::vector<TraceEntry> _trace;
+        std::size_t _trace_next{ 0u };
+        std::size_t _trace_count{ 0u };
+        /// <summary>
+        /// The number of trace events that have been overwritten since the log was cleared.
+        /// </summary>
+        uint64_t _trace_dropped{ 0u };
+        std::unordered_map<uint32_t, TraceActivity> _trace_activities;
+        /// <summary>
+        /// Activity ids by topic and activity names.
+        /// </summary>
+        std::unordered_map<std::string, uint32_t> _trace_activity_ids;
+        uint32_t _next_trace_activity{ 0u };
+        uint64_t _sequence{ 0u };
         mutable std::mutex _mutex;
     };
 }
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Message.h"
+
+namespace trview
+{
+    /// <summary>
+    /// Compact log entry that is only formatted into a message when the log is read.
+    /// </summary>
+    struct TraceEvent
+    {
+        static constexpr std::size_t MaxArgs = 3;
+
+        enum class Kind : uint8_t
+        {
+            /// <summary>
+            /// The event format string is formatted with the args and prefixed with the offset.
+            /// </summary>
+            Event,
+            /// <summary>
+            /// The activity started. The event, offset and args are not used.
+            /// </summary>
+            ActivityStarted,
+            /// <summary>
+            /// The activity ended. The event, offset and args are not used.
+            /// </summary>
+            ActivityEnded
+        };
+
+        /// <summary>
+        /// Format string for the event. This identifies the event so must have static storage duration.
+        /// </summary>
+        const char* event{ nullptr };
+        uint32_t activity{ 0u };
+        Message::Status status{ Message::Status::Information };
+        uint64_t offset{ 0u };
+        std::array<int64_t, MaxArgs> args{};
+        uint8_t arg_count{ 0u };
+        uint64_t ticks{ 0u };
+        Kind kind{ Kind::Event };
+    };
+}
@@ -6,6 +6,13 @@ namespace trview
 {
     namespace mocks
     {
+        struct MockMappedFile : public IFiles::MappedFile
+        {
+            MockMappedFile();
+            virtual ~MockMappedFile();
+            MOCK_METHOD(std::span<const uint8_t>, data, (), (const, override));
+        };
+
         struct MockFiles : public IFiles
         {
             MockFiles();
@@ -14,8 +21,11 @@ namespace trview
             MOCK_METHOD(std::string, fonts_directory, (), (const, override));
             MOCK_METHOD(bool, create_directory, (const std::string&), (const, override));
             MOCK_METHOD(void, delete_file, (const std::string&), (const, override));
+            MOCK_METHOD(void, touch_file, (const std::string&), (const, override));
+            MOCK_METHOD(std::optional<File>, file_info, (const std::string&), (const, override));
             MOCK_METHOD(std::optional<std::vector<uint8_t>>, load_file, (const std::string&), (const, override));
             MOCK_METHOD(std::optional<std::vector<uint8_t>>, load_file, (const std::wstring&), (const, override));
+            MOCK_METHOD(std::shared_ptr<const MappedFile>, map_file, (const std::string&), (const, override));
             MOCK_METHOD(void, save_file, (const std::string&, const std::vector<uint8_t>&), (const, override));
             MOCK_METHOD(void, save_file, (const std::string&, const std::string&), (const, override));
             MOCK_METHOD(std::vector<File>, get_files, (const std::string&, const std::string&), (const, override));
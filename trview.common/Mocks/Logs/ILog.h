@@ -17,6 +17,10 @@ namespace trview
             MOCK_METHOD(std::vector<std::string>, topics, (), (const, override));
             MOCK_METHOD(std::vector<std::string>, activities, (const std::string&), (const, override));
             MOCK_METHOD(void, clear, (), (override));
+            MOCK_METHOD(uint32_t, trace_activity, (const std::string&, const std::vector<std::string>&), (override));
+            MOCK_METHOD(void, release_trace_activity, (uint32_t), (override));
+            MOCK_METHOD(void, trace, (const TraceEvent&), (override));
+            MOCK_METHOD(uint64_t, sequence, (), (const, override));
         };
     }
 }
@@ -30,5 +30,8 @@ namespace trview
 
         MockFiles::MockFiles() {}
         MockFiles::~MockFiles() {}
+
+        MockMappedFile::MockMappedFile() {}
+        MockMappedFile::~MockMappedFile() {}
     }
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace trview
+{
+    namespace tests
+    {
+        namespace benchmark
+        {
+            // Allocation accounting for every allocation made by the process. Each block carries its
+            // size in front of it so that the unsized delete can account for it. A benchmark executable
+            // replaces the global operator new and delete with allocate and deallocate.
+            inline std::atomic<std::size_t> current_bytes{ 0 };
+            inline std::atomic<std::size_t> peak_bytes{ 0 };
+            inline std::atomic<std::size_t> allocation_count{ 0 };
+            constexpr std::size_t Header = alignof(std::max_align_t);
+
+            inline void* allocate(std::size_t size)
+            {
+                auto block = static_cast<uint8_t*>(std::malloc(size + Header));
+                if (!block)
+                {
+                    throw std::bad_alloc();
+                }
+                *reinterpret_cast<std::size_t*>(block) = size;
+                const auto now = current_bytes.fetch_add(size) + size;
+                auto peak = peak_bytes.load();
+                while (now > peak && !peak_bytes.compare_exchange_weak(peak, now))
+                {
+                }
+                ++allocation_count;
+                return block + Header;
+            }
+
+            inline void deallocate(void* pointer)
+            {
+                if (!pointer)
+                {
+                    return;
+                }
+                auto block = static_cast<uint8_t*>(pointer) - Header;
+                current_bytes -= *reinterpret_cast<std::size_t*>(block);
+                std::free(block);
+            }
+
+            struct Result
+            {
+                std::string name;
+                uint32_t iterations{ 0 };
+                double milliseconds{ 0 };
+                std::size_t bytes{ 0 };
+                std::size_t peak_bytes{ 0 };
+                std::size_t allocations{ 0 };
+            };
+
+            // Runs the function the given number of times and reports the mean time. Peak allocation is
+            // measured relative to what was allocated before the benchmark started.
+            inline Result measure(const std::string& name, uint32_t iterations, std::size_t bytes, const std::function<void()>& function)
+            {
+                const auto baseline = current_bytes.load();
+                peak_bytes = baseline;
+                const auto allocations = allocation_count.load();
+
+                const auto start = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < iterations; ++i)
+                {
+                    function();
+                }
+                const auto end = std::chrono::steady_clock::now();
+
+                return
+                {
+                    .name = name,
+                    .iterations = iterations,
+                    .milliseconds = std::chrono::duration<double, std::milli>(end - start).count() / iterations,
+                    .bytes = bytes,
+                    .peak_bytes = peak_bytes - baseline,
+                    .allocations = (allocation_count - allocations) / iterations
+                };
+            }
+
+            inline void print_header()
+            {
+                std::cout << std::format("{:<32} {:>6} {:>12} {:>12} {:>14} {:>12}\n", "Benchmark", "Runs", "Mean (ms)", "MB/s", "Peak alloc (MB)", "Allocations");
+            }
+
+            inline void print(const Result& result)
+            {
+                const double megabytes_per_second = result.milliseconds > 0 ? (result.bytes / (1024.0 * 1024.0)) / (result.milliseconds / 1000.0) : 0.0;
+                std::cout << std::format("{:<32} {:>6} {:>12.3f} {:>12.1f} {:>14.2f} {:>12}\n",
+                    result.name, result.iterations, result.milliseconds, megabytes_per_second, result.peak_bytes / (1024.0 * 1024.0), result.allocations);
+            }
+        }
+    }
+}